@@ -0,0 +1,403 @@
+//===============================================================================================//
+/*!
+ *  \file      KernelBenchmarks.cpp
+ *  \author    Loïc Corenthy
+ *  \version   1.2
+ *  \date      19/10/2026
+ *  \copyright (c) 2026 Loïc Corenthy. All rights reserved.
+ */
+//===============================================================================================//
+
+// Micro benchmarks of the kernels of the ray tracer. Every benchmark works on inputs generated once with a fixed seed, so that two runs (or two
+// versions of a kernel) measure exactly the same work. The time per iteration is the time of one call to the kernel, the "rays/s" counter of
+// the kernels working on rays (and the "calls/s" counter of the other ones) is the number of calls per second.
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "Animation.hpp"
+#include "BoundingBox.hpp"
+#include "Camera.hpp"
+#include "Color.hpp"
+#include "CubeMap.hpp"
+#include "Image.hpp"
+#include "Mesh.hpp"
+#include "Noise.hpp"
+#include "Phong.hpp"
+#include "Point.hpp"
+#include "Ray.hpp"
+#include "Scene.hpp"
+#include "Sphere.hpp"
+#include "Triangle.hpp"
+#include "Vector.hpp"
+
+using std::make_shared;
+using std::mt19937;
+using std::runtime_error;
+using std::shared_ptr;
+using std::size_t;
+using std::uniform_real_distribution;
+using std::vector;
+
+using LCNS::Animation;
+using LCNS::BoundingBox;
+using LCNS::Color;
+using LCNS::CubeMap;
+using LCNS::Image;
+using LCNS::Mesh;
+using LCNS::Noise;
+using LCNS::Phong;
+using LCNS::Point;
+using LCNS::Ray;
+using LCNS::Real;
+using LCNS::Renderable;
+using LCNS::Scene;
+using LCNS::Sphere;
+using LCNS::Triangle;
+using LCNS::Vector;
+
+namespace
+{
+    constexpr unsigned int seed       = 2026u;
+    constexpr size_t       inputCount = 1024u;
+
+    /// Random points in a cube centered on the origin
+    vector<Point> randomPoints(mt19937& generator, double halfSize, size_t count)
+    {
+        uniform_real_distribution<double> distribution(-halfSize, halfSize);
+
+        vector<Point> points;
+        points.reserve(count);
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            const double x = distribution(generator);
+            const double y = distribution(generator);
+            const double z = distribution(generator);
+            points.emplace_back(x, y, z);
+        }
+
+        return points;
+    }
+
+    /// Rays starting on a sphere of radius 20 around the origin and aiming at a random point of a cube of half size "spread", so that most
+    /// of them go through the objects placed around the origin
+    vector<Ray> randomRays(double spread)
+    {
+        mt19937    generator(seed);
+        const auto origins = randomPoints(generator, 1.0, inputCount);
+        const auto targets = randomPoints(generator, spread, inputCount);
+
+        vector<Ray> rays;
+        rays.reserve(inputCount);
+
+        for (size_t i = 0; i < inputCount; ++i)
+        {
+            Vector toOrigin = origins[i] - Point(0.0);
+            toOrigin.normalize();
+
+            const Point origin = Point(0.0) + toOrigin * 20.0;
+            rays.emplace_back(origin, targets[i] - origin);
+        }
+
+        return rays;
+    }
+
+    /// Soup of small triangles in a cube of half size 5
+    shared_ptr<Mesh> randomMesh(unsigned int triangleCount)
+    {
+        mt19937                         generator(seed);
+        uniform_real_distribution<Real> offset(-1.0, 1.0);
+
+        const auto centers = randomPoints(generator, 5.0, triangleCount);
+        auto       mesh    = make_shared<Mesh>(triangleCount);
+
+        for (const auto& center : centers)
+        {
+            const Point point0(center.x() + offset(generator), center.y() + offset(generator), center.z() + offset(generator));
+            const Point point1(center.x() + offset(generator), center.y() + offset(generator), center.z() + offset(generator));
+            const Point point2(center.x() + offset(generator), center.y() + offset(generator), center.z() + offset(generator));
+            mesh->addTriangle(Triangle(point0, point1, point2));
+        }
+
+        mesh->boundingBoxLimits(Point(-6.0), Point(6.0));
+
+        return mesh;
+    }
+
+    /// Add a counter with the number of calls to the kernel per second
+    void setCounters(benchmark::State& state, const char* name = "rays/s")
+    {
+        state.counters[name] = benchmark::Counter(static_cast<double>(state.iterations()), benchmark::Counter::kIsRate);
+    }
+
+    /// Image used by the texture benchmarks
+    const char* const texturePath = "./resources/earth_front.png";
+
+}  // namespace
+
+static void BM_TriangleIntersect(benchmark::State& state)
+{
+    Triangle    triangle(Point(-5.0, -5.0, 0.0), Point(5.0, -5.0, 0.0), Point(0.0, 5.0, 0.0));
+    vector<Ray> rays  = randomRays(5.0);
+    size_t      index = 0u;
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(triangle.intersect(rays[index]));
+        index = (index + 1u) % inputCount;
+    }
+
+    setCounters(state);
+}
+BENCHMARK(BM_TriangleIntersect);
+
+static void BM_SphereIntersect(benchmark::State& state)
+{
+    Sphere      sphere(Point(0.0), 3.0);
+    vector<Ray> rays  = randomRays(5.0);
+    size_t      index = 0u;
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(sphere.intersect(rays[index]));
+        index = (index + 1u) % inputCount;
+    }
+
+    setCounters(state);
+}
+BENCHMARK(BM_SphereIntersect);
+
+static void BM_BoundingBoxIntersect(benchmark::State& state)
+{
+    const BoundingBox boundingBox(Point(-3.0), Point(3.0));
+    const vector<Ray> rays  = randomRays(5.0);
+    size_t            index = 0u;
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(boundingBox.intersect(rays[index]));
+        index = (index + 1u) % inputCount;
+    }
+
+    setCounters(state);
+}
+BENCHMARK(BM_BoundingBoxIntersect);
+
+static void BM_MeshIntersect(benchmark::State& state)
+{
+    auto        mesh  = randomMesh(static_cast<unsigned int>(state.range(0)));
+    vector<Ray> rays  = randomRays(5.0);
+    size_t      index = 0u;
+
+    for (auto _ : state)
+    {
+        rays[index].intersected(nullptr);
+        benchmark::DoNotOptimize(mesh->intersect(rays[index]));
+        index = (index + 1u) % inputCount;
+    }
+
+    setCounters(state);
+}
+BENCHMARK(BM_MeshIntersect)->Arg(64)->Arg(1024);
+
+static void BM_SceneIntersect(benchmark::State& state)
+{
+    auto scene = make_shared<Scene>();
+
+    // Spheres around a mesh
+    mt19937    generator(seed);
+    const auto centers = randomPoints(generator, 8.0, static_cast<size_t>(state.range(0)));
+    for (const auto& center : centers)
+        scene->add(shared_ptr<Renderable>(make_shared<Sphere>(center, 0.5)));
+
+    scene->add(shared_ptr<Renderable>(randomMesh(256u)));
+    scene->commit();
+
+    vector<Ray> rays  = randomRays(8.0);
+    size_t      index = 0u;
+
+    for (auto _ : state)
+    {
+        rays[index].intersected(nullptr);
+        benchmark::DoNotOptimize(scene->intersect(rays[index]));
+        index = (index + 1u) % inputCount;
+    }
+
+    setCounters(state);
+}
+BENCHMARK(BM_SceneIntersect)->Arg(16)->Arg(128);
+
+static void BM_SceneAnimate(benchmark::State& state)
+{
+    auto scene = make_shared<Scene>();
+
+    // Spheres around a mesh, one sphere out of 8 moves
+    mt19937    generator(seed);
+    const auto centers = randomPoints(generator, 8.0, static_cast<size_t>(state.range(0)));
+    for (size_t i = 0; i < centers.size(); ++i)
+    {
+        auto sphere = make_shared<Sphere>(centers[i], 0.5);
+        scene->add(shared_ptr<Renderable>(sphere));
+
+        if (i % 8u == 0u)
+        {
+            Animation animation;
+            animation.key(0.0, Vector(Real{ 0.0 }));
+            animation.key(1.0, Vector(Real{ 1.0 }, Real{ 0.0 }, Real{ 0.0 }));
+            scene->animate(sphere, animation);
+        }
+    }
+
+    scene->add(shared_ptr<Renderable>(randomMesh(256u)));
+    scene->commit();
+
+    // The frames of the animations are played in a loop, the hierarchy is refitted for each one
+    size_t frame = 0u;
+
+    for (auto _ : state)
+    {
+        scene->time(static_cast<double>(frame % 25u) / 24.0);
+        ++frame;
+    }
+
+    setCounters(state, "frames/s");
+}
+BENCHMARK(BM_SceneAnimate)->Arg(128)->Arg(4096);
+
+static void BM_PerlinNoise(benchmark::State& state)
+{
+    const Noise noise;
+    mt19937     generator(seed);
+    const auto  points = randomPoints(generator, 50.0, inputCount);
+    size_t      index  = 0u;
+
+    for (auto _ : state)
+    {
+        const auto& point = points[index];
+        benchmark::DoNotOptimize(noise.perlinNoise(point.x(), point.y(), point.z()));
+        index = (index + 1u) % inputCount;
+    }
+
+    setCounters(state, "calls/s");
+}
+BENCHMARK(BM_PerlinNoise);
+
+static void BM_PerlinNoiseBatch(benchmark::State& state)
+{
+    const Noise noise;
+    mt19937     generator(seed);
+    const auto  points = randomPoints(generator, 50.0, inputCount);
+
+    vector<double> x, y, z, result(inputCount);
+    for (const auto& point : points)
+    {
+        x.push_back(point.x());
+        y.push_back(point.y());
+        z.push_back(point.z());
+    }
+
+    for (auto _ : state)
+    {
+        noise.perlinNoise(x.data(), y.data(), z.data(), result.data(), inputCount);
+        benchmark::DoNotOptimize(result.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<benchmark::IterationCount>(inputCount));
+}
+BENCHMARK(BM_PerlinNoiseBatch);
+
+static void BM_ImagePixelColor(benchmark::State& state)
+{
+    Image image;
+    if (!image.loadFromFile(texturePath))
+        throw runtime_error("Unable to load the image of the benchmark");
+
+    image.interpolation(state.range(0) == 0 ? Image::InterpolationMethod::NEAREST : Image::InterpolationMethod::LINEAR);
+
+    mt19937                           generator(seed);
+    uniform_real_distribution<double> distribution(0.0, 1.0);
+
+    vector<double> coordinates(2u * inputCount);
+    for (auto& coordinate : coordinates)
+        coordinate = distribution(generator);
+
+    size_t index = 0u;
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(image.pixelColor(coordinates[2u * index], coordinates[2u * index + 1u]));
+        index = (index + 1u) % inputCount;
+    }
+
+    setCounters(state, "calls/s");
+}
+BENCHMARK(BM_ImagePixelColor)->Arg(0)->Arg(1);
+
+static void BM_CubeMapColorAt(benchmark::State& state)
+{
+    CubeMap cubeMap(Point(0.0), 100.0);
+    cubeMap.addImage(CubeMap::Faces::BACK, texturePath);
+    cubeMap.addImage(CubeMap::Faces::FRONT, texturePath);
+    cubeMap.addImage(CubeMap::Faces::UP, texturePath);
+    cubeMap.addImage(CubeMap::Faces::DOWN, texturePath);
+    cubeMap.addImage(CubeMap::Faces::LEFT, texturePath);
+    cubeMap.addImage(CubeMap::Faces::RIGHT, texturePath);
+    cubeMap.interpolationMethod(Image::InterpolationMethod::LINEAR);
+
+    // Rays leaving the center of the cube in every direction
+    mt19937     generator(seed);
+    const auto  directions = randomPoints(generator, 1.0, inputCount);
+    vector<Ray> rays;
+    for (const auto& direction : directions)
+        rays.emplace_back(Point(0.0), direction - Point(0.0));
+
+    size_t index = 0u;
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(cubeMap.colorAt(rays[index]));
+        index = (index + 1u) % inputCount;
+    }
+
+    setCounters(state);
+}
+BENCHMARK(BM_CubeMapColorAt);
+
+static void BM_PhongReflectance(benchmark::State& state)
+{
+    Phong phong(Color(0.8, 0.5, 0.2), Color(1.0), 15);
+
+    mt19937    generator(seed);
+    const auto toLight  = randomPoints(generator, 1.0, inputCount);
+    const auto toViewer = randomPoints(generator, 1.0, inputCount);
+    const auto normals  = randomPoints(generator, 1.0, inputCount);
+
+    vector<Vector> vecToLight, vecToViewer, normal;
+    for (size_t i = 0; i < inputCount; ++i)
+    {
+        vecToLight.push_back(toLight[i] - Point(0.0));
+        vecToViewer.push_back(toViewer[i] - Point(0.0));
+        normal.push_back(normals[i] - Point(0.0));
+        normal.back().normalize();
+    }
+
+    size_t index = 0u;
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(phong.reflectance(vecToLight[index], vecToViewer[index], normal[index], toLight[index]));
+        index = (index + 1u) % inputCount;
+    }
+
+    setCounters(state, "calls/s");
+}
+BENCHMARK(BM_PhongReflectance);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,464 @@
+//===============================================================================================//
+/*!
+ *  \file      SceneBenchmarks.cpp
+ *  \author    Loïc Corenthy
+ *  \version   1.2
+ *  \date      19/10/2026
+ *  \copyright (c) 2026 Loïc Corenthy. All rights reserved.
+ */
+//===============================================================================================//
+
+// End to end benchmark of the test scenes. Each scene is rendered without window at a fixed resolution and thread count, in its own process so
+// that the peak memory of a scene does not depend on the previous ones (and a scene that fails does not stop the others). The wall time of the
+// rendering, the number of rays per second and the peak resident set size of every scene are written in a JSON file, which can be compared to
+// a previous run to find the scenes that became slower.
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <regex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#ifdef WIN32
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+#ifdef __APPLE__
+#include <mach-o/dyld.h>
+#endif
+
+#include "Camera.hpp"
+#include "CreateScenes.hpp"
+#include "Renderer.hpp"
+#include "Scene.hpp"
+#include "Statistics.hpp"
+
+using std::cerr;
+using std::cout;
+using std::function;
+using std::ifstream;
+using std::make_shared;
+using std::map;
+using std::ofstream;
+using std::ostringstream;
+using std::regex;
+using std::regex_search;
+using std::shared_ptr;
+using std::size_t;
+using std::smatch;
+using std::sregex_iterator;
+using std::stod;
+using std::stoul;
+using std::string;
+using std::uint64_t;
+using std::vector;
+using std::chrono::duration;
+using std::chrono::steady_clock;
+using std::filesystem::canonical;
+using std::filesystem::path;
+
+using LCNS::Renderer;
+using LCNS::Scene;
+using LCNS::Statistics;
+
+namespace
+{
+    struct Parameters
+    {
+        unsigned int         width     = 320u;
+        unsigned int         height    = 240u;
+        unsigned int         threads   = 1u;
+        unsigned int         repeat    = 1u;
+        bool                 wavefront = false;
+        vector<unsigned int> scenes;
+        string               outputPath = "scene_benchmarks.json";
+        string               baselinePath;
+        double               threshold   = 0.1;
+        int                  singleScene = -1;
+    };
+
+    struct SceneResult
+    {
+        unsigned int scene         = 0u;
+        bool         success       = false;
+        double       setupSeconds  = 0.0;
+        double       renderSeconds = 0.0;
+        uint64_t     rays          = 0u;
+        double       raysPerSecond = 0.0;
+        uint64_t     peakRssKB     = 0u;
+    };
+
+    /// Functions creating the test scenes, in the order of the --scene parameter of the executable
+    const vector<function<void(shared_ptr<Scene>)>> sceneCreators = { createTestScene, createScene01,    createScene02, createScene03,
+                                                                      createScene04,   createScene04bis, createScene05, createScene06,
+                                                                      createScene07,   createScene08,    createScene09, createScene10,
+                                                                      createScene11,   createScene12,    createScene13, createScene14 };
+
+    /// Marker of the line holding the result of a scene in the output of the process rendering it
+    const char* const resultMarker = "{\"scene\"";
+
+    /// Peak resident set size of the process in kB
+    uint64_t peakResidentSetSize(void)
+    {
+#ifdef WIN32
+        PROCESS_MEMORY_COUNTERS counters;
+        if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+            return static_cast<uint64_t>(counters.PeakWorkingSetSize) / 1024u;
+
+        return 0u;
+#else
+        rusage usage;
+        if (getrusage(RUSAGE_SELF, &usage) != 0)
+            return 0u;
+
+#ifdef __APPLE__
+        // ru_maxrss is in bytes on macOS and in kB on Linux
+        return static_cast<uint64_t>(usage.ru_maxrss) / 1024u;
+#else
+        return static_cast<uint64_t>(usage.ru_maxrss);
+#endif
+#endif
+    }
+
+    /// Path of this executable, argv[0] does not give it when the executable is found through the PATH
+    string executablePath(const char* argv0)
+    {
+        std::error_code error;
+
+#if defined(WIN32)
+        char buffer[MAX_PATH];
+        if (const DWORD length = GetModuleFileNameA(nullptr, buffer, MAX_PATH); length != 0u && length < MAX_PATH)
+            return string(buffer, length);
+#elif defined(__APPLE__)
+        char     buffer[4096];
+        uint32_t size = sizeof(buffer);
+        if (_NSGetExecutablePath(buffer, &size) == 0)
+        {
+            if (const auto executable = canonical(path(buffer), error); !error)
+                return executable.string();
+        }
+#else
+        if (const auto executable = canonical(path("/proc/self/exe"), error); !error)
+            return executable.string();
+#endif
+
+        return argv0;
+    }
+
+    /// Render a scene in the current process
+    SceneResult renderScene(const Parameters& parameters, unsigned int sceneIndex)
+    {
+        SceneResult result;
+        result.scene = sceneIndex;
+
+        Renderer::setMultiThreading(parameters.threads > 1u);
+        Renderer::setThreadCount(parameters.threads);
+        Renderer::setWavefront(parameters.wavefront);
+
+        const auto setupStarts = steady_clock::now();
+
+        auto scene = make_shared<Scene>();
+        sceneCreators[sceneIndex](scene);
+        Renderer::setScene(scene, parameters.width, parameters.height);
+
+        const auto renderStarts = steady_clock::now();
+
+        Renderer::render();
+
+        const auto renderFinished = steady_clock::now();
+
+        const auto statistics = Renderer::statistics();
+
+        result.success       = true;
+        result.setupSeconds  = duration<double>(renderStarts - setupStarts).count();
+        result.renderSeconds = duration<double>(renderFinished - renderStarts).count();
+        result.rays          = statistics[Statistics::Counter::SCENE_RAYS] + statistics[Statistics::Counter::SHADOW_CACHE_HITS];
+        result.raysPerSecond = result.renderSeconds > 0.0 ? static_cast<double>(result.rays) / result.renderSeconds : 0.0;
+        result.peakRssKB     = peakResidentSetSize();
+
+        return result;
+    }
+
+    /// Write the result of a scene as a JSON object on one line
+    string toJson(const SceneResult& result)
+    {
+        ostringstream json;
+        json.precision(17);
+        json << resultMarker << ": " << result.scene << ", \"success\": " << (result.success ? "true" : "false")
+             << ", \"setupSeconds\": " << result.setupSeconds << ", \"renderSeconds\": " << result.renderSeconds << ", \"rays\": " << result.rays
+             << ", \"raysPerSecond\": " << result.raysPerSecond << ", \"peakRssKB\": " << result.peakRssKB << "}";
+
+        return json.str();
+    }
+
+    /// Read the value of a field in a JSON object written by toJson (0 if the field is not found)
+    double field(const string& json, const string& name)
+    {
+        smatch match;
+        if (regex_search(json, match, regex("\"" + name + "\"\\s*:\\s*([-+0-9.eE]+)")))
+            return stod(match[1].str());
+
+        return 0.0;
+    }
+
+    /// Parse the result of a scene from a JSON object written by toJson
+    SceneResult fromJson(const string& json)
+    {
+        SceneResult result;
+        result.scene         = static_cast<unsigned int>(field(json, "scene"));
+        result.success       = json.find("\"success\": true") != string::npos;
+        result.setupSeconds  = field(json, "setupSeconds");
+        result.renderSeconds = field(json, "renderSeconds");
+        result.rays          = static_cast<uint64_t>(field(json, "rays"));
+        result.raysPerSecond = field(json, "raysPerSecond");
+        result.peakRssKB     = static_cast<uint64_t>(field(json, "peakRssKB"));
+
+        return result;
+    }
+
+    /// Render a scene in a child process running this executable with --single
+    SceneResult renderSceneInChildProcess(const Parameters& parameters, const string& executable, unsigned int sceneIndex)
+    {
+        ostringstream command;
+        command << '"' << executable << "\" --single " << sceneIndex << " --width " << parameters.width << " --height " << parameters.height
+                << " --threads " << parameters.threads << " --repeat " << parameters.repeat << (parameters.wavefront ? " --wavefront" : "");
+
+#ifdef WIN32
+        FILE* pipe = _popen(command.str().c_str(), "r");
+#else
+        FILE* pipe = popen(command.str().c_str(), "r");
+#endif
+
+        SceneResult result;
+        result.scene = sceneIndex;
+
+        if (pipe == nullptr)
+            return result;
+
+        // The renderer writes its progress on the standard output, only the line with the result is kept
+        string output;
+        char   buffer[512];
+        while (fgets(buffer, sizeof(buffer), pipe) != nullptr)
+            output += buffer;
+
+#ifdef WIN32
+        _pclose(pipe);
+#else
+        pclose(pipe);
+#endif
+
+        if (const auto position = output.rfind(resultMarker); position != string::npos)
+            result = fromJson(output.substr(position, output.find('\n', position) - position));
+
+        return result;
+    }
+
+    /// Write the results of all the scenes in a JSON file
+    void writeJson(const Parameters& parameters, const vector<SceneResult>& results)
+    {
+        ofstream file(parameters.outputPath);
+        if (!file)
+        {
+            cerr << "Unable to write the results in " << parameters.outputPath << '\n';
+            return;
+        }
+
+        file << "{\n";
+        file << "  \"width\": " << parameters.width << ",\n";
+        file << "  \"height\": " << parameters.height << ",\n";
+        file << "  \"threads\": " << parameters.threads << ",\n";
+        file << "  \"repeat\": " << parameters.repeat << ",\n";
+        file << "  \"wavefront\": " << (parameters.wavefront ? "true" : "false") << ",\n";
+        file << "  \"scenes\": [\n";
+
+        for (size_t i = 0; i < results.size(); ++i)
+            file << "    " << toJson(results[i]) << (i + 1u < results.size() ? ",\n" : "\n");
+
+        file << "  ]\n";
+        file << "}\n";
+    }
+
+    /// Read the results of the scenes from a JSON file written by writeJson
+    map<unsigned int, SceneResult> readJson(const string& path)
+    {
+        map<unsigned int, SceneResult> results;
+
+        ifstream file(path);
+        if (!file)
+        {
+            cerr << "Unable to read the baseline " << path << '\n';
+            return results;
+        }
+
+        const string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+        const regex  sceneObject(R"(\{"scene"[^}]*\})");
+
+        for (auto it = sregex_iterator(content.begin(), content.end(), sceneObject); it != sregex_iterator(); ++it)
+        {
+            const auto result     = fromJson(it->str());
+            results[result.scene] = result;
+        }
+
+        return results;
+    }
+
+    /// Compare the results with a baseline, return the number of scenes slower than the baseline by more than the threshold
+    unsigned int compare(const Parameters& parameters, const vector<SceneResult>& results)
+    {
+        const auto baseline = readJson(parameters.baselinePath);
+
+        unsigned int regressionCount = 0u;
+
+        cout << "\nComparison with " << parameters.baselinePath << " (threshold " << 100.0 * parameters.threshold << "%)\n";
+
+        for (const auto& result : results)
+        {
+            const auto it = baseline.find(result.scene);
+            if (it == baseline.end() || !it->second.success || !result.success || it->second.renderSeconds <= 0.0)
+            {
+                cout << "  scene " << result.scene << ": not compared\n";
+                continue;
+            }
+
+            const double change       = result.renderSeconds / it->second.renderSeconds - 1.0;
+            const bool   isRegression = change > parameters.threshold;
+
+            cout << "  scene " << result.scene << ": " << it->second.renderSeconds << " s -> " << result.renderSeconds << " s ("
+                 << (change >= 0.0 ? "+" : "") << 100.0 * change << "%)" << (isRegression ? "  REGRESSION" : "") << '\n';
+
+            if (isRegression)
+                ++regressionCount;
+        }
+
+        return regressionCount;
+    }
+
+    /// Parse a comma separated list of scene indices
+    vector<unsigned int> sceneList(const string& list)
+    {
+        vector<unsigned int> scenes;
+
+        std::stringstream stream(list);
+        string            index;
+        while (std::getline(stream, index, ','))
+            scenes.push_back(static_cast<unsigned int>(stoul(index)));
+
+        return scenes;
+    }
+
+    bool processArguments(int argc, char** argv, Parameters& parameters)
+    {
+        for (int i = 1; i < argc; ++i)
+        {
+            const bool hasValue = i + 1 < argc;
+
+            if (strcmp(argv[i], "--width") == 0 && hasValue)
+                parameters.width = static_cast<unsigned int>(atoi(argv[++i]));
+            else if (strcmp(argv[i], "--height") == 0 && hasValue)
+                parameters.height = static_cast<unsigned int>(atoi(argv[++i]));
+            else if (strcmp(argv[i], "--threads") == 0 && hasValue)
+                parameters.threads = static_cast<unsigned int>(atoi(argv[++i]));
+            else if (strcmp(argv[i], "--repeat") == 0 && hasValue)
+                parameters.repeat = static_cast<unsigned int>(atoi(argv[++i]));
+            else if (strcmp(argv[i], "--wavefront") == 0)
+                parameters.wavefront = true;
+            else if (strcmp(argv[i], "--scenes") == 0 && hasValue)
+                parameters.scenes = sceneList(argv[++i]);
+            else if (strcmp(argv[i], "--output") == 0 && hasValue)
+                parameters.outputPath = argv[++i];
+            else if (strcmp(argv[i], "--compare") == 0 && hasValue)
+                parameters.baselinePath = argv[++i];
+            else if (strcmp(argv[i], "--threshold") == 0 && hasValue)
+                parameters.threshold = atof(argv[++i]);
+            else if (strcmp(argv[i], "--single") == 0 && hasValue)
+                parameters.singleScene = atoi(argv[++i]);
+            else
+                return false;
+        }
+
+        if (parameters.width == 0u || parameters.height == 0u || parameters.threads == 0u || parameters.repeat == 0u)
+            return false;
+
+        for (auto scene : parameters.scenes)
+        {
+            if (scene >= sceneCreators.size())
+                return false;
+        }
+
+        return parameters.singleScene < static_cast<int>(sceneCreators.size());
+    }
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    Parameters parameters;
+
+    if (!processArguments(argc, argv, parameters))
+    {
+        cerr << "Usage: " << argv[0] << " [--width 320] [--height 240] [--threads 1] [--repeat 1] [--wavefront] [--scenes 0,1,2]"
+             << " [--output results.json] [--compare baseline.json] [--threshold 0.1]\n";
+        return EXIT_FAILURE;
+    }
+
+    // Child process rendering one scene
+    if (parameters.singleScene >= 0)
+    {
+        // Keep the fastest rendering to reduce the noise of the measure
+        auto result = renderScene(parameters, static_cast<unsigned int>(parameters.singleScene));
+        for (unsigned int i = 1; i < parameters.repeat; ++i)
+        {
+            const auto otherResult = renderScene(parameters, static_cast<unsigned int>(parameters.singleScene));
+            if (otherResult.renderSeconds < result.renderSeconds)
+                result = otherResult;
+        }
+
+        cout << '\n' << toJson(result) << std::endl;
+        return EXIT_SUCCESS;
+    }
+
+    if (parameters.scenes.empty())
+    {
+        for (unsigned int i = 0; i < sceneCreators.size(); ++i)
+            parameters.scenes.push_back(i);
+    }
+
+    const string executable = executablePath(argv[0]);
+
+    vector<SceneResult> results;
+
+    for (auto scene : parameters.scenes)
+    {
+        cout << "Scene " << scene << "... " << std::flush;
+
+        results.push_back(renderSceneInChildProcess(parameters, executable, scene));
+
+        const auto& result = results.back();
+        if (result.success)
+            cout << result.renderSeconds << " s, " << result.raysPerSecond << " rays/s, " << result.peakRssKB << " kB\n";
+        else
+            cout << "failed\n";
+    }
+
+    writeJson(parameters, results);
+    cout << "Results written in " << parameters.outputPath << '\n';
+
+    if (!parameters.baselinePath.empty() && compare(parameters, results) != 0u)
+        return EXIT_FAILURE;
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,65 @@
+function (enable_benchmarks)
+
+    message ("")
+    message (STATUS "Benchmarks")
+    message (STATUS "----------")
+
+    option (ENABLE_BENCHMARKS "Enable the benchmarks of the ray tracer" OFF)
+
+    if (ENABLE_BENCHMARKS)
+
+        # The benchmarks are built with all the sources of the ray tracer except the one with the main function (and the OpenGL window)
+        set (RAY_TRACING_SOURCE_FILES ${LOCAL_SOURCE_FILES})
+        list (FILTER RAY_TRACING_SOURCE_FILES EXCLUDE REGEX ".*/src/main\\.cpp$")
+
+        # End to end benchmark of the test scenes
+        add_executable (RayTracingSceneBench ${CMAKE_SOURCE_DIR}/benchmarks/SceneBenchmarks.cpp ${RAY_TRACING_SOURCE_FILES})
+        target_include_directories (RayTracingSceneBench PRIVATE ${CMAKE_SOURCE_DIR}/src ${OpenImageIO_INCLUDE_DIR})
+        target_link_libraries (RayTracingSceneBench PRIVATE project_warnings OpenImageIO::OpenImageIO)
+
+        # The rays per second come from the statistics counters, they are always compiled in the scene benchmark
+        target_compile_definitions (RayTracingSceneBench PRIVATE RAY_TRACING_STATISTICS)
+
+        if (WIN32)
+            target_compile_definitions (RayTracingSceneBench PUBLIC NOMINMAX)
+            target_link_libraries (RayTracingSceneBench PRIVATE psapi ws2_32)
+        endif ()
+
+        # Micro benchmarks of the kernels
+        find_package (benchmark QUIET)
+        if (NOT benchmark_FOUND)
+            if (UNIX)
+                execute_process (COMMAND ./vcpkg install benchmark
+                                 WORKING_DIRECTORY ${CMAKE_SOURCE_DIR}/vcpkg/
+                                 RESULT_VARIABLE BENCHMARK_FROM_VCPKG)
+            else (WIN32)
+                execute_process (COMMAND cmd /c "vcpkg.exe install benchmark benchmark:x64-windows"
+                                 WORKING_DIRECTORY ${CMAKE_SOURCE_DIR}/vcpkg/
+                                 RESULT_VARIABLE BENCHMARK_FROM_VCPKG)
+            endif ()
+
+            if (NOT BENCHMARK_FROM_VCPKG EQUAL "0")
+                message (FATAL_ERROR "Unable to download Google Benchmark")
+            endif ()
+
+            find_package (benchmark REQUIRED)
+        endif ()
+        message (STATUS "Found Google Benchmark " ${benchmark_VERSION})
+
+        add_executable (RayTracingBench ${CMAKE_SOURCE_DIR}/benchmarks/KernelBenchmarks.cpp ${RAY_TRACING_SOURCE_FILES})
+        target_include_directories (RayTracingBench PRIVATE ${CMAKE_SOURCE_DIR}/src ${OpenImageIO_INCLUDE_DIR})
+        target_link_libraries (RayTracingBench PRIVATE project_warnings OpenImageIO::OpenImageIO benchmark::benchmark)
+
+        if (WIN32)
+            target_compile_definitions (RayTracingBench PUBLIC NOMINMAX)
+            target_link_libraries (RayTracingBench PRIVATE ws2_32)
+        endif ()
+
+        # The benchmarks load the images and the models of the scenes from the resources directory
+        add_custom_command (TARGET RayTracingSceneBench POST_BUILD COMMAND ${CMAKE_COMMAND} -E copy_directory ${CMAKE_SOURCE_DIR}/resources
+                                                                          "${CMAKE_CURRENT_BINARY_DIR}/resources/")
+        add_custom_command (TARGET RayTracingBench POST_BUILD COMMAND ${CMAKE_COMMAND} -E copy_directory ${CMAKE_SOURCE_DIR}/resources
+                                                                     "${CMAKE_CURRENT_BINARY_DIR}/resources/")
+    endif ()
+
+endfunction ()
@@ -0,0 +1,273 @@
+//===============================================================================================//
+/*!
+ *  \file      AOVBuffer.cpp
+ *  \author    Loïc Corenthy
+ *  \version   1.2
+ *  \date      19/10/2026
+ *  \copyright (c) 2026 Loïc Corenthy. All rights reserved.
+ */
+//===============================================================================================//
+
+#include "AOVBuffer.hpp"
+#include "BRDF.hpp"
+#include "Mesh.hpp"
+#include "Ray.hpp"
+#include "Renderable.hpp"
+#include "Shader.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <functional>
+
+#include <OpenImageIO/imageio.h>
+#include <OpenImageIO/typedesc.h>
+
+using std::array;
+using std::function;
+using std::list;
+using std::max;
+using std::min;
+using std::shared_ptr;
+using std::sqrt;
+using std::size_t;
+using std::string;
+using std::uint32_t;
+using std::vector;
+
+using LCNS::AOVBuffer;
+using LCNS::Color;
+using LCNS::Mesh;
+using LCNS::Point;
+using LCNS::Ray;
+using LCNS::Renderable;
+using LCNS::Vector;
+
+using OIIO::ImageOutput;
+using OIIO::ImageSpec;
+using OIIO::TypeDesc;
+
+namespace
+{
+    /// Get the path of one of the AOVs, its name is added before the extension of the file (after the last dot of the name of the file)
+    string aovPath(const string& path, const string& name)
+    {
+        const auto nameStart = path.find_last_of("/\\");
+        auto       extension = path.find_last_of('.');
+        if (extension == string::npos || (nameStart != string::npos && extension < nameStart))
+            extension = path.size();
+
+        return path.substr(0u, extension) + "_" + name + path.substr(extension);
+    }
+
+    /// Write an image of the dimensions of the buffer, the color of each pixel (between 0 and 1) is given by a function of its position
+    bool writeImage(const string& path, unsigned int width, unsigned int height, const function<array<float, 3>(unsigned int, unsigned int)>& color)
+    {
+        auto image = ImageOutput::create(path);
+        if (!image)
+            return false;
+
+        // The first row of the buffer is the bottom of the image
+        vector<unsigned char> pixels;
+        pixels.reserve(3u * static_cast<size_t>(width) * height);
+
+        for (unsigned int j = height; j-- > 0u;)
+        {
+            for (unsigned int i = 0; i < width; ++i)
+            {
+                for (const float value : color(i, j))
+                    pixels.push_back(static_cast<unsigned char>(max(0.0f, min(value, 1.0f)) * 255.0f));
+            }
+        }
+
+        const ImageSpec spec(static_cast<int>(width), static_cast<int>(height), 3, TypeDesc::UINT8);
+
+        return image->open(path, spec) && image->write_image(TypeDesc::UINT8, pixels.data()) && image->close();
+    }
+
+}  // namespace
+
+bool AOVBuffer::isRecorded(void) const noexcept
+{
+    return _recorded;
+}
+
+void AOVBuffer::record(bool record) noexcept
+{
+    _recorded = record;
+}
+
+void AOVBuffer::identify(const list<shared_ptr<Renderable>>& renderables)
+{
+    _objectIds.clear();
+
+    uint32_t objectId = 0u;
+    for (const auto& renderable : renderables)
+    {
+        _objectIds[renderable.get()] = ++objectId;
+
+        // The rays intersect the triangles of the meshes, not the meshes themselves
+        if (const auto* mesh = dynamic_cast<const Mesh*>(renderable.get()))
+        {
+            for (const auto& triangle : mesh->triangles())
+                _objectIds[&triangle] = objectId;
+        }
+    }
+}
+
+void AOVBuffer::add(unsigned int i, unsigned int j, const Ray& ray, Renderable* object, double weight)
+{
+    if (!_recorded || _width <= i || _height <= j)
+        return;
+
+    // The background does not count in the AOVs, a pixel on a silhouette only averages the samples that hit an object
+    if (object == nullptr)
+        return;
+
+    auto& pixel = _pixels[_width * j + i];
+
+    const Point  intersection = ray.origin().offset(ray.direction(), ray.length());
+    const Vector normal       = object->interpolatedNormal(intersection);
+
+    // The diffuse color of a light along the normal is the color of the surface without its lighting
+    const Color albedo = object->shader()->reflectionModel()->diffuse(normal, normal, intersection);
+
+    for (unsigned int c = 0; c < 3u; ++c)
+    {
+        const double component = normal[c];
+        pixel.normal[c] += static_cast<float>(component * weight);
+        pixel.albedo[c] += static_cast<float>(albedo[c] * weight);
+    }
+
+    const double distance = ray.length() * ray.direction().length();
+    pixel.depth += static_cast<float>(distance * weight);
+    pixel.hitWeight += static_cast<float>(weight);
+
+    if (const auto objectId = _objectIds.find(object); objectId != _objectIds.end() && static_cast<float>(weight) > pixel.objectWeight)
+    {
+        pixel.objectId     = objectId->second;
+        pixel.objectWeight = static_cast<float>(weight);
+    }
+}
+
+array<float, 3> AOVBuffer::normal(unsigned int i, unsigned int j) const noexcept
+{
+    assert(i < _width && j < _height);
+    auto normal = _pixels[_width * j + i].normal;
+
+    if (const float length = sqrt(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]); length > 0.0f)
+    {
+        for (auto& component : normal)
+            component /= length;
+    }
+
+    return normal;
+}
+
+array<float, 3> AOVBuffer::albedo(unsigned int i, unsigned int j) const noexcept
+{
+    assert(i < _width && j < _height);
+    const auto& pixel = _pixels[_width * j + i];
+
+    if (pixel.hitWeight <= 0.0f)
+        return array<float, 3>{};
+
+    return { pixel.albedo[0] / pixel.hitWeight, pixel.albedo[1] / pixel.hitWeight, pixel.albedo[2] / pixel.hitWeight };
+}
+
+float AOVBuffer::depth(unsigned int i, unsigned int j) const noexcept
+{
+    assert(i < _width && j < _height);
+    const auto& pixel = _pixels[_width * j + i];
+
+    return pixel.hitWeight > 0.0f ? pixel.depth / pixel.hitWeight : 0.0f;
+}
+
+uint32_t AOVBuffer::objectId(unsigned int i, unsigned int j) const noexcept
+{
+    assert(i < _width && j < _height);
+    return _pixels[_width * j + i].objectId;
+}
+
+void AOVBuffer::dimensions(unsigned int width, unsigned int height)
+{
+    _width  = width;
+    _height = height;
+
+    reset();
+}
+
+unsigned int AOVBuffer::height(void) const noexcept
+{
+    return _height;
+}
+
+unsigned int AOVBuffer::width(void) const noexcept
+{
+    return _width;
+}
+
+void AOVBuffer::reset(void)
+{
+    _pixels.assign(static_cast<size_t>(_width) * _height, Pixel());
+}
+
+bool AOVBuffer::write(const string& path) const
+{
+    // The depth is normalized between the nearest and the farthest pixels
+    float nearest  = 0.0f;
+    float farthest = 0.0f;
+    for (unsigned int j = 0; j < _height; ++j)
+    {
+        for (unsigned int i = 0; i < _width; ++i)
+        {
+            if (const float pixelDepth = depth(i, j); pixelDepth > 0.0f)
+            {
+                nearest  = nearest > 0.0f ? min(nearest, pixelDepth) : pixelDepth;
+                farthest = max(farthest, pixelDepth);
+            }
+        }
+    }
+
+    const auto normalImage = [this](unsigned int i, unsigned int j) {
+        auto pixelNormal = normal(i, j);
+        if (pixelNormal[0] == 0.0f && pixelNormal[1] == 0.0f && pixelNormal[2] == 0.0f)
+            return pixelNormal;
+
+        for (auto& component : pixelNormal)
+            component = component * 0.5f + 0.5f;
+
+        return pixelNormal;
+    };
+
+    const auto albedoImage = [this](unsigned int i, unsigned int j) { return albedo(i, j); };
+
+    const auto depthImage = [this, nearest, farthest](unsigned int i, unsigned int j) {
+        const float pixelDepth = depth(i, j);
+        if (pixelDepth <= 0.0f)
+            return array<float, 3>{};
+
+        const float value = farthest > nearest ? 1.0f - 0.9f * (pixelDepth - nearest) / (farthest - nearest) : 1.0f;
+        return array<float, 3>{ value, value, value };
+    };
+
+    const auto objectImage = [this](unsigned int i, unsigned int j) {
+        const uint32_t pixelObject = objectId(i, j);
+        if (pixelObject == 0u)
+            return array<float, 3>{};
+
+        // Bits of the number of the object mixed into a color (Knuth's multiplicative hash)
+        const uint32_t hash = pixelObject * 2654435761u;
+        return array<float, 3>{ static_cast<float>((hash >> 24) & 0xffu) / 255.0f,
+                                static_cast<float>((hash >> 16) & 0xffu) / 255.0f,
+                                static_cast<float>((hash >> 8) & 0xffu) / 255.0f };
+    };
+
+    // All the images are written even if one of them fails
+    bool written = writeImage(aovPath(path, "normal"), _width, _height, normalImage);
+    written      = writeImage(aovPath(path, "albedo"), _width, _height, albedoImage) && written;
+    written      = writeImage(aovPath(path, "depth"), _width, _height, depthImage) && written;
+    written      = writeImage(aovPath(path, "object"), _width, _height, objectImage) && written;
+
+    return written;
+}
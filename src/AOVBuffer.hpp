@@ -0,0 +1,100 @@
+//===============================================================================================//
+/*!
+ *  \file      AOVBuffer.hpp
+ *  \author    Loïc Corenthy
+ *  \version   1.2
+ *  \date      19/10/2026
+ *  \copyright (c) 2026 Loïc Corenthy. All rights reserved.
+ */
+//===============================================================================================//
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace LCNS
+{
+    // Forward declaration
+    class Ray;
+    class Renderable;
+
+    /// Auxiliary outputs (AOVs) with the same dimensions as the Buffer of the Renderer: the normal, the albedo, the depth and the object of
+    /// the first intersection of each pixel. A pixel traced with several primary rays (super sampling, aperture) gets the mean of its samples
+    /// that hit an object, weighted like their colors, and the object of the sample with the highest weight. They guide the Denoiser, which
+    /// must not blur the edges of the objects and the textures.
+    class AOVBuffer
+    {
+    public:
+        /// Default constructor
+        AOVBuffer(void) = default;
+
+        /// Check if the AOVs of the pixels are recorded
+        bool isRecorded(void) const noexcept;
+
+        /// Set if the AOVs of the pixels are recorded
+        void record(bool record) noexcept;
+
+        /// Number the objects of a scene, starting from 1 (0 is the background). The triangles of a mesh get the number of the mesh.
+        void identify(const std::list<std::shared_ptr<Renderable>>& renderables);
+
+        /// Add the first intersection of a primary ray of the pixel (i, j) with its weight in the color of the pixel, the ray must have been
+        /// intersected with the scene (nothing is recorded if the AOVs are not)
+        void add(unsigned int i, unsigned int j, const Ray& ray, Renderable* object, double weight);
+
+        /// Get the unit normal of one pixel (null for the background)
+        std::array<float, 3> normal(unsigned int i, unsigned int j) const noexcept;
+
+        /// Get the albedo of one pixel (black for the background)
+        std::array<float, 3> albedo(unsigned int i, unsigned int j) const noexcept;
+
+        /// Get the distance from the camera to one pixel (0 for the background)
+        float depth(unsigned int i, unsigned int j) const noexcept;
+
+        /// Get the number of the object of one pixel (0 for the background)
+        std::uint32_t objectId(unsigned int i, unsigned int j) const noexcept;
+
+        /// Set the buffer's width and height, all the AOVs are set to the background
+        void dimensions(unsigned int width, unsigned int height);
+
+        /// Get the height of the buffer
+        unsigned int height(void) const noexcept;
+
+        /// Get the width of the buffer
+        unsigned int width(void) const noexcept;
+
+        /// Set all the AOVs to the background
+        void reset(void);
+
+        /// Write the AOVs as 4 images, the name of each one is the path with _normal, _albedo, _depth or _object before its extension (which
+        /// gives the format). The normals are mapped from [-1, 1] to [0, 1], the depth is white for the nearest pixel and the objects get
+        /// random colors.
+        bool write(const std::string& path) const;
+
+    private:
+        /// Sums of the samples of a pixel
+        struct Pixel
+        {
+            std::array<float, 3> normal{};
+            std::array<float, 3> albedo{};
+            float                depth        = 0.0f;
+            float                hitWeight    = 0.0f;  ///< Sum of the weights of the samples that hit an object (the albedo and depth are their mean)
+            float                objectWeight = 0.0f;  ///< Weight of the sample that gave the object
+            std::uint32_t        objectId     = 0u;
+        };
+
+    private:
+        std::vector<Pixel>                                   _pixels;
+        std::unordered_map<const Renderable*, std::uint32_t> _objectIds;
+        unsigned int                                         _height   = 0u;
+        unsigned int                                         _width    = 0u;
+        bool                                                 _recorded = false;
+
+    };  // class AOVBuffer
+
+}  // namespace LCNS
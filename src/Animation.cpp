@@ -0,0 +1,61 @@
+//===============================================================================================//
+/*!
+ *  \file      Animation.cpp
+ *  \author    Loïc Corenthy
+ *  \version   1.2
+ *  \date      19/10/2026
+ *  \copyright (c) 2026 Loïc Corenthy. All rights reserved.
+ */
+//===============================================================================================//
+
+#include "Animation.hpp"
+
+#include <algorithm>
+
+using std::upper_bound;
+
+using LCNS::Animation;
+using LCNS::Point;
+using LCNS::toReal;
+using LCNS::Transform;
+using LCNS::Vector;
+
+Animation::Animation(const Point& pivot, const Vector& axis)
+: _pivot(pivot)
+, _axis(axis)
+{
+}
+
+void Animation::key(double time, const Vector& translation, double angle)
+{
+    // The keys are kept sorted by time, a key added at the time of another one comes after it
+    const auto position = upper_bound(_keys.begin(), _keys.end(), time, [](double keyTime, const Key& key) { return keyTime < key.time; });
+    _keys.insert(position, { time, translation, angle });
+}
+
+Transform Animation::at(double time) const
+{
+    if (_keys.empty())
+        return Transform();
+
+    if (time <= _keys.front().time)
+        return Transform(_keys.front().translation, _axis, _keys.front().angle, _pivot);
+
+    if (time >= _keys.back().time)
+        return Transform(_keys.back().translation, _axis, _keys.back().angle, _pivot);
+
+    // First key after the time, the time is between it and the previous key
+    const auto next     = upper_bound(_keys.begin(), _keys.end(), time, [](double keyTime, const Key& key) { return keyTime < key.time; });
+    const auto previous = next - 1;
+
+    const double weight      = (time - previous->time) / (next->time - previous->time);
+    const Vector translation = previous->translation * toReal(1.0 - weight) + next->translation * toReal(weight);
+    const double angle       = previous->angle * (1.0 - weight) + next->angle * weight;
+
+    return Transform(translation, _axis, angle, _pivot);
+}
+
+double Animation::endTime(void) const noexcept
+{
+    return _keys.empty() ? 0.0 : _keys.back().time;
+}
@@ -0,0 +1,67 @@
+//===============================================================================================//
+/*!
+ *  \file      Animation.hpp
+ *  \author    Loïc Corenthy
+ *  \version   1.2
+ *  \date      19/10/2026
+ *  \copyright (c) 2026 Loïc Corenthy. All rights reserved.
+ */
+//===============================================================================================//
+
+#pragma once
+
+#include <vector>
+
+#include "Point.hpp"
+#include "Transform.hpp"
+#include "Vector.hpp"
+
+namespace LCNS
+{
+    /// Motion of an object or of a light of a scene, defined by keys: at the time of a key, the object is rotated by an angle around the axis
+    /// of the animation (going through its pivot point) and then translated, relative to where it was when it was added to the scene. The
+    /// translation and the angle are linearly interpolated between two keys, they stay the ones of the first key before it and the ones of
+    /// the last key after it.
+    class Animation
+    {
+    public:
+        /// Default constructor, the rotations are around the vertical axis through the origin
+        Animation(void) = default;
+
+        /// Constructor with the pivot point and the axis of the rotations
+        Animation(const Point& pivot, const Vector& axis);
+
+        /// Copy constructor
+        Animation(const Animation& animation) = default;
+
+        /// Copy operator
+        Animation& operator=(const Animation& animation) = default;
+
+        /// Destructor
+        ~Animation(void) = default;
+
+        /// Add a key at a time (in seconds), with the translation and the angle of the rotation (in radians) of the object at this time
+        void key(double time, const Vector& translation, double angle = 0.0);
+
+        /// Get the transform of the object at a time (in seconds), the identity if there is no key
+        Transform at(double time) const;
+
+        /// Get the time of the last key (0 if there is no key)
+        double endTime(void) const noexcept;
+
+    private:
+        struct Key
+        {
+            double time;
+            Vector translation;
+            double angle;
+        };
+
+    private:
+        std::vector<Key> _keys;
+        Point            _pivot;
+        Vector           _axis = Vector(Real{ 0.0 }, Real{ 1.0 }, Real{ 0.0 });
+
+    };  // class Animation
+
+}  // namespace LCNS
@@ -0,0 +1,143 @@
+//===============================================================================================//
+/*!
+ *  \file      AssetLoader.cpp
+ *  \author    Loïc Corenthy
+ *  \version   1.2
+ *  \date      19/10/2026
+ *  \copyright (c) 2026 Loïc Corenthy. All rights reserved.
+ */
+//===============================================================================================//
+
+#include "AssetLoader.hpp"
+
+#include <algorithm>
+#include <exception>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+#include "Image.hpp"
+#include "Trace.hpp"
+
+using std::async;
+using std::current_exception;
+using std::exception_ptr;
+using std::function;
+using std::launch;
+using std::max;
+using std::move;
+using std::rethrow_exception;
+using std::runtime_error;
+using std::scoped_lock;
+using std::shared_future;
+using std::shared_ptr;
+using std::string;
+using std::thread;
+using std::unique_lock;
+using std::vector;
+
+using LCNS::AssetLoader;
+using LCNS::Image;
+using LCNS::OBJFile;
+using LCNS::TraceScope;
+
+shared_future<void> AssetLoader::loadImage(shared_ptr<Image> image, const string& path)
+{
+    return _instance()._start<void>([image, path]() {
+        TraceScope traceScope("AssetLoader::loadImage", "scene");
+
+        if (!image->loadFromFile(path))
+            throw runtime_error("Unable to read the image " + path);
+
+        // The file is decoded once from its first row, the tiles that do not fit in the memory budget are decoded again when they are used
+        image->prefetch();
+    });
+}
+
+shared_future<OBJFile> AssetLoader::loadOBJ(const string& path)
+{
+    return _instance()._start<OBJFile>([path]() { return OBJFile(path); });
+}
+
+void AssetLoader::wait(vector<shared_future<void>>& loads)
+{
+    if (loads.empty())
+        return;
+
+    TraceScope traceScope("AssetLoader::wait", "scene", "loads", loads.size());
+
+    // All the loads are waited for before throwing, none of them is still running afterwards. The failed loads stay in the list, a shared
+    // future throws its exception each time it is waited for so that the next wait fails again.
+    vector<shared_future<void>> failedLoads;
+    exception_ptr               firstError;
+
+    for (const auto& load : loads)
+    {
+        try
+        {
+            load.get();
+        }
+        catch (...)
+        {
+            if (!firstError)
+                firstError = current_exception();
+
+            failedLoads.push_back(load);
+        }
+    }
+
+    loads.swap(failedLoads);
+
+    if (firstError)
+        rethrow_exception(firstError);
+}
+
+AssetLoader& AssetLoader::_instance(void)
+{
+    static AssetLoader instance;
+    return instance;
+}
+
+template<typename T>
+shared_future<T> AssetLoader::_start(function<T(void)> task)
+{
+    return async(launch::async, [this, task = move(task)]() {
+                    // The slot of the task is given back even if the load throws
+                    struct Slot
+                    {
+                        AssetLoader& loader;
+
+                        explicit Slot(AssetLoader& assetLoader)
+                        : loader(assetLoader)
+                        {
+                            loader._acquire();
+                        }
+
+                        ~Slot(void)
+                        {
+                            loader._release();
+                        }
+                    } slot(*this);
+
+                    return task();
+                }).share();
+}
+
+void AssetLoader::_acquire(void)
+{
+    const unsigned int maxRunningCount = max(thread::hardware_concurrency(), 1u);
+
+    unique_lock lock(_mutex);
+    _taskEnded.wait(lock, [this, maxRunningCount]() { return _runningCount < maxRunningCount; });
+    ++_runningCount;
+}
+
+void AssetLoader::_release(void)
+{
+    {
+        scoped_lock lock(_mutex);
+        --_runningCount;
+    }
+
+    _taskEnded.notify_one();
+}
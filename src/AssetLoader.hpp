@@ -0,0 +1,79 @@
+//===============================================================================================//
+/*!
+ *  \file      AssetLoader.hpp
+ *  \author    Loïc Corenthy
+ *  \version   1.2
+ *  \date      19/10/2026
+ *  \copyright (c) 2026 Loïc Corenthy. All rights reserved.
+ */
+//===============================================================================================//
+
+#pragma once
+
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "OBJFile.hpp"
+
+namespace LCNS
+{
+    // Forward declaration
+    class Image;
+
+    /// Loader of the assets of a scene (images and .obj files) while the scene is being created. Each load is a task returning a future, the
+    /// tasks run in parallel on their own threads (at most one per processor at a time). The futures are kept by what needs the assets (the
+    /// cube maps wait for their images when their scene is committed), so that a scene only waits for its own assets once everything else is
+    /// ready.
+    class AssetLoader
+    {
+    public:
+        /// Copy constructor (copy not allowed)
+        AssetLoader(const AssetLoader& assetLoader) = delete;
+
+        /// Copy operator (copy not allowed)
+        AssetLoader operator=(const AssetLoader& assetLoader) = delete;
+
+        /// Destructor
+        ~AssetLoader(void) = default;
+
+        /// Start loading an image: its header is read, then its pixels are decoded in the texture cache (within its memory budget). The image
+        /// must not be used before the end of the load, which throws if the image cannot be read.
+        static std::shared_future<void> loadImage(std::shared_ptr<Image> image, const std::string& path);
+
+        /// Start reading an .obj file
+        static std::shared_future<OBJFile> loadOBJ(const std::string& path);
+
+        /// Wait for the end of loads, throws the exception of the first load that failed. The loads that succeeded are removed from the list,
+        /// the ones that failed are kept so that waiting for them again throws again.
+        static void wait(std::vector<std::shared_future<void>>& loads);
+
+    private:
+        /// Default constructor
+        AssetLoader(void) = default;
+
+        /// Get a reference on the instance
+        static AssetLoader& _instance(void);
+
+        /// Start a task on its own thread
+        template<typename T>
+        std::shared_future<T> _start(std::function<T(void)> task);
+
+        /// Wait until less tasks than processors are running, then count the task as running
+        void _acquire(void);
+
+        /// Count the task as ended
+        void _release(void);
+
+    private:
+        std::mutex              _mutex;
+        std::condition_variable _taskEnded;
+        unsigned int            _runningCount = 0u;
+
+    };  // class AssetLoader
+
+}  // namespace LCNS
@@ -0,0 +1,364 @@
+//===============================================================================================//
+/*!
+ *  \file      BVH.cpp
+ *  \author    Loïc Corenthy
+ *  \version   1.2
+ *  \date      19/10/2026
+ *  \copyright (c) 2026 Loïc Corenthy. All rights reserved.
+ */
+//===============================================================================================//
+
+#include "BVH.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <utility>
+
+#include "Mesh.hpp"
+#include "Ray.hpp"
+#include "Sphere.hpp"
+#include "Statistics.hpp"
+#include "Triangle.hpp"
+
+using std::max;
+using std::min;
+using std::nth_element;
+using std::numeric_limits;
+using std::ptrdiff_t;
+using std::size_t;
+using std::swap;
+using std::uint32_t;
+using std::vector;
+
+using LCNS::BVH;
+using LCNS::Mesh;
+using LCNS::Point;
+using LCNS::Ray;
+using LCNS::Real;
+using LCNS::Renderable;
+using LCNS::Sphere;
+using LCNS::Statistics;
+using LCNS::Triangle;
+using LCNS::Vector;
+
+void BVH::build(const vector<Sphere*>& spheres, const vector<Triangle*>& triangles, const vector<Mesh*>& meshes)
+{
+    clear();
+
+    vector<BoundedObject> objects;
+    objects.reserve(spheres.size() + triangles.size() + meshes.size());
+
+    for (auto sphere : spheres)
+        objects.push_back({ Point(), Point(), Point(), { sphere, Type::SPHERE } });
+
+    for (auto triangle : triangles)
+        objects.push_back({ Point(), Point(), Point(), { triangle, Type::TRIANGLE } });
+
+    for (auto mesh : meshes)
+        objects.push_back({ Point(), Point(), Point(), { mesh, Type::MESH } });
+
+    _build(objects);
+}
+
+void BVH::rebuild(void)
+{
+    vector<BoundedObject> objects;
+    objects.reserve(_objects.size());
+
+    for (const auto& object : _objects)
+        objects.push_back({ Point(), Point(), Point(), object });
+
+    clear();
+    _build(objects);
+}
+
+void BVH::refit(void)
+{
+    // The children of a node come after it, the nodes are updated from the last one to the root
+    for (auto node = _nodes.rbegin(); node != _nodes.rend(); ++node)
+    {
+        Point boxMin(numeric_limits<Real>::max());
+        Point boxMax(numeric_limits<Real>::lowest());
+
+        const auto merge = [&boxMin, &boxMax](const Point& otherMin, const Point& otherMax) {
+            for (unsigned int j = 0; j < 3; ++j)
+            {
+                boxMin[j] = min(boxMin[j], otherMin[j]);
+                boxMax[j] = max(boxMax[j], otherMax[j]);
+            }
+        };
+
+        if (node->count != 0u)
+        {
+            for (uint32_t i = node->first; i < node->first + node->count; ++i)
+            {
+                Point objectMin;
+                Point objectMax;
+                _bounds(_objects[i], objectMin, objectMax);
+                merge(objectMin, objectMax);
+            }
+        }
+        else
+        {
+            // The left child directly follows its parent
+            const Node& leftChild  = *(node - 1);
+            const Node& rightChild = _nodes[node->rightChild];
+            merge(leftChild.boxMin, leftChild.boxMax);
+            merge(rightChild.boxMin, rightChild.boxMax);
+        }
+
+        node->boxMin = boxMin;
+        node->boxMax = boxMax;
+    }
+}
+
+double BVH::cost(void) const
+{
+    if (_nodes.empty())
+        return 0.0;
+
+    const auto area = [](const Node& node) {
+        const Vector size = node.boxMax - node.boxMin;
+        return 2.0 * double{ size.x() * size.y() + size.y() * size.z() + size.z() * size.x() };
+    };
+
+    // A flat root (all the objects in a plane) would give an infinite cost, the sizes are then only compared to each other
+    const double rootArea = area(_nodes.front());
+    if (rootArea <= 0.0)
+        return static_cast<double>(_nodes.size());
+
+    // Probability that a ray through the root goes through a node times the cost of the node (1 for a box test, 1 for each object test)
+    double totalCost = 0.0;
+    for (const auto& node : _nodes)
+        totalCost += area(node) / rootArea * (node.count != 0u ? static_cast<double>(node.count) : 1.0);
+
+    return totalCost;
+}
+
+double BVH::buildCost(void) const noexcept
+{
+    return _buildCost;
+}
+
+void BVH::_build(vector<BoundedObject>& objects)
+{
+    if (objects.empty())
+        return;
+
+    for (auto& object : objects)
+    {
+        _bounds(object.object, object.boxMin, object.boxMax);
+        object.centroid = object.boxMin.offset(object.boxMax - object.boxMin, Real{ 0.5 });
+    }
+
+    _nodes.reserve(2u * objects.size());
+    _buildNode(objects, 0u, static_cast<uint32_t>(objects.size()));
+
+    _objects.reserve(objects.size());
+    for (const auto& object : objects)
+        _objects.push_back(object.object);
+
+    _buildCost = cost();
+}
+
+void BVH::_bounds(const Object& object, Point& boxMin, Point& boxMax)
+{
+    switch (object.type)
+    {
+        case Type::SPHERE:
+        {
+            const auto   sphere = static_cast<Sphere*>(object.renderable);
+            const Vector radius(sphere->radius());
+            boxMin = sphere->center().offset(radius, Real{ -1.0 });
+            boxMax = sphere->center() + radius;
+            break;
+        }
+
+        case Type::TRIANGLE:
+        {
+            const auto& vertices = static_cast<Triangle*>(object.renderable)->vertexPositions();
+            for (unsigned int j = 0; j < 3; ++j)
+            {
+                boxMin[j] = min({ vertices[0][j], vertices[1][j], vertices[2][j] });
+                boxMax[j] = max({ vertices[0][j], vertices[1][j], vertices[2][j] });
+            }
+            break;
+        }
+
+        // A mesh is only hit inside the limits of its bounding box
+        case Type::MESH:
+        {
+            const auto& boundingBox = static_cast<Mesh*>(object.renderable)->boundingBox();
+            boxMin                  = boundingBox.min();
+            boxMax                  = boundingBox.max();
+            break;
+        }
+    }
+}
+
+void BVH::clear(void) noexcept
+{
+    _nodes.clear();
+    _objects.clear();
+    _buildCost = 0.0;
+}
+
+size_t BVH::objectCount(void) const noexcept
+{
+    return _objects.size();
+}
+
+void BVH::intersect(Ray& ray, const Renderable* objectFromRay, Hit& hit) const
+{
+    if (_nodes.empty())
+        return;
+
+    const Point  origin    = ray.origin();
+    const Vector direction = ray.direction();
+
+    // A null coordinate gives an infinite inverse, the slabs of this axis then never cull the ray unless it is outside of them
+    const Vector inverseDirection(Real{ 1.0 } / direction.x(), Real{ 1.0 } / direction.y(), Real{ 1.0 } / direction.z());
+
+    uint32_t stack[_maxDepth];
+    uint32_t stackSize = 0u;
+    uint32_t nodeIndex = 0u;
+
+    while (true)
+    {
+        const Node& node = _nodes[nodeIndex];
+
+        if (_hitsBox(node, origin, inverseDirection, hit.distance))
+        {
+            if (node.count == 0u)
+            {
+                // Visit the child on the side the ray comes from first, the other one is likely to be culled by the hit found in it
+                uint32_t nearChild = nodeIndex + 1u;
+                uint32_t farChild  = node.rightChild;
+                if (direction[node.axis] < Real{ 0.0 })
+                    swap(nearChild, farChild);
+
+                assert(stackSize < _maxDepth && "The bounding volume hierarchy is too deep");
+                stack[stackSize++] = farChild;
+                nodeIndex          = nearChild;
+                continue;
+            }
+
+            for (uint32_t i = node.first; i < node.first + node.count; ++i)
+            {
+                const auto& object = _objects[i];
+
+                // The classes are final, the calls are not virtual
+                bool hasIntersection = false;
+                switch (object.type)
+                {
+                    case Type::SPHERE:
+                        hasIntersection = static_cast<Sphere*>(object.renderable)->intersect(ray);
+                        break;
+
+                    case Type::TRIANGLE:
+                        hasIntersection = static_cast<Triangle*>(object.renderable)->intersect(ray);
+                        break;
+
+                    case Type::MESH:
+                        hasIntersection = static_cast<Mesh*>(object.renderable)->intersect(ray);
+                        break;
+                }
+
+                if (hasIntersection && ray.length() < hit.distance && objectFromRay != ray.intersected())
+                {
+                    hit.distance = ray.length();
+                    hit.object   = ray.intersected();
+                }
+            }
+        }
+
+        if (stackSize == 0u)
+            break;
+
+        nodeIndex = stack[--stackSize];
+    }
+}
+
+uint32_t BVH::_buildNode(vector<BoundedObject>& objects, uint32_t first, uint32_t count)
+{
+    assert(count != 0u && "A node of the bounding volume hierarchy needs at least one object");
+
+    const auto nodeIndex = static_cast<uint32_t>(_nodes.size());
+    _nodes.emplace_back();
+
+    // Bounding box of the objects of the node and of their centroids
+    Point boxMin(numeric_limits<Real>::max());
+    Point boxMax(numeric_limits<Real>::lowest());
+    Point centroidMin(numeric_limits<Real>::max());
+    Point centroidMax(numeric_limits<Real>::lowest());
+
+    for (uint32_t i = first; i < first + count; ++i)
+    {
+        const auto& object = objects[i];
+        for (unsigned int j = 0; j < 3; ++j)
+        {
+            boxMin[j]      = min(boxMin[j], object.boxMin[j]);
+            boxMax[j]      = max(boxMax[j], object.boxMax[j]);
+            centroidMin[j] = min(centroidMin[j], object.centroid[j]);
+            centroidMax[j] = max(centroidMax[j], object.centroid[j]);
+        }
+    }
+
+    _nodes[nodeIndex].boxMin = boxMin;
+    _nodes[nodeIndex].boxMax = boxMax;
+
+    if (count <= _maxObjectsPerLeaf)
+    {
+        _nodes[nodeIndex].first = first;
+        _nodes[nodeIndex].count = count;
+        return nodeIndex;
+    }
+
+    // Split the objects at the median of their centroids along the longest axis, the left child directly follows its parent
+    const auto extent = centroidMax - centroidMin;
+    uint32_t   axis   = 0u;
+    if (extent.y() > extent[axis])
+        axis = 1u;
+    if (extent.z() > extent[axis])
+        axis = 2u;
+
+    const uint32_t leftCount = count / 2u;
+    const auto     begin     = objects.begin() + static_cast<ptrdiff_t>(first);
+
+    const auto byAxis = [axis](const BoundedObject& lhs, const BoundedObject& rhs) { return lhs.centroid[axis] < rhs.centroid[axis]; };
+    nth_element(begin, begin + static_cast<ptrdiff_t>(leftCount), begin + static_cast<ptrdiff_t>(count), byAxis);
+
+    _buildNode(objects, first, leftCount);
+    const uint32_t rightChild = _buildNode(objects, first + leftCount, count - leftCount);
+
+    _nodes[nodeIndex].rightChild = rightChild;
+    _nodes[nodeIndex].axis       = axis;
+
+    return nodeIndex;
+}
+
+bool BVH::_hitsBox(const Node& node, const Point& origin, const Vector& inverseDirection, Real distance) noexcept
+{
+    Statistics::count(Statistics::Counter::BOX_TESTS);
+
+    Real near = Real{ 0.0 };
+    Real far  = distance;
+
+    for (unsigned int axis = 0; axis < 3; ++axis)
+    {
+        const Real t0 = (node.boxMin[axis] - origin[axis]) * inverseDirection[axis];
+        const Real t1 = (node.boxMax[axis] - origin[axis]) * inverseDirection[axis];
+
+        // A NaN (origin on a slab parallel to the ray) fails both comparisons and keeps the node
+        const bool positive = inverseDirection[axis] >= Real{ 0.0 };
+        const Real tNear    = positive ? t0 : t1;
+        const Real tFar     = positive ? t1 : t0;
+
+        if (tNear > near)
+            near = tNear;
+        if (tFar < far)
+            far = tFar;
+    }
+
+    return near <= far;
+}
@@ -0,0 +1,140 @@
+//===============================================================================================//
+/*!
+ *  \file      BVH.hpp
+ *  \author    Loïc Corenthy
+ *  \version   1.2
+ *  \date      19/10/2026
+ *  \copyright (c) 2026 Loïc Corenthy. All rights reserved.
+ */
+//===============================================================================================//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "Point.hpp"
+#include "Real.hpp"
+
+namespace LCNS
+{
+    // Forward declaration
+    class Mesh;
+    class Ray;
+    class Renderable;
+    class Sphere;
+    class Triangle;
+
+    /// Bounding volume hierarchy over the spheres, triangles and meshes of a committed scene. The objects are stored in the order of the leaves
+    /// with their concrete type, a leaf calls their intersect function directly instead of through the virtual table. A ray visits the child
+    /// on the side it comes from first and skips the nodes farther than the closest hit found so far.
+    class BVH
+    {
+    public:
+        /// Closest intersection found for a ray
+        struct Hit
+        {
+            Real        distance = std::numeric_limits<Real>::max();
+            Renderable* object   = nullptr;
+        };
+
+    public:
+        /// Default constructor
+        BVH(void) = default;
+
+        /// Copy constructor
+        BVH(const BVH& bvh) = default;
+
+        /// Copy operator
+        BVH& operator=(const BVH& bvh) = default;
+
+        /// Destructor
+        ~BVH(void) = default;
+
+        /// Build the hierarchy over the objects of a scene
+        void build(const std::vector<Sphere*>& spheres, const std::vector<Triangle*>& triangles, const std::vector<Mesh*>& meshes);
+
+        /// Build the hierarchy again over the same objects, after they moved
+        void rebuild(void);
+
+        /// Update the bounding boxes of the nodes around the objects after they moved, without changing the tree
+        void refit(void);
+
+        /// Get the surface area heuristic cost of the hierarchy: the expected number of nodes visited and of objects tested by a ray going
+        /// through the bounding box of the root (a refitted tree gets more expensive as its objects move away from where it was built)
+        double cost(void) const;
+
+        /// Get the cost of the hierarchy when it was last built
+        double buildCost(void) const noexcept;
+
+        /// Remove all the objects from the hierarchy
+        void clear(void) noexcept;
+
+        /// Get the number of objects in the hierarchy
+        std::size_t objectCount(void) const noexcept;
+
+        /// Intersect a ray with the objects of the hierarchy, the hit is updated if an object is closer than it (the object the ray comes from
+        /// is skipped)
+        void intersect(Ray& ray, const Renderable* objectFromRay, Hit& hit) const;
+
+    private:
+        enum class Type : std::uint8_t
+        {
+            SPHERE,
+            TRIANGLE,
+            MESH
+        };
+
+        struct Object
+        {
+            Renderable* renderable = nullptr;
+            Type        type       = Type::SPHERE;
+        };
+
+        /// Bounds of an object, only used during the build
+        struct BoundedObject
+        {
+            Point  boxMin;
+            Point  boxMax;
+            Point  centroid;
+            Object object;
+        };
+
+        /// The left child of an inner node directly follows it, a leaf has at least one object
+        struct Node
+        {
+            Point         boxMin;
+            Point         boxMax;
+            std::uint32_t first      = 0u;
+            std::uint32_t count      = 0u;
+            std::uint32_t rightChild = 0u;
+            std::uint32_t axis       = 0u;
+        };
+
+    private:
+        /// Build the hierarchy over objects
+        void _build(std::vector<BoundedObject>& objects);
+
+        /// Get the bounding box of an object
+        static void _bounds(const Object& object, Point& boxMin, Point& boxMax);
+
+        /// Recursively build the node covering the objects in [first, first + count[, return its index
+        std::uint32_t _buildNode(std::vector<BoundedObject>& objects, std::uint32_t first, std::uint32_t count);
+
+        /// Check if the segment of a ray between its origin and a distance crosses the bounding box of a node
+        static bool _hitsBox(const Node& node, const Point& origin, const Vector& inverseDirection, Real distance) noexcept;
+
+    private:
+        static constexpr std::uint32_t _maxObjectsPerLeaf = 4u;
+        static constexpr std::uint32_t _maxDepth          = 64u;
+
+    private:
+        std::vector<Node>   _nodes;
+        std::vector<Object> _objects;
+        double              _buildCost = 0.0;
+
+    };  // class BVH
+
+}  // namespace LCNS
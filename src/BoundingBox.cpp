@@ -10,6 +10,7 @@
 
 #include "BoundingBox.hpp"
 #include "Point.hpp"
+#include "Statistics.hpp"
 
 #include <limits>
 
@@ -17,10 +18,12 @@ using std::numeric_limits;
 
 using LCNS::BoundingBox;
 using LCNS::Point;
+using LCNS::Real;
+using LCNS::Statistics;
 
 BoundingBox::BoundingBox(void)
-: _min{ numeric_limits<double>::max(), numeric_limits<double>::max(), numeric_limits<double>::max() }
-, _max{ -numeric_limits<double>::max(), -numeric_limits<double>::max(), -numeric_limits<double>::max() }
+: _min{ numeric_limits<Real>::max(), numeric_limits<Real>::max(), numeric_limits<Real>::max() }
+, _max{ -numeric_limits<Real>::max(), -numeric_limits<Real>::max(), -numeric_limits<Real>::max() }
 {
 }
 
@@ -53,16 +56,18 @@ BoundingBox::~BoundingBox(void)
 
 bool BoundingBox::intersect(const Ray& ray) const
 {
+    Statistics::count(Statistics::Counter::BOX_TESTS);
+
     bool intersectFace[7] = { false, false, false, false, false, false, false };
 
     // Check if ray is not parallel to the XY plane
-    if (ray.direction().z() != 0.0)
+    if (ray.direction().z() != Real{ 0.0 })
     {
         // Front plane: Calculate the length the ray when intersecting the plane
-        double length = (_max.z() - ray.origin().z()) / ray.direction().z();
+        Real length = (_max.z() - ray.origin().z()) / ray.direction().z();
 
         // Front plane: Calculate the coordinates of the intersection point
-        Point p = ray.origin() + ray.direction() * length;
+        Point p = ray.origin().offset(ray.direction(), length);
 
         // Front plane: Check if the point in the plane is really inside the rectangle
         if (p.x() >= _min.x() && p.x() <= _max.x() && p.y() >= _min.y() && p.y() <= _max.y())
@@ -70,39 +75,39 @@ bool BoundingBox::intersect(const Ray& ray) const
 
         // Same for back plane:
         length = (_min.z() - ray.origin().z()) / ray.direction().z();
-        p      = ray.origin() + ray.direction() * length;
+        p      = ray.origin().offset(ray.direction(), length);
         if (p.x() >= _min.x() && p.x() <= _max.x() && p.y() >= _min.y() && p.y() <= _max.y())
             intersectFace[1] = true;
     }
 
     // Check if the ray is not parallel to the XZ plane
-    if (ray.direction().y() != 0.0)
+    if (ray.direction().y() != Real{ 0.0 })
     {
         // Same for up plane:
-        double length = (_max.y() - ray.origin().y()) / ray.direction().y();
-        Point  p      = ray.origin() + ray.direction() * length;
+        Real  length = (_max.y() - ray.origin().y()) / ray.direction().y();
+        Point p      = ray.origin().offset(ray.direction(), length);
         if (p.x() >= _min.x() && p.x() <= _max.x() && p.z() >= _min.z() && p.z() <= _max.z())
             intersectFace[2] = true;
 
         // Same for down plane:
         length = (_min.y() - ray.origin().y()) / ray.direction().y();
-        p      = ray.origin() + ray.direction() * length;
+        p      = ray.origin().offset(ray.direction(), length);
         if (p.x() >= _min.x() && p.x() <= _max.x() && p.z() >= _min.z() && p.z() <= _max.z())
             intersectFace[3] = true;
     }
 
     // Check if the ray is not parallel to the YZ plane
-    if (ray.direction().x() != 0.0)
+    if (ray.direction().x() != Real{ 0.0 })
     {
         // Same for right plane:
-        double length = (_max.x() - ray.origin().x()) / ray.direction().x();
-        Point  p      = ray.origin() + ray.direction() * length;
+        Real  length = (_max.x() - ray.origin().x()) / ray.direction().x();
+        Point p      = ray.origin().offset(ray.direction(), length);
         if (p.y() >= _min.y() && p.y() <= _max.y() && p.z() >= _min.z() && p.z() <= _max.z())
             intersectFace[4] = true;
 
         // Same for left plane:
         length = (_min.x() - ray.origin().x()) / ray.direction().x();
-        p      = ray.origin() + ray.direction() * length;
+        p      = ray.origin().offset(ray.direction(), length);
         if (p.y() >= _min.y() && p.y() <= _max.y() && p.z() >= _min.z() && p.z() <= _max.z())
             intersectFace[5] = true;
     }
@@ -11,15 +11,27 @@
 #include "Buffer.hpp"
 #include "Color.hpp"
 
+#include <algorithm>
 #include <cassert>
 #include <iostream>
 #include <memory>
+#include <string>
 
+#include <OpenImageIO/imageio.h>
+#include <OpenImageIO/typedesc.h>
+
+using std::copy_n;
 using std::make_unique;
+using std::string;
 using std::unique_ptr;
 
 using LCNS::Buffer;
 using LCNS::Color;
+using LCNS::Tile;
+
+using OIIO::ImageOutput;
+using OIIO::ImageSpec;
+using OIIO::TypeDesc;
 
 Buffer::Buffer(unsigned int height, unsigned int width)
 : _height(height)
@@ -129,6 +141,30 @@ const unique_ptr<unsigned char[]>& Buffer::allPixels(void) const
     return _pixels;
 }
 
+void Buffer::readTile(const Tile& tile, unsigned char* pixels) const
+{
+    assert(tile.x + tile.width <= _width && tile.y + tile.height <= _height && "The tile is outside of the buffer");
+
+    for (unsigned int j = 0; j < tile.height; ++j)
+        copy_n(_pixels.get() + 3u * (_width * (tile.y + j) + tile.x), 3u * tile.width, pixels + 3u * tile.width * j);
+}
+
+void Buffer::writeTile(const Tile& tile, const unsigned char* pixels)
+{
+    assert(tile.x + tile.width <= _width && tile.y + tile.height <= _height && "The tile is outside of the buffer");
+
+    for (unsigned int j = 0; j < tile.height; ++j)
+        copy_n(pixels + 3u * tile.width * j, 3u * tile.width, _pixels.get() + 3u * (_width * (tile.y + j) + tile.x));
+}
+
+Buffer Buffer::crop(const Tile& tile) const
+{
+    Buffer cropped(tile.height, tile.width);
+    readTile(tile, cropped._pixels.get());
+
+    return cropped;
+}
+
 void Buffer::reset(void)
 {
     if (_width == 0 || _height == 0)
@@ -139,3 +175,21 @@ void Buffer::reset(void)
     for (unsigned int i = 0, end = 3 * _height * _width; i < end; ++i)
         _pixels[i] = 0;
 }
+
+bool Buffer::write(const string& path) const
+{
+    if (!_pixels)
+        return false;
+
+    auto image = ImageOutput::create(path);
+    if (!image)
+        return false;
+
+    // The first row of the buffer is the bottom of the image, the rows are written from the last one with a negative stride
+    const auto      rowSize = static_cast<OIIO::stride_t>(3u * _width);
+    const ImageSpec spec(static_cast<int>(_width), static_cast<int>(_height), 3, TypeDesc::UINT8);
+
+    return image->open(path, spec)
+           && image->write_image(TypeDesc::UINT8, _pixels.get() + 3u * _width * (_height - 1u), OIIO::AutoStride, -rowSize)
+           && image->close();
+}
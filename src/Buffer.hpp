@@ -11,8 +11,10 @@
 #pragma once
 
 #include <memory>
+#include <string>
 
 #include "Color.hpp"
+#include "Tile.hpp"
 
 namespace LCNS
 {
@@ -52,9 +54,21 @@ namespace LCNS
         /// Get the width of the buffer
         unsigned int width(void) const noexcept;
 
+        /// Copy the pixels of a tile, row by row from its first row, in an array of 3 bytes per pixel
+        void readTile(const Tile& tile, unsigned char* pixels) const;
+
+        /// Overwrite the pixels of a tile with an array of 3 bytes per pixel, row by row from its first row
+        void writeTile(const Tile& tile, const unsigned char* pixels);
+
+        /// Get a buffer with only the pixels of a tile
+        Buffer crop(const Tile& tile) const;
+
         /// Set all the pixels values to 0
         void reset(void);
 
+        /// Write the pixels in an image file (its format is deduced from its extension), return false if it can not be written
+        bool write(const std::string& path) const;
+
     private:
         std::unique_ptr<unsigned char[]> _pixels;
         unsigned int                     _height = 0u;
@@ -17,14 +17,18 @@
 #include <cmath>
 #include <limits>
 
+using std::cos;
 using std::mt19937;
 using std::numeric_limits;
 using std::random_device;
+using std::sin;
 using std::uniform_real_distribution;
 
 using LCNS::Camera;
 using LCNS::Plane;
 using LCNS::Point;
+using LCNS::Real;
+using LCNS::toReal;
 using LCNS::Vector;
 
 Camera::Camera(const Point& position, const Vector& direction, const Vector& up, double fOV)
@@ -78,7 +82,7 @@ Vector Camera::pixelDirection(double x, double y, const Buffer& buffer) const
     const auto rightValue = (2.0 * tan(_fOV / 2.0) / (buffer.width())) * (buffer.width() / 2.0 - x);
     const auto upValue    = (2.0 * tan(_fOV / 2.0) / (buffer.width())) * (y - buffer.height() / 2.0);
 
-    return _right * rightValue + _up * upValue + _direction;
+    return _right * toReal(rightValue) + _up * toReal(upValue) + _direction;
 }
 
 void Camera::direction(const Vector& direction)
@@ -89,7 +93,7 @@ void Camera::direction(const Vector& direction)
     _up    = _direction ^ _right;
 
     _focalPlane.normal(direction * (-1.0));
-    _focalPlane.position(_position + direction * _focalLength);
+    _focalPlane.position(_position + direction * toReal(_focalLength));
 }
 
 void Camera::up(const Vector& up)
@@ -135,15 +139,15 @@ void Camera::aperture(Aperture mode, Precision precision, double focalLength)
     switch (mode)
     {
         case Aperture::F_SMALL:
-            _apertureRadius = (_position - _focalPlane.position()).length() / 64.0;
+            _apertureRadius = double{ (_position - _focalPlane.position()).length() } / 64.0;
             break;
 
         case Aperture::F_MEDIUM:
-            _apertureRadius = (_position - _focalPlane.position()).length() / 128.0;
+            _apertureRadius = double{ (_position - _focalPlane.position()).length() } / 128.0;
             break;
 
         case Aperture::F_BIG:
-            _apertureRadius = (_position - _focalPlane.position()).length() / 256.0;
+            _apertureRadius = double{ (_position - _focalPlane.position()).length() } / 256.0;
             break;
 
         case Aperture::ALL_SHARP:
@@ -175,6 +179,39 @@ void Camera::focalPoint(const Point& focalPoint)
     _focalPlane.position(focalPoint);
 }
 
+void Camera::translate(const Vector& offset)
+{
+    _position = _position + offset;
+    _focalPlane.position(_focalPlane.position() + offset);
+}
+
+void Camera::turn(double left, double upward)
+{
+    // Rotation of a vector around an axis (Rodrigues' formula), the lengths of the vectors of the camera and the angles between them are
+    // kept so the framing does not change
+    const auto rotate = [](const Vector& vector, Vector axis, double angle) {
+        axis.normalize();
+        const Real cosAngle = toReal(cos(angle));
+        const Real sinAngle = toReal(sin(angle));
+        return vector * cosAngle + (axis ^ vector) * sinAngle + axis * ((axis * vector) * (Real{ 1.0 } - cosAngle));
+    };
+
+    Vector focalOffset = _focalPlane.position() - _position;
+
+    // The upward direction is the axis of the first rotation, it does not change
+    const Vector leftAxis = _up;
+    for (auto vector : { &_direction, &_right, &focalOffset })
+        *vector = rotate(*vector, leftAxis, left);
+
+    // _right points to the left of the image, the opposite axis turns the direction toward the upward direction
+    const Vector upwardAxis = _right * Real{ -1.0 };
+    for (auto vector : { &_direction, &_up, &focalOffset })
+        *vector = rotate(*vector, upwardAxis, upward);
+
+    _focalPlane.normal(_direction * Real{ -1.0 });
+    _focalPlane.position(_position + focalOffset);
+}
+
 const Point& Camera::position(void) const noexcept
 {
     return _position;
@@ -81,6 +81,13 @@ namespace LCNS
         /// Set the point contained by the focal plane
         void focalPoint(const Point& focalPoint);
 
+        /// Move the camera and its focal plane by an offset
+        void translate(const Vector& offset);
+
+        /// Turn the camera and its focal plane around its position, by an angle (in radians) to the left around its upward direction then by
+        /// an angle upward around its horizontal direction
+        void turn(double left, double upward);
+
         /// Get the position of the camera (read only)
         const Point& position(void) const noexcept;
 
@@ -0,0 +1,220 @@
+//===============================================================================================//
+/*!
+ *  \file      Checkpoint.cpp
+ *  \author    Loïc Corenthy
+ *  \version   1.2
+ *  \date      19/10/2026
+ *  \copyright (c) 2026 Loïc Corenthy. All rights reserved.
+ */
+//===============================================================================================//
+
+#include "Checkpoint.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include "Buffer.hpp"
+
+using std::error_code;
+using std::ifstream;
+using std::ofstream;
+using std::runtime_error;
+using std::size_t;
+using std::streamsize;
+using std::string;
+using std::uint32_t;
+using std::filesystem::rename;
+
+using LCNS::Buffer;
+using LCNS::Checkpoint;
+using LCNS::Tile;
+
+namespace
+{
+    /// Longest description of a frame in a checkpoint
+    constexpr uint32_t maxFrameLength = 4096u;
+
+    /// Write an integer in little endian
+    void writeValue(ofstream& file, uint32_t value)
+    {
+        const char bytes[4] = { static_cast<char>(value & 0xffu),
+                                static_cast<char>((value >> 8u) & 0xffu),
+                                static_cast<char>((value >> 16u) & 0xffu),
+                                static_cast<char>((value >> 24u) & 0xffu) };
+        file.write(bytes, 4);
+    }
+
+    /// Read an integer written in little endian
+    uint32_t readValue(ifstream& file)
+    {
+        unsigned char bytes[4] = { 0u, 0u, 0u, 0u };
+        file.read(reinterpret_cast<char*>(bytes), 4);
+
+        return static_cast<uint32_t>(bytes[0]) | (static_cast<uint32_t>(bytes[1]) << 8u) | (static_cast<uint32_t>(bytes[2]) << 16u)
+               | (static_cast<uint32_t>(bytes[3]) << 24u);
+    }
+}  // namespace
+
+Checkpoint::Checkpoint(const string& path, const string& frame, unsigned int width, unsigned int height)
+: _path(path)
+, _frame(frame)
+, _width(width)
+, _height(height)
+, _rendered(static_cast<size_t>(width) * height, false)
+{
+    if (_frame.size() > maxFrameLength)
+    {
+        throw runtime_error("The description of the frame is too long");
+    }
+}
+
+bool Checkpoint::read(Buffer& buffer)
+{
+    ifstream file(_path, ifstream::binary);
+    if (!file)
+        return false;
+
+    if (readValue(file) != _magicNumber || readValue(file) != _version)
+        throw runtime_error(_path + " is not a checkpoint of this version");
+
+    const auto width       = readValue(file);
+    const auto height      = readValue(file);
+    const auto frameLength = readValue(file);
+    if (!file || frameLength > maxFrameLength)
+        throw runtime_error(_path + " is not a valid checkpoint");
+
+    string frame(frameLength, '\0');
+    file.read(frame.data(), static_cast<streamsize>(frameLength));
+
+    if (!file || frame != _frame || width != _width || height != _height)
+        throw runtime_error(_path + " is the checkpoint of another frame (" + frame + ")");
+
+    _tiles.clear();
+    _pixels.clear();
+    _rendered.assign(_rendered.size(), false);
+
+    const auto tileCount = readValue(file);
+    for (uint32_t i = 0u; i < tileCount && file; ++i)
+    {
+        Tile tile;
+        tile.x      = readValue(file);
+        tile.y      = readValue(file);
+        tile.width  = readValue(file);
+        tile.height = readValue(file);
+
+        if (!file || tile.x + tile.width > _width || tile.y + tile.height > _height)
+            throw runtime_error(_path + " is not a valid checkpoint");
+
+        const auto offset = _pixels.size();
+        _pixels.resize(offset + 3u * static_cast<size_t>(tile.pixelCount()));
+        file.read(reinterpret_cast<char*>(_pixels.data() + offset), static_cast<streamsize>(3u * static_cast<size_t>(tile.pixelCount())));
+
+        if (!file)
+            throw runtime_error(_path + " is truncated");
+
+        buffer.writeTile(tile, _pixels.data() + offset);
+        _tiles.push_back(tile);
+        _markRendered(tile);
+    }
+
+    if (!file)
+        throw runtime_error(_path + " is truncated");
+
+    return true;
+}
+
+bool Checkpoint::write(void) const
+{
+    const string temporaryPath = _path + ".tmp";
+
+    ofstream file(temporaryPath, ofstream::binary | ofstream::trunc);
+    if (!file)
+        return false;
+
+    writeValue(file, _magicNumber);
+    writeValue(file, _version);
+    writeValue(file, _width);
+    writeValue(file, _height);
+    writeValue(file, static_cast<uint32_t>(_frame.size()));
+    file.write(_frame.data(), static_cast<streamsize>(_frame.size()));
+
+    writeValue(file, static_cast<uint32_t>(_tiles.size()));
+
+    size_t offset = 0u;
+    for (const auto& tile : _tiles)
+    {
+        const auto size = 3u * static_cast<size_t>(tile.pixelCount());
+
+        writeValue(file, tile.x);
+        writeValue(file, tile.y);
+        writeValue(file, tile.width);
+        writeValue(file, tile.height);
+        file.write(reinterpret_cast<const char*>(_pixels.data() + offset), static_cast<streamsize>(size));
+
+        offset += size;
+    }
+
+    file.close();
+    if (!file)
+        return false;
+
+    // Renaming the file replaces the previous checkpoint at once
+    error_code error;
+    rename(temporaryPath, _path, error);
+
+    return !error;
+}
+
+void Checkpoint::add(const Buffer& buffer, const Tile& tile)
+{
+    if (tile.pixelCount() == 0u)
+        return;
+
+    const auto offset = _pixels.size();
+    _pixels.resize(offset + 3u * static_cast<size_t>(tile.pixelCount()));
+    buffer.readTile(tile, _pixels.data() + offset);
+
+    _tiles.push_back(tile);
+    _markRendered(tile);
+}
+
+bool Checkpoint::isRendered(const Tile& tile) const
+{
+    return renderedCount(tile) == tile.pixelCount();
+}
+
+unsigned int Checkpoint::renderedCount(const Tile& tile) const
+{
+    unsigned int count = 0u;
+
+    for (unsigned int j = tile.y; j < tile.y + tile.height; ++j)
+    {
+        for (unsigned int i = tile.x; i < tile.x + tile.width; ++i)
+        {
+            if (!_rendered[static_cast<size_t>(j) * _width + i])
+                return count;
+
+            ++count;
+        }
+    }
+
+    return count;
+}
+
+const string& Checkpoint::path(void) const noexcept
+{
+    return _path;
+}
+
+void Checkpoint::_markRendered(const Tile& tile)
+{
+    for (unsigned int j = tile.y; j < tile.y + tile.height; ++j)
+    {
+        for (unsigned int i = tile.x; i < tile.x + tile.width; ++i)
+            _rendered[static_cast<size_t>(j) * _width + i] = true;
+    }
+}
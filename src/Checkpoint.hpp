@@ -0,0 +1,83 @@
+//===============================================================================================//
+/*!
+ *  \file      Checkpoint.hpp
+ *  \author    Loïc Corenthy
+ *  \version   1.2
+ *  \date      19/10/2026
+ *  \copyright (c) 2026 Loïc Corenthy. All rights reserved.
+ */
+//===============================================================================================//
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Tile.hpp"
+
+namespace LCNS
+{
+    // Forward declaration
+    class Buffer;
+
+    /// Pixels of a frame rendered so far, saved in a file to resume a render that was stopped. The file holds the description of the frame
+    /// (a render is only resumed from the checkpoint of the same frame), then the tiles already rendered, each one followed by its pixels (3
+    /// bytes per pixel, row by row). The integers are written in little endian. A pixel is only saved once, the rendered pixels are final.
+    class Checkpoint
+    {
+    public:
+        /// Constructor with the path of the file, the description of the frame and the dimensions of the image
+        Checkpoint(const std::string& path, const std::string& frame, unsigned int width, unsigned int height);
+
+        /// Copy constructor (copy not allowed)
+        Checkpoint(const Checkpoint& checkpoint) = delete;
+
+        /// Copy operator (copy not allowed)
+        Checkpoint& operator=(const Checkpoint& checkpoint) = delete;
+
+        /// Destructor
+        ~Checkpoint(void) = default;
+
+        /// Read the file and copy the pixels it holds in the buffer, return false if there is no file. Throws a runtime error if the file is
+        /// not a checkpoint of the same frame.
+        bool read(Buffer& buffer);
+
+        /// Write the file, it is replaced at once so that a render stopped while writing it leaves the previous checkpoint
+        bool write(void) const;
+
+        /// Add the pixels of a tile rendered in the buffer
+        void add(const Buffer& buffer, const Tile& tile);
+
+        /// Check if all the pixels of a tile have been rendered
+        bool isRendered(const Tile& tile) const;
+
+        /// Get the number of pixels at the start of a tile (numbered row by row) that have all been rendered
+        unsigned int renderedCount(const Tile& tile) const;
+
+        /// Get the path of the file
+        const std::string& path(void) const noexcept;
+
+    private:
+        /// Mark the pixels of a tile as rendered
+        void _markRendered(const Tile& tile);
+
+    private:
+        /// First value of the file
+        static constexpr std::uint32_t _magicNumber = 0x52544350u;
+
+        /// Version of the file format
+        static constexpr std::uint32_t _version = 1u;
+
+    private:
+        std::string                _path;
+        std::string                _frame;
+        unsigned int               _width;
+        unsigned int               _height;
+        std::vector<Tile>          _tiles;
+        std::vector<unsigned char> _pixels;    ///< Pixels of the tiles one after the other
+        std::vector<bool>          _rendered;  ///< Pixels of the image already rendered, row by row
+
+    };  // class Checkpoint
+
+}  // namespace LCNS
@@ -0,0 +1,186 @@
+//===============================================================================================//
+/*!
+ *  \file      CostBuffer.cpp
+ *  \author    Loïc Corenthy
+ *  \version   1.2
+ *  \date      19/10/2026
+ *  \copyright (c) 2026 Loïc Corenthy. All rights reserved.
+ */
+//===============================================================================================//
+
+#include "CostBuffer.hpp"
+#include "Statistics.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <chrono>
+#include <fstream>
+#include <stdexcept>
+
+#include <OpenImageIO/imageio.h>
+#include <OpenImageIO/typedesc.h>
+
+using std::array;
+using std::max;
+using std::max_element;
+using std::min;
+using std::ofstream;
+using std::runtime_error;
+using std::size_t;
+using std::streamsize;
+using std::string;
+using std::uint64_t;
+using std::vector;
+using std::chrono::duration_cast;
+using std::chrono::nanoseconds;
+using std::chrono::steady_clock;
+
+using LCNS::CostBuffer;
+using LCNS::Statistics;
+
+using OIIO::ImageOutput;
+using OIIO::ImageSpec;
+using OIIO::TypeDesc;
+
+namespace
+{
+    /// Colors of the false color scale, from the cheapest to the most expensive pixels
+    constexpr array<array<float, 3>, 5> scale
+    = { { { 0.0f, 0.0f, 1.0f }, { 0.0f, 1.0f, 1.0f }, { 0.0f, 1.0f, 0.0f }, { 1.0f, 1.0f, 0.0f }, { 1.0f, 0.0f, 0.0f } } };
+
+}  // namespace
+
+CostBuffer::Metric CostBuffer::metric(void) const noexcept
+{
+    return _metric;
+}
+
+void CostBuffer::metric(Metric metric)
+{
+    if ((metric == Metric::RAYS || metric == Metric::INTERSECTION_TESTS) && !Statistics::enabled)
+    {
+        throw runtime_error("The rays and the intersection tests are only counted when the statistics are enabled (ENABLE_STATISTICS)");
+    }
+
+    _metric = metric;
+}
+
+bool CostBuffer::isActive(void) const noexcept
+{
+    return _metric != Metric::NONE;
+}
+
+uint64_t CostBuffer::measure(void) const noexcept
+{
+    using Counter = Statistics::Counter;
+
+    switch (_metric)
+    {
+        case Metric::TIME:
+            return static_cast<uint64_t>(duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count());
+
+        case Metric::RAYS:
+            return Statistics::threadCount(Counter::SCENE_RAYS);
+
+        case Metric::INTERSECTION_TESTS:
+            return Statistics::threadCount(Counter::BOX_TESTS) + Statistics::threadCount(Counter::TRIANGLE_TESTS)
+                   + Statistics::threadCount(Counter::SPHERE_TESTS);
+
+        case Metric::NONE:
+            break;
+    }
+
+    return 0u;
+}
+
+void CostBuffer::cost(unsigned int i, unsigned int j, uint64_t value) noexcept
+{
+    if (_metric == Metric::NONE || _width <= i || _height <= j)
+        return;
+
+    _costs[_width * j + i] = static_cast<float>(value);
+}
+
+float CostBuffer::cost(unsigned int i, unsigned int j) const noexcept
+{
+    assert(i < _width && j < _height);
+    return _costs[_width * j + i];
+}
+
+float CostBuffer::maximum(void) const noexcept
+{
+    if (_costs.empty())
+        return 0.0f;
+
+    return *max_element(_costs.begin(), _costs.end());
+}
+
+void CostBuffer::dimensions(unsigned int width, unsigned int height)
+{
+    _width  = width;
+    _height = height;
+
+    reset();
+}
+
+unsigned int CostBuffer::height(void) const noexcept
+{
+    return _height;
+}
+
+unsigned int CostBuffer::width(void) const noexcept
+{
+    return _width;
+}
+
+void CostBuffer::reset(void)
+{
+    _costs.assign(static_cast<size_t>(_width) * _height, 0.0f);
+}
+
+bool CostBuffer::writeImage(const string& path) const
+{
+    auto image = ImageOutput::create(path);
+    if (!image)
+        return false;
+
+    const float maximumCost = maximum();
+
+    // The first row of the buffer is the bottom of the image
+    vector<unsigned char> pixels;
+    pixels.reserve(3u * _costs.size());
+
+    for (unsigned int j = _height; j-- > 0u;)
+    {
+        for (unsigned int i = 0; i < _width; ++i)
+        {
+            // Linear interpolation between the two colors of the scale around the normalized cost
+            const float  position = maximumCost > 0.0f ? cost(i, j) / maximumCost * static_cast<float>(scale.size() - 1u) : 0.0f;
+            const size_t lower    = min(static_cast<size_t>(position), scale.size() - 2u);
+            const float  weight   = position - static_cast<float>(lower);
+
+            for (size_t c = 0; c < 3u; ++c)
+            {
+                const float value = scale[lower][c] * (1.0f - weight) + scale[lower + 1u][c] * weight;
+                pixels.push_back(static_cast<unsigned char>(max(0.0f, min(value, 1.0f)) * 255.0f));
+            }
+        }
+    }
+
+    const ImageSpec spec(static_cast<int>(_width), static_cast<int>(_height), 3, TypeDesc::UINT8);
+
+    return image->open(path, spec) && image->write_image(TypeDesc::UINT8, pixels.data()) && image->close();
+}
+
+bool CostBuffer::writeRaw(const string& path) const
+{
+    ofstream file(path, ofstream::binary);
+    if (!file)
+        return false;
+
+    for (unsigned int j = _height; j-- > 0u;)
+        file.write(reinterpret_cast<const char*>(_costs.data() + static_cast<size_t>(_width) * j), static_cast<streamsize>(_width * sizeof(float)));
+
+    return static_cast<bool>(file);
+}
@@ -0,0 +1,86 @@
+//===============================================================================================//
+/*!
+ *  \file      CostBuffer.hpp
+ *  \author    Loïc Corenthy
+ *  \version   1.2
+ *  \date      19/10/2026
+ *  \copyright (c) 2026 Loïc Corenthy. All rights reserved.
+ */
+//===============================================================================================//
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace LCNS
+{
+    /// Diagnostic buffer with the same dimensions as the Buffer of the Renderer, it holds the cost of rendering each pixel (the time it took, or
+    /// the number of rays or of intersection tests it needed). It shows which parts of a scene use most of the render time.
+    class CostBuffer
+    {
+    public:
+        /// What the cost of a pixel measures
+        enum class Metric
+        {
+            NONE,               // nothing is recorded
+            TIME,               // time spent on the pixel in nanoseconds
+            RAYS,               // rays intersected with the scene (primary, secondary and shadow rays), only counted if the statistics are enabled
+            INTERSECTION_TESTS  // bounding box, triangle and sphere tests, only counted if the statistics are enabled (ENABLE_STATISTICS)
+        };
+
+    public:
+        /// Default constructor
+        CostBuffer(void) = default;
+
+        /// Get what the cost of a pixel measures
+        Metric metric(void) const noexcept;
+
+        /// Set what the cost of a pixel measures
+        void metric(Metric metric);
+
+        /// Check if the costs of the pixels are recorded
+        bool isActive(void) const noexcept;
+
+        /// Get the quantity measured on the calling thread, the cost of a pixel is the difference between the values measured after and
+        /// before rendering it (always 0 if nothing is recorded)
+        std::uint64_t measure(void) const noexcept;
+
+        /// Set the cost of one pixel (nothing is recorded if the metric is NONE)
+        void cost(unsigned int i, unsigned int j, std::uint64_t value) noexcept;
+
+        /// Get the cost of one pixel
+        float cost(unsigned int i, unsigned int j) const noexcept;
+
+        /// Get the highest cost of all the pixels
+        float maximum(void) const noexcept;
+
+        /// Set the buffer's width and height, all the costs are set to 0
+        void dimensions(unsigned int width, unsigned int height);
+
+        /// Get the height of the buffer
+        unsigned int height(void) const noexcept;
+
+        /// Get the width of the buffer
+        unsigned int width(void) const noexcept;
+
+        /// Set all the costs to 0
+        void reset(void);
+
+        /// Write the costs as a false color image (blue for the cheapest pixels, red for the most expensive one), the format is deduced from
+        /// the extension of the path
+        bool writeImage(const std::string& path) const;
+
+        /// Write the costs as raw 32 bits floats, row by row from the top of the image
+        bool writeRaw(const std::string& path) const;
+
+    private:
+        std::vector<float> _costs;
+        unsigned int       _height = 0u;
+        unsigned int       _width  = 0u;
+        Metric             _metric = Metric::NONE;
+
+    };  // class CostBuffer
+
+}  // namespace LCNS
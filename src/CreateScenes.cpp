@@ -14,7 +14,6 @@
 #include <algorithm>
 #include <memory>
 
-using std::make_shared;
 using std::make_unique;
 using std::max;
 using std::shared_ptr;
@@ -27,15 +26,15 @@ using namespace LCNS;
 void createTestScene(shared_ptr<Scene> scene)
 {
     Point                  centerSphere1(0.0, 0.0, 0.0);
-    shared_ptr<Renderable> rSphere1 = make_shared<Sphere>(centerSphere1, 2.3);
+    shared_ptr<Renderable> rSphere1 = scene->create<Sphere>(centerSphere1, 2.3);
 
     // Create a BRDF model for the sphere
     Color            diffusionSphere1(1.0, 0.0, 0.0);
     Color            specularSphere1(0.7, 0.3, 0.3);
-    shared_ptr<BRDF> rBRDFSphere1 = make_shared<Phong>(diffusionSphere1, specularSphere1, 5);
+    shared_ptr<BRDF> rBRDFSphere1 = scene->create<Phong>(diffusionSphere1, specularSphere1, 5);
 
     // Create a shader for the sphere
-    auto rShaderSphere1 = make_shared<Shader>(rBRDFSphere1, 1.0, 1.0, scene, Shader::NONE);
+    auto rShaderSphere1 = scene->create<Shader>(rBRDFSphere1, 1.0, 1.0, scene, Shader::NONE);
     rShaderSphere1->setReflectionCountMax(2);
     rSphere1->shader(rShaderSphere1);
 
@@ -47,7 +46,7 @@ void createTestScene(shared_ptr<Scene> scene)
     ////////////
     // LIGHTS //
     ////////////
-    shared_ptr<Light> rLight1 = make_shared<DirectionalLight>(Vector(0.0, 0.0, -1.0), Color(22.0));
+    shared_ptr<Light> rLight1 = scene->create<DirectionalLight>(Vector(0.0, 0.0, -1.0), Color(22.0));
     scene->add(rLight1);
 
 
@@ -79,15 +78,15 @@ void createScene01(shared_ptr<Scene> scene)
     // RED SPHERE //
     ////////////////
     Point                  centerSphere1(0.0, 2.0, 2.1);
-    shared_ptr<Renderable> rSphere1 = make_shared<Sphere>(centerSphere1, 0.3);
+    shared_ptr<Renderable> rSphere1 = scene->create<Sphere>(centerSphere1, 0.3);
 
     // Create a BRDF model for the sphere
     Color            diffusionSphere1(1.0, 0.0, 0.0);
     Color            specularSphere1(0.7, 0.3, 0.3);
-    shared_ptr<BRDF> rBRDFSphere1 = make_shared<Phong>(diffusionSphere1, specularSphere1, 5);
+    shared_ptr<BRDF> rBRDFSphere1 = scene->create<Phong>(diffusionSphere1, specularSphere1, 5);
 
     // Create a shader for the sphere
-    auto rShaderSphere1 = make_shared<Shader>(rBRDFSphere1, reflectionCoeff, refractionCoeff, scene, Shader::MARBLE);
+    auto rShaderSphere1 = scene->create<Shader>(rBRDFSphere1, reflectionCoeff, refractionCoeff, scene, Shader::MARBLE);
     rShaderSphere1->setReflectionCountMax(2);
     rSphere1->shader(rShaderSphere1);
 
@@ -99,15 +98,15 @@ void createScene01(shared_ptr<Scene> scene)
     // GREEN SPHERE //
     //////////////////
     Point                  centerSphere2(2.0, 0.5, 0.0);
-    shared_ptr<Renderable> rSphere2 = make_shared<Sphere>(centerSphere2, 1.5);
+    shared_ptr<Renderable> rSphere2 = scene->create<Sphere>(centerSphere2, 1.5);
 
     // Create a BRDF model for the sphere
     Color            diffusionSphere2(0.0, 1.0, 0.0);
     Color            specularSphere2(1.0);
-    shared_ptr<BRDF> rBRDFSphere2 = make_shared<Phong>(diffusionSphere2, specularSphere2, 15);
+    shared_ptr<BRDF> rBRDFSphere2 = scene->create<Phong>(diffusionSphere2, specularSphere2, 15);
 
     // Create a shader for the second sphere
-    auto rShaderSphere2 = make_shared<Shader>(rBRDFSphere2, reflectionCoeff, refractionCoeff, scene, Shader::MARBLE);
+    auto rShaderSphere2 = scene->create<Shader>(rBRDFSphere2, reflectionCoeff, refractionCoeff, scene, Shader::MARBLE);
     rShaderSphere2->setReflectionCountMax(2);
     rSphere2->shader(rShaderSphere2);
 
@@ -119,15 +118,15 @@ void createScene01(shared_ptr<Scene> scene)
     // BLUE SPHERE //
     /////////////////
     Point                  centerSphere3(-1.8, 0.0, 0.0);
-    shared_ptr<Renderable> rSphere3 = make_shared<Sphere>(centerSphere3, 1.0);
+    shared_ptr<Renderable> rSphere3 = scene->create<Sphere>(centerSphere3, 1.0);
 
     // Create a BRDF model for the sphere
     Color            diffusionSphere3(0.0, 0.0, 1.0);
     Color            specularSphere3(0.8, 0.8, 1.0);
-    shared_ptr<BRDF> rBRDFSphere3 = make_shared<Phong>(diffusionSphere3, specularSphere3, 25);
+    shared_ptr<BRDF> rBRDFSphere3 = scene->create<Phong>(diffusionSphere3, specularSphere3, 25);
 
     // Create a shader for the third sphere
-    auto rShaderSphere3 = make_shared<Shader>(rBRDFSphere3, reflectionCoeff, refractionCoeff, scene, Shader::MARBLE);
+    auto rShaderSphere3 = scene->create<Shader>(rBRDFSphere3, reflectionCoeff, refractionCoeff, scene, Shader::MARBLE);
     rShaderSphere3->setReflectionCountMax(2);
     rSphere3->shader(rShaderSphere3);
 
@@ -140,7 +139,7 @@ void createScene01(shared_ptr<Scene> scene)
     ////////////
     Point             light1Position(0., 0.0, 5.0);
     Color             light1Color(9.0);
-    shared_ptr<Light> rLight1 = make_shared<PunctualLight>(light1Position, light1Color);
+    shared_ptr<Light> rLight1 = scene->create<PunctualLight>(light1Position, light1Color);
     scene->add(rLight1);
 
     ////////////
@@ -171,15 +170,15 @@ void createScene02(shared_ptr<Scene> scene)
     // RED SPHERE //
     ////////////////
     Point                  centerSphere1(-60.0, 0.0, 60.0);
-    shared_ptr<Renderable> rSphere1 = make_shared<Sphere>(centerSphere1, 40.);
+    shared_ptr<Renderable> rSphere1 = scene->create<Sphere>(centerSphere1, 40.);
 
     // Create a BRDF model for the sphere
     Color            diffusionSphere1(1.0, 0.6, 0.6);
     Color            specularSphere1(0.9, 0.4, 0.4);
-    shared_ptr<BRDF> rBRDFSphere1 = make_shared<Phong>(diffusionSphere1 * 2.0, specularSphere1, 3);
+    shared_ptr<BRDF> rBRDFSphere1 = scene->create<Phong>(diffusionSphere1 * 2.0, specularSphere1, 3);
 
     // Create a shader for the sphere
-    auto rShaderSphere1 = make_shared<Shader>(rBRDFSphere1, reflectionCoeff, refractionCoeff, scene);
+    auto rShaderSphere1 = scene->create<Shader>(rBRDFSphere1, reflectionCoeff, refractionCoeff, scene);
     rShaderSphere1->setReflectionCountMax(3);
     rSphere1->shader(rShaderSphere1);
 
@@ -192,15 +191,15 @@ void createScene02(shared_ptr<Scene> scene)
     // GREEN SPHERE //
     //////////////////
     Point                  centerSphere2(60.0, 0.0, 50.0);
-    shared_ptr<Renderable> rSphere2 = make_shared<Sphere>(centerSphere2, 40.);
+    shared_ptr<Renderable> rSphere2 = scene->create<Sphere>(centerSphere2, 40.);
 
     // Create a BRDF model for the sphere
     Color            diffusionSphere2(0.6, 1.0, 0.6);
     Color            specularSphere2(0.4, 1.0, 0.4);
-    shared_ptr<BRDF> rBRDFSphere2 = make_shared<Phong>(diffusionSphere2 * 2.0, specularSphere2, 3);
+    shared_ptr<BRDF> rBRDFSphere2 = scene->create<Phong>(diffusionSphere2 * 2.0, specularSphere2, 3);
 
     // Create a shader for the second sphere
-    auto rShaderSphere2 = make_shared<Shader>(rBRDFSphere2, reflectionCoeff, refractionCoeff, scene);
+    auto rShaderSphere2 = scene->create<Shader>(rBRDFSphere2, reflectionCoeff, refractionCoeff, scene);
     rShaderSphere2->setReflectionCountMax(3);
     rSphere2->shader(rShaderSphere2);
 
@@ -213,15 +212,15 @@ void createScene02(shared_ptr<Scene> scene)
     // BLUE SPHERE //
     /////////////////
     Point                  centerSphere3(0.0, -10.0, 110.0);
-    shared_ptr<Renderable> rSphere3 = make_shared<Sphere>(centerSphere3, 20.0);
+    shared_ptr<Renderable> rSphere3 = scene->create<Sphere>(centerSphere3, 20.0);
 
     // Create a BRDF model for the sphere
     Color            diffusionSphere3(0.6, 0.6, 1.0);
     Color            specularSphere3(0.4, 0.4, 0.9);
-    shared_ptr<BRDF> rBRDFSphere3 = make_shared<Phong>(diffusionSphere3 * 2.0, specularSphere3, 3);
+    shared_ptr<BRDF> rBRDFSphere3 = scene->create<Phong>(diffusionSphere3 * 2.0, specularSphere3, 3);
 
     // Create a shader for the third sphere
-    auto rShaderSphere3 = make_shared<Shader>(rBRDFSphere3, reflectionCoeff, 1.0, scene);
+    auto rShaderSphere3 = scene->create<Shader>(rBRDFSphere3, reflectionCoeff, 1.0, scene);
     rShaderSphere3->setReflectionCountMax(3);
     rSphere3->shader(rShaderSphere3);
 
@@ -234,15 +233,15 @@ void createScene02(shared_ptr<Scene> scene)
     // CYAN SPHERE IN BACKGROUND //
     ///////////////////////////////
     Point                  centerSphere4(-50.0, 0.0, -250.0);
-    shared_ptr<Renderable> rSphere4 = make_shared<Sphere>(centerSphere4, 100.0);
+    shared_ptr<Renderable> rSphere4 = scene->create<Sphere>(centerSphere4, 100.0);
 
     // Create a BRDF model for the sphere
     Color            diffusionSphere4(0, 255, 255);
     Color            specularSphere4(0.0);
-    shared_ptr<BRDF> rBRDFSphere4 = make_shared<Phong>(diffusionSphere4 * 6, specularSphere4, 3);
+    shared_ptr<BRDF> rBRDFSphere4 = scene->create<Phong>(diffusionSphere4 * 6, specularSphere4, 3);
 
     // Create a shader for the fourth sphere
-    auto rShaderSphere4 = make_shared<Shader>(rBRDFSphere4, 0.0, 1.0, scene);
+    auto rShaderSphere4 = scene->create<Shader>(rBRDFSphere4, 0.0, 1.0, scene);
     rSphere4->shader(rShaderSphere4);
 
     scene->add(rSphere4);
@@ -262,22 +261,22 @@ void createScene02(shared_ptr<Scene> scene)
     ////////////
     Point             light1Position(50., 130., 150.0);
     Color             light1Color(18.0);
-    shared_ptr<Light> rLight1 = make_shared<PunctualLight>(light1Position, light1Color);
+    shared_ptr<Light> rLight1 = scene->create<PunctualLight>(light1Position, light1Color);
     scene->add(rLight1);
 
     Point             light2Position(20., 150., 150.0);
     Color             light2Color(18.0);
-    shared_ptr<Light> rLight2 = make_shared<PunctualLight>(light2Position, light2Color);
+    shared_ptr<Light> rLight2 = scene->create<PunctualLight>(light2Position, light2Color);
     scene->add(rLight2);
 
     Point             light3Position(-70., 50., 110.0);
     Color             light3Color(15.0);
-    shared_ptr<Light> rLight3 = make_shared<PunctualLight>(light3Position, light3Color);
+    shared_ptr<Light> rLight3 = scene->create<PunctualLight>(light3Position, light3Color);
     scene->add(rLight3);
 
     Point             light4Position(-20., 50., 160.0);
     Color             light4Color(15.0);
-    shared_ptr<Light> rLight4 = make_shared<PunctualLight>(light4Position, light4Color);
+    shared_ptr<Light> rLight4 = scene->create<PunctualLight>(light4Position, light4Color);
     scene->add(rLight4);
 
 
@@ -312,14 +311,14 @@ void createScene03(shared_ptr<Scene> scene)
     // SPHERE WITH A TURBULANCE TEXTURE //
     //////////////////////////////////////
     Point                  center(-20.0, 0.0, 0.0);
-    shared_ptr<Renderable> rSphere1 = make_shared<Sphere>(center, 3.0);
+    shared_ptr<Renderable> rSphere1 = scene->create<Sphere>(center, 3.0);
 
     Color            diffusion(245, 222, 179);
     Color            specular(255, 255, 255);
-    shared_ptr<BRDF> rBRDF1 = make_shared<Phong>(diffusion * 2.0, specular, 15);
+    shared_ptr<BRDF> rBRDF1 = scene->create<Phong>(diffusion * 2.0, specular, 15);
 
     // Create a shader for the turbulance sphere
-    auto rShader1 = make_shared<Shader>(rBRDF1, reflection, refraction, scene, Shader::Material::TURBULANCE);
+    auto rShader1 = scene->create<Shader>(rBRDF1, reflection, refraction, scene, Shader::Material::TURBULANCE);
     rShader1->setReflectionCountMax(2);
 
     rSphere1->shader(rShader1);
@@ -332,13 +331,13 @@ void createScene03(shared_ptr<Scene> scene)
     // SPHERE WITH A MARBLE TEXTURE //
     //////////////////////////////////
     center.set(-10.0, 0.0, 0.0);
-    shared_ptr<Renderable> rSphere2 = make_shared<Sphere>(center, 3.0);
+    shared_ptr<Renderable> rSphere2 = scene->create<Sphere>(center, 3.0);
 
     diffusion.set(0, 255, 255);
-    shared_ptr<BRDF> rBRDF2 = make_shared<Phong>(diffusion, specular, 15);
+    shared_ptr<BRDF> rBRDF2 = scene->create<Phong>(diffusion, specular, 15);
 
     // Create a shader for the marble sphere
-    auto rShader2 = make_shared<Shader>(rBRDF2, reflection, refraction, scene, Shader::Material::MARBLE);
+    auto rShader2 = scene->create<Shader>(rBRDF2, reflection, refraction, scene, Shader::Material::MARBLE);
     rShader2->setReflectionCountMax(2);
 
     rSphere2->shader(rShader2);
@@ -355,10 +354,10 @@ void createScene03(shared_ptr<Scene> scene)
 
     // Create a BRDF model for the torus
     diffusion.set(255, 105, 0);
-    shared_ptr<BRDF> rBRDFTorus = make_shared<Phong>(diffusion, specular, 3);
+    shared_ptr<BRDF> rBRDFTorus = scene->create<Phong>(diffusion, specular, 3);
 
     // Create a shader for the torus
-    auto rShaderTorus = make_shared<Shader>(rBRDFTorus, 0.8, 1.0, scene, Shader::NONE);
+    auto rShaderTorus = scene->create<Shader>(rBRDFTorus, 0.8, 1.0, scene, Shader::NONE);
 
     // Get an iterator on the object of the scene and displace it until refers to the torus
     auto it = scene->renderableList().begin();
@@ -374,13 +373,13 @@ void createScene03(shared_ptr<Scene> scene)
     // SPHERE WITH A BUMP TEXTURE //
     ////////////////////////////////
     center.set(8.0, 0.0, 0.0);
-    shared_ptr<Renderable> rSphere3 = make_shared<Sphere>(center, 3.0);
+    shared_ptr<Renderable> rSphere3 = scene->create<Sphere>(center, 3.0);
 
     diffusion.set(127, 255, 0);
-    shared_ptr<BRDF> rBRDF3 = make_shared<Phong>(diffusion, specular, 15);
+    shared_ptr<BRDF> rBRDF3 = scene->create<Phong>(diffusion, specular, 15);
 
     // Create a shader for the marble sphere
-    auto rShader3 = make_shared<Shader>(rBRDF3, reflection, refraction, scene, Shader::Material::BUMP);
+    auto rShader3 = scene->create<Shader>(rBRDF3, reflection, refraction, scene, Shader::Material::BUMP);
     rShader3->setReflectionCountMax(2);
 
     rSphere3->shader(rShader3);
@@ -393,10 +392,10 @@ void createScene03(shared_ptr<Scene> scene)
     // SPHERE WITH A TEXTURE //
     ///////////////////////////
     center.set(18.0, 0.0, 0.0);
-    shared_ptr<Renderable> rSphere4 = make_shared<Sphere>(center, 3.0);
+    shared_ptr<Renderable> rSphere4 = scene->create<Sphere>(center, 3.0);
 
     // Create a BRDF model for the sphere
-    auto rCubeMapSphere = make_shared<CubeMap>(center, 104);
+    auto rCubeMapSphere = scene->create<CubeMap>(center, 104);
     rCubeMapSphere->addImage(CubeMap::Faces::BACK, "./resources/earth_back.png");
     rCubeMapSphere->addImage(CubeMap::Faces::FRONT, "./resources/earth_front.png");
     rCubeMapSphere->addImage(CubeMap::Faces::UP, "./resources/earth_up.png");
@@ -408,11 +407,11 @@ void createScene03(shared_ptr<Scene> scene)
     scene->add(rCubeMapSphere);
 
     diffusion.set(255, 255, 255);
-    shared_ptr<BRDF> rBRDF4 = make_shared<Phong>(diffusion * 2.0, specular, 15);
+    shared_ptr<BRDF> rBRDF4 = scene->create<Phong>(diffusion * 2.0, specular, 15);
     rBRDF4->cubeMap(rCubeMapSphere);
 
     // Create a shader for the sphere
-    auto rShader4 = make_shared<Shader>(rBRDF4, reflection, refraction, scene);
+    auto rShader4 = scene->create<Shader>(rBRDF4, reflection, refraction, scene);
     rShader4->setReflectionCountMax(1);
     rSphere4->shader(rShader4);
 
@@ -427,7 +426,7 @@ void createScene03(shared_ptr<Scene> scene)
     Point lightPos(0.0, 20.0, 15.0);
     Color lightCol(18.0);
 
-    shared_ptr<Light> rLight = make_shared<PunctualLight>(lightPos, lightCol);
+    shared_ptr<Light> rLight = scene->create<PunctualLight>(lightPos, lightCol);
     scene->add(rLight);
 
 
@@ -466,15 +465,15 @@ void createScene04(shared_ptr<Scene> scene)
 
     // Create a sphere
     Point                  centerSphere1(-180.0, 0.0, 0.0);
-    shared_ptr<Renderable> rSphere1 = make_shared<Sphere>(centerSphere1, 50.);
+    shared_ptr<Renderable> rSphere1 = scene->create<Sphere>(centerSphere1, 50.);
 
     // Create a BRDF model for the sphere
     Color            diffusionSphere1(1.3, 0.0, 0.0);
     Color            specularSphere1(1.0);
-    shared_ptr<BRDF> rBRDFSphere1 = make_shared<Phong>(diffusionSphere1, specularSphere1, 25);
+    shared_ptr<BRDF> rBRDFSphere1 = scene->create<Phong>(diffusionSphere1, specularSphere1, 25);
 
     // Create a shader for the sphere
-    auto rShaderSphere1 = make_shared<Shader>(rBRDFSphere1, reflectionCoeff, refractionCoeff, scene);
+    auto rShaderSphere1 = scene->create<Shader>(rBRDFSphere1, reflectionCoeff, refractionCoeff, scene);
     rShaderSphere1->setReflectionCountMax(2);
     rSphere1->shader(rShaderSphere1);
 
@@ -484,15 +483,15 @@ void createScene04(shared_ptr<Scene> scene)
 
     // Create a second sphere
     Point                  centerSphere2(0.0, 0.0, 0.0);
-    shared_ptr<Renderable> rSphere2 = make_shared<Sphere>(centerSphere2, 50.);
+    shared_ptr<Renderable> rSphere2 = scene->create<Sphere>(centerSphere2, 50.);
 
     // Create a BRDF model for the sphere
     Color            diffusionSphere2(0.0, 1.2, 0.0);
     Color            specularSphere2(0.8);
-    shared_ptr<BRDF> rBRDFSphere2 = make_shared<Phong>(diffusionSphere2, specularSphere2, 25);
+    shared_ptr<BRDF> rBRDFSphere2 = scene->create<Phong>(diffusionSphere2, specularSphere2, 25);
 
     // Create a shader for the second sphere
-    auto rShaderSphere2 = make_shared<Shader>(rBRDFSphere2, reflectionCoeff, refractionCoeff, scene);
+    auto rShaderSphere2 = scene->create<Shader>(rBRDFSphere2, reflectionCoeff, refractionCoeff, scene);
     rShaderSphere2->setReflectionCountMax(2);
     rSphere2->shader(rShaderSphere2);
 
@@ -502,15 +501,15 @@ void createScene04(shared_ptr<Scene> scene)
 
     // Create a purple sphere
     Point                  centerSphere3(180.0, 0.0, 0.0);
-    shared_ptr<Renderable> rSphere3 = make_shared<Sphere>(centerSphere3, 50.0);
+    shared_ptr<Renderable> rSphere3 = scene->create<Sphere>(centerSphere3, 50.0);
 
     // Create a BRDF model for the sphere
     Color            diffusionSphere3(0.24, 0.34, 1.97);
     Color            specularSphere3(0.8);
-    shared_ptr<BRDF> rBRDFSphere3 = make_shared<Phong>(diffusionSphere3, specularSphere3, 25);
+    shared_ptr<BRDF> rBRDFSphere3 = scene->create<Phong>(diffusionSphere3, specularSphere3, 25);
 
     // Create a shader for the third sphere
-    auto rShaderSphere3 = make_shared<Shader>(rBRDFSphere3, reflectionCoeff, refractionCoeff, scene);
+    auto rShaderSphere3 = scene->create<Shader>(rBRDFSphere3, reflectionCoeff, refractionCoeff, scene);
     rShaderSphere3->setReflectionCountMax(2);
     rSphere3->shader(rShaderSphere3);
 
@@ -524,24 +523,24 @@ void createScene04(shared_ptr<Scene> scene)
     ////////////
     Point             light1Position(0., 0.0, 100.0);
     Color             lowLightColor(20.0);
-    shared_ptr<Light> rLight1 = make_shared<PunctualLight>(light1Position, lowLightColor);
+    shared_ptr<Light> rLight1 = scene->create<PunctualLight>(light1Position, lowLightColor);
     scene->add(rLight1);
 
     Point             light2Position(-200., 0.0, 100.0);
-    shared_ptr<Light> rLight2 = make_shared<PunctualLight>(light2Position, lowLightColor);
+    shared_ptr<Light> rLight2 = scene->create<PunctualLight>(light2Position, lowLightColor);
     scene->add(rLight2);
 
     Point             light3Position(200., 0.0, 100.0);
-    shared_ptr<Light> rLight3 = make_shared<PunctualLight>(light3Position, lowLightColor);
+    shared_ptr<Light> rLight3 = scene->create<PunctualLight>(light3Position, lowLightColor);
     scene->add(rLight3);
 
     Point             light4Position(90., 300., 200.0);
     Color             highLightColor(200.0);
-    shared_ptr<Light> rLight4 = make_shared<PunctualLight>(light4Position, highLightColor);
+    shared_ptr<Light> rLight4 = scene->create<PunctualLight>(light4Position, highLightColor);
     scene->add(rLight4);
 
     Point             light5Position(-90., 300., 200.0);
-    shared_ptr<Light> rLight5 = make_shared<PunctualLight>(light5Position, highLightColor);
+    shared_ptr<Light> rLight5 = scene->create<PunctualLight>(light5Position, highLightColor);
     scene->add(rLight5);
 
     ////////////
@@ -578,15 +577,15 @@ void createScene04bis(shared_ptr<Scene> scene)
     // RED SPHERE //
     ////////////////
     Point                  centerSphere1(-2.50, 0.0, 0.0);
-    shared_ptr<Renderable> rSphere1 = make_shared<Sphere>(centerSphere1, 1.0);
+    shared_ptr<Renderable> rSphere1 = scene->create<Sphere>(centerSphere1, 1.0);
 
     // Create a BRDF model for the sphere
     Color            diffusionSphere1(1.3, 0.0, 0.0);
     Color            specularSphere1(1.0);
-    shared_ptr<BRDF> rBRDFSphere1 = make_shared<Phong>(diffusionSphere1, specularSphere1, 25);
+    shared_ptr<BRDF> rBRDFSphere1 = scene->create<Phong>(diffusionSphere1, specularSphere1, 25);
 
     // Create a shader for the sphere
-    auto rShaderSphere1 = make_shared<Shader>(rBRDFSphere1, reflectionCoeff, refractionCoeff, scene);
+    auto rShaderSphere1 = scene->create<Shader>(rBRDFSphere1, reflectionCoeff, refractionCoeff, scene);
     rShaderSphere1->setReflectionCountMax(4);
     rSphere1->shader(rShaderSphere1);
 
@@ -599,15 +598,15 @@ void createScene04bis(shared_ptr<Scene> scene)
     // GREEN SPHERE //
     //////////////////
     Point                  centerSphere2(0.0, 0.0, 0.0);
-    shared_ptr<Renderable> rSphere2 = make_shared<Sphere>(centerSphere2, 1.0);
+    shared_ptr<Renderable> rSphere2 = scene->create<Sphere>(centerSphere2, 1.0);
 
     // Create a BRDF model for the sphere
     Color            diffusionSphere2(0.0, 1.2, 0.0);
     Color            specularSphere2(0.8);
-    shared_ptr<BRDF> rBRDFSphere2 = make_shared<Phong>(diffusionSphere2, specularSphere2, 25);
+    shared_ptr<BRDF> rBRDFSphere2 = scene->create<Phong>(diffusionSphere2, specularSphere2, 25);
 
     // Create a shader for the second sphere
-    auto rShaderSphere2 = make_shared<Shader>(rBRDFSphere2, reflectionCoeff, refractionCoeff, scene);
+    auto rShaderSphere2 = scene->create<Shader>(rBRDFSphere2, reflectionCoeff, refractionCoeff, scene);
     rShaderSphere2->setReflectionCountMax(4);
     rSphere2->shader(rShaderSphere2);
 
@@ -619,15 +618,15 @@ void createScene04bis(shared_ptr<Scene> scene)
     // PURPLE SPHERE //
     ///////////////////
     Point                  centerSphere3(2.50, 0.0, 0.0);
-    shared_ptr<Renderable> rSphere3 = make_shared<Sphere>(centerSphere3, 1.0);
+    shared_ptr<Renderable> rSphere3 = scene->create<Sphere>(centerSphere3, 1.0);
 
     // Create a BRDF model for the sphere
     Color            diffusionSphere3(0.24, 0.34, 1.97);
     Color            specularSphere3(0.8);
-    shared_ptr<BRDF> rBRDFSphere3 = make_shared<Phong>(diffusionSphere3, specularSphere3, 25);
+    shared_ptr<BRDF> rBRDFSphere3 = scene->create<Phong>(diffusionSphere3, specularSphere3, 25);
 
     // Create a shader for the third sphere
-    auto rShaderSphere3 = make_shared<Shader>(rBRDFSphere3, reflectionCoeff, refractionCoeff, scene);
+    auto rShaderSphere3 = scene->create<Shader>(rBRDFSphere3, reflectionCoeff, refractionCoeff, scene);
     rShaderSphere3->setReflectionCountMax(4);
     rSphere3->shader(rShaderSphere3);
 
@@ -641,11 +640,11 @@ void createScene04bis(shared_ptr<Scene> scene)
     ////////////
     Point             light4Position(1.15, 4., 4.0);
     Color             lightColor(16.0);
-    shared_ptr<Light> rLight4 = make_shared<PunctualLight>(light4Position, lightColor);
+    shared_ptr<Light> rLight4 = scene->create<PunctualLight>(light4Position, lightColor);
     scene->add(rLight4);
 
     Point             light5Position(-1.15, 4., 4.0);
-    shared_ptr<Light> rLight5 = make_shared<PunctualLight>(light5Position, lightColor);
+    shared_ptr<Light> rLight5 = scene->create<PunctualLight>(light5Position, lightColor);
     scene->add(rLight5);
 
 
@@ -682,10 +681,10 @@ void createScene05(shared_ptr<Scene> scene)
     // Create a BRDF model for the torus
     Color            diffusionTorus(0.76, 0.33, 0.12);
     Color            specularTorus(0.9, 0.8, 0.8);
-    shared_ptr<BRDF> rBRDFTorus = make_shared<Phong>(diffusionTorus, specularTorus, 3);
+    shared_ptr<BRDF> rBRDFTorus = scene->create<Phong>(diffusionTorus, specularTorus, 3);
 
     // Create a shader for the sphere
-    auto rShaderTorus = make_shared<Shader>(rBRDFTorus, 0.8, 1.0, scene, Shader::BUMP);
+    auto rShaderTorus = scene->create<Shader>(rBRDFTorus, 0.8, 1.0, scene, Shader::BUMP);
 
     auto it = scene->renderableList().begin();
     (*it)->shader(rShaderTorus);
@@ -699,12 +698,12 @@ void createScene05(shared_ptr<Scene> scene)
     ////////////
     Point             light1Position(0., 1.0, 10.0);
     Color             light1Color(10.0);
-    shared_ptr<Light> rLight1 = make_shared<PunctualLight>(light1Position, light1Color);
+    shared_ptr<Light> rLight1 = scene->create<PunctualLight>(light1Position, light1Color);
     scene->add(rLight1);
 
     Point             light4Position(0., 10., 6.0);
     Color             light4Color(10.0);
-    shared_ptr<Light> rLight4 = make_shared<PunctualLight>(light4Position, light4Color);
+    shared_ptr<Light> rLight4 = scene->create<PunctualLight>(light4Position, light4Color);
     scene->add(rLight4);
 
 
@@ -740,15 +739,15 @@ void createScene06(shared_ptr<Scene> scene)
 
     // SPHERE WITH REFRACTION
     Point                  center(0.0, 0.0, 0.0);
-    shared_ptr<Renderable> rSphere1 = make_shared<Sphere>(center, 5.);
+    shared_ptr<Renderable> rSphere1 = scene->create<Sphere>(center, 5.);
 
     // Create a BRDF model for the sphere
     Color            diffusionSphere1(1.0);
     Color            specularSphere1(0.1);
-    shared_ptr<BRDF> rBRDFSphere1 = make_shared<Phong>(diffusionSphere1, specularSphere1, 3);
+    shared_ptr<BRDF> rBRDFSphere1 = scene->create<Phong>(diffusionSphere1, specularSphere1, 3);
 
     // Create a shader for the sphere
-    auto rShaderSphere1 = make_shared<Shader>(rBRDFSphere1, reflectionCoeff, 2.0, scene);
+    auto rShaderSphere1 = scene->create<Shader>(rBRDFSphere1, reflectionCoeff, 2.0, scene);
     rSphere1->shader(rShaderSphere1);
 
     scene->add(rSphere1);
@@ -762,10 +761,10 @@ void createScene06(shared_ptr<Scene> scene)
 
     // BG 1, left
     center.x(-20.0);
-    shared_ptr<Renderable> rSphereL1 = make_shared<Sphere>(center, size);
+    shared_ptr<Renderable> rSphereL1 = scene->create<Sphere>(center, size);
 
-    shared_ptr<BRDF> rBRDF_L1  = make_shared<Phong>(Color(250, 240, 230) * 5.0, Color(1.0), 3);
-    auto             rShaderL1 = make_shared<Shader>(rBRDF_L1, reflectionCoeff, 1.0, scene, Shader::BUMP);
+    shared_ptr<BRDF> rBRDF_L1  = scene->create<Phong>(Color(250, 240, 230) * 5.0, Color(1.0), 3);
+    auto             rShaderL1 = scene->create<Shader>(rBRDF_L1, reflectionCoeff, 1.0, scene, Shader::BUMP);
 
     rSphereL1->shader(rShaderL1);
 
@@ -775,10 +774,10 @@ void createScene06(shared_ptr<Scene> scene)
 
     // BG 1, right
     center.x(20.0);
-    shared_ptr<Renderable> rSphereR1 = make_shared<Sphere>(center, size);
+    shared_ptr<Renderable> rSphereR1 = scene->create<Sphere>(center, size);
 
-    shared_ptr<BRDF> rBRDFR1   = make_shared<Phong>(Color(135, 206, 250) * 5.0, Color(1.0), 3);
-    auto             rShaderR1 = make_shared<Shader>(rBRDFR1, reflectionCoeff, 1.0, scene, Shader::BUMP);
+    shared_ptr<BRDF> rBRDFR1   = scene->create<Phong>(Color(135, 206, 250) * 5.0, Color(1.0), 3);
+    auto             rShaderR1 = scene->create<Shader>(rBRDFR1, reflectionCoeff, 1.0, scene, Shader::BUMP);
 
     rSphereR1->shader(rShaderR1);
 
@@ -789,10 +788,10 @@ void createScene06(shared_ptr<Scene> scene)
     // BG 1, down
     center.x(0.0);
     center.y(-20.0);
-    shared_ptr<Renderable> rSphereD1 = make_shared<Sphere>(center, size);
+    shared_ptr<Renderable> rSphereD1 = scene->create<Sphere>(center, size);
 
-    shared_ptr<BRDF> rBRDFD1   = make_shared<Phong>(Color(250, 128, 114) * 5.0, Color(1.0), 3);
-    auto             rShaderD1 = make_shared<Shader>(rBRDFD1, reflectionCoeff, 1.0, scene, Shader::BUMP);
+    shared_ptr<BRDF> rBRDFD1   = scene->create<Phong>(Color(250, 128, 114) * 5.0, Color(1.0), 3);
+    auto             rShaderD1 = scene->create<Shader>(rBRDFD1, reflectionCoeff, 1.0, scene, Shader::BUMP);
 
     rSphereD1->shader(rShaderD1);
 
@@ -802,10 +801,10 @@ void createScene06(shared_ptr<Scene> scene)
 
     // BG 1, up
     center.y(20.0);
-    shared_ptr<Renderable> rSphereU1 = make_shared<Sphere>(center, size);
+    shared_ptr<Renderable> rSphereU1 = scene->create<Sphere>(center, size);
 
-    shared_ptr<BRDF> rBRDFU1   = make_shared<Phong>(Color(255, 250, 205) * 5.0, Color(1.0), 3);
-    auto             rShaderU1 = make_shared<Shader>(rBRDFU1, reflectionCoeff, 1.0, scene, Shader::BUMP);
+    shared_ptr<BRDF> rBRDFU1   = scene->create<Phong>(Color(255, 250, 205) * 5.0, Color(1.0), 3);
+    auto             rShaderU1 = scene->create<Shader>(rBRDFU1, reflectionCoeff, 1.0, scene, Shader::BUMP);
 
     rSphereU1->shader(rShaderU1);
 
@@ -820,10 +819,10 @@ void createScene06(shared_ptr<Scene> scene)
     // BG 2, left down
     center.x(-85.0);
     center.y(-85.0);
-    shared_ptr<Renderable> rSphereLD2 = make_shared<Sphere>(center, size);
+    shared_ptr<Renderable> rSphereLD2 = scene->create<Sphere>(center, size);
 
-    shared_ptr<BRDF> rBRDFLD2   = make_shared<Phong>(Color(127, 255, 212) * 5.0, Color(1.0), 3);
-    auto             rShaderLD2 = make_shared<Shader>(rBRDFLD2, reflectionCoeff, 1.0, scene);
+    shared_ptr<BRDF> rBRDFLD2   = scene->create<Phong>(Color(127, 255, 212) * 5.0, Color(1.0), 3);
+    auto             rShaderLD2 = scene->create<Shader>(rBRDFLD2, reflectionCoeff, 1.0, scene);
 
     rSphereLD2->shader(rShaderLD2);
 
@@ -834,10 +833,10 @@ void createScene06(shared_ptr<Scene> scene)
     // BG 2, right down
     center.x(85.0);
     center.y(-85.0);
-    shared_ptr<Renderable> rSphereRD2 = make_shared<Sphere>(center, size);
+    shared_ptr<Renderable> rSphereRD2 = scene->create<Sphere>(center, size);
 
-    shared_ptr<BRDF> rBRDFRD2   = make_shared<Phong>(Color(240, 248, 255) * 5.0, Color(1.0), 3);
-    auto             rShaderRD2 = make_shared<Shader>(rBRDFRD2, reflectionCoeff, 1.0, scene);
+    shared_ptr<BRDF> rBRDFRD2   = scene->create<Phong>(Color(240, 248, 255) * 5.0, Color(1.0), 3);
+    auto             rShaderRD2 = scene->create<Shader>(rBRDFRD2, reflectionCoeff, 1.0, scene);
 
     rSphereRD2->shader(rShaderRD2);
 
@@ -848,10 +847,10 @@ void createScene06(shared_ptr<Scene> scene)
     // BG 2, left up
     center.x(-85.0);
     center.y(85.0);
-    shared_ptr<Renderable> rSphereLU2 = make_shared<Sphere>(center, size);
+    shared_ptr<Renderable> rSphereLU2 = scene->create<Sphere>(center, size);
 
-    shared_ptr<BRDF> rBRDFLU2   = make_shared<Phong>(Color(255, 99, 71) * 5.0, Color(1.0), 3);
-    auto             rShaderLU2 = make_shared<Shader>(rBRDFLU2, reflectionCoeff, 1.0, scene);
+    shared_ptr<BRDF> rBRDFLU2   = scene->create<Phong>(Color(255, 99, 71) * 5.0, Color(1.0), 3);
+    auto             rShaderLU2 = scene->create<Shader>(rBRDFLU2, reflectionCoeff, 1.0, scene);
 
     rSphereLU2->shader(rShaderLU2);
 
@@ -862,10 +861,10 @@ void createScene06(shared_ptr<Scene> scene)
     // BG2, right up
     center.x(85.0);
     center.y(85.0);
-    shared_ptr<Renderable> rSphereRU2 = make_shared<Sphere>(center, size);
+    shared_ptr<Renderable> rSphereRU2 = scene->create<Sphere>(center, size);
 
-    shared_ptr<BRDF> rBRDFRU2   = make_shared<Phong>(Color(255, 255, 0) * 5.0, Color(1.0), 3);
-    auto             rShaderRU2 = make_shared<Shader>(rBRDFRU2, reflectionCoeff, 1.0, scene);
+    shared_ptr<BRDF> rBRDFRU2   = scene->create<Phong>(Color(255, 255, 0) * 5.0, Color(1.0), 3);
+    auto             rShaderRU2 = scene->create<Shader>(rBRDFRU2, reflectionCoeff, 1.0, scene);
 
     rSphereRU2->shader(rShaderRU2);
 
@@ -876,12 +875,12 @@ void createScene06(shared_ptr<Scene> scene)
 
     //    // SPHERE WITH TEXTURE
     //    Point centerSphere2(12.0,0.0,0.0);
-    //	shared_ptr<Renderable> rSphere2 = make_shared<Sphere>(centerSphere2,5.);
+    //	shared_ptr<Renderable> rSphere2 = scene->create<Sphere>(centerSphere2,5.);
     //
     //    // Create a BRDF model for the sphere
     //    Color diffusionSphere2(1.0);
     //	Color specularSphere2(0.1);
-    //    auto rCubeMapSphere = make_shared<CubeMap>(centerSphere2, 520);
+    //    auto rCubeMapSphere = scene->create<CubeMap>(centerSphere2, 520);
     //    rCubeMapSphere->addImage(CubeMap::Faces::BACK, "./resources/Desert_back.png");
     //    rCubeMapSphere->addImage(CubeMap::Faces::FRONT,"./resources/Desert_front.png");
     //    rCubeMapSphere->addImage(CubeMap::Faces::UP, "./resources/Desert_up.png");
@@ -891,11 +890,11 @@ void createScene06(shared_ptr<Scene> scene)
     //
     //    scene->add(rCubeMapSphere);
     //
-    //	shared_ptr<BRDF> rBRDFSphere2 = make_shared<Phong>(diffusionSphere2,lSpecularSphere2,3);
+    //	shared_ptr<BRDF> rBRDFSphere2 = scene->create<Phong>(diffusionSphere2,lSpecularSphere2,3);
     //    rBRDFSphere2->cubeMap(rCubeMapSphere);
     //
     //    // Create a shader for the second sphere
-    //	auto rShaderSphere2 = make_shared<Shader>(rBRDFSphere2,lReflectionCoeff,1.0,scene);
+    //	auto rShaderSphere2 = scene->create<Shader>(rBRDFSphere2,lReflectionCoeff,1.0,scene);
     //    rSphere2->shader(rShaderSphere2);
     //
     //    scene->add(rSphere2);
@@ -908,7 +907,7 @@ void createScene06(shared_ptr<Scene> scene)
     ////////////
     Point             lightPosition(0.0, 0.0, 20.0);
     Color             lightColor(6.0);
-    shared_ptr<Light> rLight1 = make_shared<PunctualLight>(lightPosition, lightColor);
+    shared_ptr<Light> rLight1 = scene->create<PunctualLight>(lightPosition, lightColor);
     scene->add(rLight1);
 
 
@@ -928,7 +927,7 @@ void createScene06(shared_ptr<Scene> scene)
     scene->add(move(camera));
 
     // BACKGROUND
-    auto rCubeMapBckGrd = make_shared<CubeMap>(Point(0.0), 260);  // 260
+    auto rCubeMapBckGrd = scene->create<CubeMap>(Point(0.0), 260);  // 260
 
     rCubeMapBckGrd->addImage(CubeMap::Faces::BACK, "./resources/River_back.png");
     rCubeMapBckGrd->addImage(CubeMap::Faces::FRONT, "./resources/River_front.png");
@@ -946,15 +945,15 @@ void createScene07(shared_ptr<Scene> scene)
 {
     // Create a sphere (1)
     Point                  centerSphere1(-30., 10.0, 20.0);
-    shared_ptr<Renderable> rSphere1 = make_shared<Sphere>(centerSphere1, 13.);
+    shared_ptr<Renderable> rSphere1 = scene->create<Sphere>(centerSphere1, 13.);
 
     // Create a BRDF model for the sphere
     Color            diffusionSphere1(229.0 / 255.0, 51.0 / 255.0, 163.0 / 255.0);
     Color            specularSphere1(0.0);
-    shared_ptr<BRDF> rBRDFSphere1 = make_shared<Phong>(diffusionSphere1, specularSphere1, 3);
+    shared_ptr<BRDF> rBRDFSphere1 = scene->create<Phong>(diffusionSphere1, specularSphere1, 3);
 
     // Create a shader for the sphere
-    auto rShaderSphere1 = make_shared<Shader>(rBRDFSphere1, 0.8, 1.0, scene, Shader::TURBULANCE);
+    auto rShaderSphere1 = scene->create<Shader>(rBRDFSphere1, 0.8, 1.0, scene, Shader::TURBULANCE);
     rSphere1->shader(rShaderSphere1);
 
     scene->add(rSphere1);
@@ -963,15 +962,15 @@ void createScene07(shared_ptr<Scene> scene)
 
     // Create a sphere (2)
     Point                  centerSphere2(0.0, 10.0, 20.0);
-    shared_ptr<Renderable> rSphere2 = make_shared<Sphere>(centerSphere2, 13.);
+    shared_ptr<Renderable> rSphere2 = scene->create<Sphere>(centerSphere2, 13.);
 
     // Create a BRDF model for the sphere
     Color            diffusionSphere2(220.0 / 255.0, 210.0 / 255.0, 120.0 / 255.0);
     Color            specularSphere2(0.0);
-    shared_ptr<BRDF> rBRDFSphere2 = make_shared<Phong>(diffusionSphere2, specularSphere2, 3);
+    shared_ptr<BRDF> rBRDFSphere2 = scene->create<Phong>(diffusionSphere2, specularSphere2, 3);
 
     // Create a shader for the sphere
-    auto rShaderSphere2 = make_shared<Shader>(rBRDFSphere2, 0.8, 1.0, scene, Shader::MARBLE);
+    auto rShaderSphere2 = scene->create<Shader>(rBRDFSphere2, 0.8, 1.0, scene, Shader::MARBLE);
     rSphere2->shader(rShaderSphere2);
 
     scene->add(rSphere2);
@@ -980,15 +979,15 @@ void createScene07(shared_ptr<Scene> scene)
 
     // Create a sphere (3)
     Point                  centerSphere3(30., 10.0, 20.0);
-    shared_ptr<Renderable> rSphere3 = make_shared<Sphere>(centerSphere3, 13.);
+    shared_ptr<Renderable> rSphere3 = scene->create<Sphere>(centerSphere3, 13.);
 
     // Create a BRDF model for the sphere
     Color            diffusionSphere3(90.0 / 255.0, 160.0 / 255.0, 210.0 / 255.0);
     Color            specularSphere3(0.0);
-    shared_ptr<BRDF> rBRDFSphere3 = make_shared<Phong>(diffusionSphere3, specularSphere3, 3);
+    shared_ptr<BRDF> rBRDFSphere3 = scene->create<Phong>(diffusionSphere3, specularSphere3, 3);
 
     // Create a shader for the sphere
-    auto rShaderSphere3 = make_shared<Shader>(rBRDFSphere3, 0.8, 1.0, scene, Shader::BUMP);
+    auto rShaderSphere3 = scene->create<Shader>(rBRDFSphere3, 0.8, 1.0, scene, Shader::BUMP);
     rSphere3->shader(rShaderSphere3);
 
     scene->add(rSphere3);
@@ -1000,19 +999,19 @@ void createScene07(shared_ptr<Scene> scene)
     ////////////
     Point             lightPosition(0.0, 90.0, 0.0);
     Color             lightColor(5.0);
-    shared_ptr<Light> rLight1 = make_shared<PunctualLight>(lightPosition, lightColor);
+    shared_ptr<Light> rLight1 = scene->create<PunctualLight>(lightPosition, lightColor);
     scene->add(rLight1);
 
     //    lightPosition.setPoint(0.0,15.0,37.0);
-    //	shared_ptr<Light> rLight2 = make_shared<PunctualLight>(lightPosition,lLightColor);
+    //	shared_ptr<Light> rLight2 = scene->create<PunctualLight>(lightPosition,lLightColor);
     //    scene->add(rLight2);
 
     lightPosition.set(10.0, 20.0, 37.0);
-    shared_ptr<Light> rLight3 = make_shared<PunctualLight>(lightPosition, lightColor);
+    shared_ptr<Light> rLight3 = scene->create<PunctualLight>(lightPosition, lightColor);
     scene->add(rLight3);
 
     lightPosition.set(-10.0, 20.0, 37.0);
-    shared_ptr<Light> rLight4 = make_shared<PunctualLight>(lightPosition, lightColor);
+    shared_ptr<Light> rLight4 = scene->create<PunctualLight>(lightPosition, lightColor);
     scene->add(rLight4);
 
 
@@ -1060,15 +1059,15 @@ void createScene08(shared_ptr<Scene> scene)
 
     // Create a red sphere
     Point                  centerSphere1(00.0, 0.0, -5.0);
-    shared_ptr<Renderable> rSphere1 = make_shared<Sphere>(centerSphere1, 2.);
+    shared_ptr<Renderable> rSphere1 = scene->create<Sphere>(centerSphere1, 2.);
 
     // Create a BRDF model for the sphere
     Color            diffusionSphere1(1.0, 0.6, 0.6);
     Color            specularSphere1(0.9, 0.4, 0.4);
-    shared_ptr<BRDF> rBRDFSphere1 = make_shared<Phong>(diffusionSphere1, specularSphere1, 3);
+    shared_ptr<BRDF> rBRDFSphere1 = scene->create<Phong>(diffusionSphere1, specularSphere1, 3);
 
     // Create a shader for the sphere
-    auto rShaderSphere1 = make_shared<Shader>(rBRDFSphere1, reflectionCoeff, refractionCoeff, scene);
+    auto rShaderSphere1 = scene->create<Shader>(rBRDFSphere1, reflectionCoeff, refractionCoeff, scene);
     rSphere1->shader(rShaderSphere1);
 
     scene->add(rSphere1);
@@ -1077,15 +1076,15 @@ void createScene08(shared_ptr<Scene> scene)
 
     // Create a green sphere
     Point                  centerSphere2(10.0, 0.0, -100.0);
-    shared_ptr<Renderable> rSphere2 = make_shared<Sphere>(centerSphere2, 30.);
+    shared_ptr<Renderable> rSphere2 = scene->create<Sphere>(centerSphere2, 30.);
 
     // Create a BRDF model for the sphere
     Color            diffusionSphere2(0.6, 1.0, 0.6);
     Color            specularSphere2(0.4, 1.0, 0.4);
-    shared_ptr<BRDF> rBRDFSphere2 = make_shared<Phong>(diffusionSphere2, specularSphere2, 3);
+    shared_ptr<BRDF> rBRDFSphere2 = scene->create<Phong>(diffusionSphere2, specularSphere2, 3);
 
     // Create a shader for the second sphere
-    auto rShaderSphere2 = make_shared<Shader>(rBRDFSphere2, reflectionCoeff, refractionCoeff, scene);
+    auto rShaderSphere2 = scene->create<Shader>(rBRDFSphere2, reflectionCoeff, refractionCoeff, scene);
     rSphere2->shader(rShaderSphere2);
 
     scene->add(rSphere2);
@@ -1097,7 +1096,7 @@ void createScene08(shared_ptr<Scene> scene)
     ////////////
     Point             light1Position(0., 10., 0.0);
     Color             light1Color(3.0);
-    shared_ptr<Light> rLight1 = make_shared<PunctualLight>(light1Position, light1Color);
+    shared_ptr<Light> rLight1 = scene->create<PunctualLight>(light1Position, light1Color);
     scene->add(rLight1);
 
     ////////////
@@ -1129,10 +1128,10 @@ void createScene09(shared_ptr<Scene> scene)
     // Create a BRDF model for the sphere
     const auto       diffusionSphere = Color{ 0.76, 0.33, 0.12 };
     const auto       specularSphere  = Color{ 1.0 };
-    shared_ptr<BRDF> rBRDFShpere     = make_shared<Phong>(diffusionSphere, specularSphere, 5);
+    shared_ptr<BRDF> rBRDFShpere     = scene->create<Phong>(diffusionSphere, specularSphere, 5);
 
     // Create a shader for the sphere
-    auto rShaderSphere = make_shared<Shader>(rBRDFShpere, 0.8, 1.0, scene);
+    auto rShaderSphere = scene->create<Shader>(rBRDFShpere, 0.8, 1.0, scene);
 
     scene->add(rBRDFShpere, string("brdf of the sphere"));
     scene->add(rShaderSphere, string("shader of the sphere"));
@@ -1146,10 +1145,10 @@ void createScene09(shared_ptr<Scene> scene)
     // Create a BRDF model for the torus
     const auto       diffusionTorus = Color{ 0.96, 0.40, 0.40 };
     const auto       specularTorus  = Color{ 0.9, 0.8, 0.8 };
-    shared_ptr<BRDF> rBRDFTorus     = make_shared<Phong>(diffusionTorus, specularTorus, 5);
+    shared_ptr<BRDF> rBRDFTorus     = scene->create<Phong>(diffusionTorus, specularTorus, 5);
 
     // Create a shader for the torus
-    auto rShaderTorus = make_shared<Shader>(rBRDFTorus, 0.8, 1.0, scene, Shader::Material::MARBLE);
+    auto rShaderTorus = scene->create<Shader>(rBRDFTorus, 0.8, 1.0, scene, Shader::Material::MARBLE);
 
     scene->add(rBRDFTorus, string("brdf of the torus"));
     scene->add(rShaderTorus, string("shader of the torus"));
@@ -1164,10 +1163,10 @@ void createScene09(shared_ptr<Scene> scene)
     // Create a BRDF model for the pipe
     const auto       diffusionPipe = Color{ 0.16, 0.89, 0.0 };
     const auto       specularPipe  = Color{ 0.4, 0.8, 0.4 };
-    shared_ptr<BRDF> rBRDFPipe     = make_shared<Phong>(diffusionPipe, specularPipe, 5);
+    shared_ptr<BRDF> rBRDFPipe     = scene->create<Phong>(diffusionPipe, specularPipe, 5);
 
     // Create a shader for the torus
-    auto rShaderPipe = make_shared<Shader>(rBRDFPipe, 0.8, 1.0, scene);
+    auto rShaderPipe = scene->create<Shader>(rBRDFPipe, 0.8, 1.0, scene);
 
     scene->add(rBRDFPipe, string("brdf of the pipe"));
     scene->add(rShaderPipe, string("shader of the pipe"));
@@ -1179,10 +1178,10 @@ void createScene09(shared_ptr<Scene> scene)
     // Create a BRDF model for the cone
     const auto       diffusionCone = Color{ 0.06, 0.10, 0.90 };
     const auto       specularCone  = Color{ 0.3, 0.2, 0.8 };
-    shared_ptr<BRDF> rBRDFCone     = make_shared<Phong>(diffusionCone, specularCone, 5);
+    shared_ptr<BRDF> rBRDFCone     = scene->create<Phong>(diffusionCone, specularCone, 5);
 
     // Create a shader for the torus
-    auto rShaderCone = make_shared<Shader>(rBRDFCone, 0.8, 1.0, scene, Shader::TURBULANCE);
+    auto rShaderCone = scene->create<Shader>(rBRDFCone, 0.8, 1.0, scene, Shader::TURBULANCE);
 
     scene->add(rBRDFCone, string("brdf of the cone"));
     scene->add(rShaderCone, string("shader of the cone"));
@@ -1195,12 +1194,12 @@ void createScene09(shared_ptr<Scene> scene)
     ////////////
     const auto        light1Position = Point{ 0., 1.0, 10.0 };
     const auto        light1Color    = Color{ 10.0 };
-    shared_ptr<Light> rLight1        = make_shared<PunctualLight>(light1Position, light1Color);
+    shared_ptr<Light> rLight1        = scene->create<PunctualLight>(light1Position, light1Color);
     scene->add(rLight1);
 
     const auto        light4Position = Point{ 0., 10., 6.0 };
     const auto        light4Color    = Color{ 10.0 };
-    shared_ptr<Light> rLight4        = make_shared<PunctualLight>(light4Position, light4Color);
+    shared_ptr<Light> rLight4        = scene->create<PunctualLight>(light4Position, light4Color);
     scene->add(rLight4);
 
 
@@ -1234,15 +1233,15 @@ void createScene10(shared_ptr<Scene> scene)
     // Create a first blue sphere //
     ////////////////////////////////
     Point                  centerSphere1(0.0, 0.0, 0.0);
-    shared_ptr<Renderable> rSphere1 = make_shared<Sphere>(centerSphere1, 100.);
+    shared_ptr<Renderable> rSphere1 = scene->create<Sphere>(centerSphere1, 100.);
 
     // Create a BRDF model for the sphere
     Color            diffusionSphere1(0., 0.0, 0.1);
     Color            specularSphere1(1.0);
-    shared_ptr<BRDF> rBRDFSphere1 = make_shared<Phong>(diffusionSphere1, specularSphere1, 8);
+    shared_ptr<BRDF> rBRDFSphere1 = scene->create<Phong>(diffusionSphere1, specularSphere1, 8);
 
     // Create a shader for the sphere
-    auto rShaderSphere1 = make_shared<Shader>(rBRDFSphere1, reflectionCoeff, refractionCoeff, scene);
+    auto rShaderSphere1 = scene->create<Shader>(rBRDFSphere1, reflectionCoeff, refractionCoeff, scene);
     rShaderSphere1->setReflectionCountMax(2);
     rSphere1->shader(rShaderSphere1);
 
@@ -1255,15 +1254,15 @@ void createScene10(shared_ptr<Scene> scene)
     // Create a second blue sphere //
     /////////////////////////////////
     Point                  centerSphere2(50.0, -20.0, 230.0);
-    shared_ptr<Renderable> rSphere2 = make_shared<Sphere>(centerSphere2, 60.);
+    shared_ptr<Renderable> rSphere2 = scene->create<Sphere>(centerSphere2, 60.);
 
     // Create a BRDF model for the sphere
     Color            diffusionSphere2(0.0, 0.0, 0.1);
     Color            specularSphere2(0, 250, 154);
-    shared_ptr<BRDF> rBRDFSphere2 = make_shared<Phong>(diffusionSphere2, specularSphere2, 15);
+    shared_ptr<BRDF> rBRDFSphere2 = scene->create<Phong>(diffusionSphere2, specularSphere2, 15);
 
     // Create a shader for the second sphere
-    auto rShaderSphere2 = make_shared<Shader>(rBRDFSphere2, reflectionCoeff, refractionCoeff, scene);
+    auto rShaderSphere2 = scene->create<Shader>(rBRDFSphere2, reflectionCoeff, refractionCoeff, scene);
     rShaderSphere2->setReflectionCountMax(2);
     rSphere2->shader(rShaderSphere2);
 
@@ -1279,7 +1278,7 @@ void createScene10(shared_ptr<Scene> scene)
     Color light1Color(212.0, 27.0, 218.0);
     light1Color *= 2.0;
 
-    shared_ptr<Light> rLight1 = make_shared<PunctualLight>(light1Position, light1Color);
+    shared_ptr<Light> rLight1 = scene->create<PunctualLight>(light1Position, light1Color);
     scene->add(rLight1);
 
 
@@ -1288,7 +1287,7 @@ void createScene10(shared_ptr<Scene> scene)
 
     light2Color *= 2.0;
 
-    shared_ptr<Light> rLight2 = make_shared<PunctualLight>(light2Position, light2Color);
+    shared_ptr<Light> rLight2 = scene->create<PunctualLight>(light2Position, light2Color);
     scene->add(rLight2);
 
     Point light3Position(-190., 150., 90.0);
@@ -1296,10 +1295,26 @@ void createScene10(shared_ptr<Scene> scene)
 
     light3Color *= 200.0;
 
-    shared_ptr<Light> rLight3 = make_shared<PunctualLight>(light3Position, light3Color);
+    shared_ptr<Light> rLight3 = scene->create<PunctualLight>(light3Position, light3Color);
     scene->add(rLight3);
 
 
+    ///////////////
+    // ANIMATION //
+    ///////////////
+    // Only used when rendering frames: in 2 seconds, the second sphere bounces once and the orange light turns around the first sphere
+    Animation bounce;
+    bounce.key(0.0, Vector(0.0, 0.0, 0.0));
+    bounce.key(1.0, Vector(0.0, 80.0, 0.0));
+    bounce.key(2.0, Vector(0.0, 0.0, 0.0));
+    scene->animate(rSphere2, bounce);
+
+    Animation turn(centerSphere1, Vector(0.0, 1.0, 0.0));
+    turn.key(0.0, Vector(0.0, 0.0, 0.0), 0.0);
+    turn.key(2.0, Vector(0.0, 0.0, 0.0), 2.0 * 3.141592);
+    scene->animate(rLight3, turn);
+
+
     ////////////
     // CAMERA //
     ////////////
@@ -1336,15 +1351,15 @@ void createScene11(shared_ptr<Scene> scene)
     // Create a yellow sphere //
     //////////////////////////
     const auto             centerSphere1 = Point{ -1.1, 0.0, 0.0 };
-    shared_ptr<Renderable> rSphere1      = make_shared<Sphere>(centerSphere1, 1.0);
+    shared_ptr<Renderable> rSphere1      = scene->create<Sphere>(centerSphere1, 1.0);
 
     // Create a BRDF model for the sphere
     const auto       diffusionSphere1 = Color{ 255, 255, 0 };
     const auto       specularSphere1  = Color{ 230, 230, 250 };
-    shared_ptr<BRDF> rBRDFSphere1     = make_shared<Phong>(diffusionSphere1, specularSphere1, 15);
+    shared_ptr<BRDF> rBRDFSphere1     = scene->create<Phong>(diffusionSphere1, specularSphere1, 15);
 
     // Create a shader for the sphere
-    auto rShaderSphere1 = make_shared<Shader>(rBRDFSphere1, reflectionCoeff, refractionCoeff, scene, Shader::TURBULANCE);
+    auto rShaderSphere1 = scene->create<Shader>(rBRDFSphere1, reflectionCoeff, refractionCoeff, scene, Shader::TURBULANCE);
 
     // Set the max number of reflections to 4
     rShaderSphere1->setReflectionCountMax(4);
@@ -1359,15 +1374,15 @@ void createScene11(shared_ptr<Scene> scene)
     // Create a cyan sphere //
     ///////////////////////////
     const auto             centerSphere2 = Point{ 1.1, 0.0, 0.0 };
-    shared_ptr<Renderable> rSphere2      = make_shared<Sphere>(centerSphere2, 1.0);
+    shared_ptr<Renderable> rSphere2      = scene->create<Sphere>(centerSphere2, 1.0);
 
     // Create a BRDF model for the sphere
     const auto       diffusionSphere2 = Color{ 0, 255, 255 };
     const auto       specularSphere2  = Color{ 255, 160, 122 };
-    shared_ptr<BRDF> rBRDFSphere2     = make_shared<Phong>(diffusionSphere2, specularSphere2, 15);
+    shared_ptr<BRDF> rBRDFSphere2     = scene->create<Phong>(diffusionSphere2, specularSphere2, 15);
 
     // Create a shader for the second sphere
-    auto rShaderSphere2 = make_shared<Shader>(rBRDFSphere2, reflectionCoeff, refractionCoeff, scene, Shader::TURBULANCE);
+    auto rShaderSphere2 = scene->create<Shader>(rBRDFSphere2, reflectionCoeff, refractionCoeff, scene, Shader::TURBULANCE);
 
     // Set the max number of reflections to 3
     rShaderSphere2->setReflectionCountMax(3);
@@ -1382,15 +1397,15 @@ void createScene11(shared_ptr<Scene> scene)
     // Create a pink sphere //
     //////////////////////////
     const auto             centerSphere3 = Point{ 0.0, 1.8, 0.0 };
-    shared_ptr<Renderable> rSphere3      = make_shared<Sphere>(centerSphere3, 1.0);
+    shared_ptr<Renderable> rSphere3      = scene->create<Sphere>(centerSphere3, 1.0);
 
     // Create a BRDF model for the sphere
     const auto       diffusionSphere3 = Color{ 255, 0, 255 };
     const auto       specularSphere3  = Color{ 127, 255, 212 };
-    shared_ptr<BRDF> rBRDFSphere3     = make_shared<Phong>(diffusionSphere3, specularSphere3, 15);
+    shared_ptr<BRDF> rBRDFSphere3     = scene->create<Phong>(diffusionSphere3, specularSphere3, 15);
 
     // Create a shader for the second sphere
-    auto rShaderSphere3 = make_shared<Shader>(rBRDFSphere3, reflectionCoeff, refractionCoeff, scene, Shader::TURBULANCE);
+    auto rShaderSphere3 = scene->create<Shader>(rBRDFSphere3, reflectionCoeff, refractionCoeff, scene, Shader::TURBULANCE);
 
     // Set the max number of reflections to 5
     rShaderSphere3->setReflectionCountMax(5);
@@ -1406,12 +1421,12 @@ void createScene11(shared_ptr<Scene> scene)
     ////////////
     const auto        light1Position = Point{ 0., 1.0, 10.0 };
     const auto        light1Color    = Color{ 8.0 };
-    shared_ptr<Light> rLight1        = make_shared<PunctualLight>(light1Position, light1Color);
+    shared_ptr<Light> rLight1        = scene->create<PunctualLight>(light1Position, light1Color);
     scene->add(rLight1);
 
     const auto        light2Position = Point{ 0., 1.0, -10.0 };
     const auto        light2Color    = Color{ 5.0 };
-    shared_ptr<Light> rLight2        = make_shared<PunctualLight>(light2Position, light2Color);
+    shared_ptr<Light> rLight2        = scene->create<PunctualLight>(light2Position, light2Color);
     scene->add(rLight2);
 
 
@@ -1441,15 +1456,15 @@ void createScene12(shared_ptr<Scene> scene)
 
     // Create a sphere
     const auto             centerSphere1 = Point{ 0.0, 5.0, 5.0 };
-    shared_ptr<Renderable> rSphere1      = make_shared<Sphere>(centerSphere1, 9.);
+    shared_ptr<Renderable> rSphere1      = scene->create<Sphere>(centerSphere1, 9.);
 
     // Create a BRDF model for the sphere
     const auto       diffusionSphere1 = Color{ 1.0, 0.8, 0.9 };
     const auto       specularSphere1  = Color{ 1.0 };
-    shared_ptr<BRDF> rBRDFSphere1     = make_shared<Phong>(diffusionSphere1, specularSphere1, 3);
+    shared_ptr<BRDF> rBRDFSphere1     = scene->create<Phong>(diffusionSphere1, specularSphere1, 3);
 
     // Create a BRDF model for the sphere
-    //    auto rCubeMapSphere = make_shared<CubeMap>(centerSphere1, 720);
+    //    auto rCubeMapSphere = scene->create<CubeMap>(centerSphere1, 720);
     //    rCubeMapSphere->addImage(CubeMap::Faces::BACK, "./resources/nightSky2.png");
     //    rCubeMapSphere->setLink(CubeMap::Faces::FRONT, 0);
     //    rCubeMapSphere->setLink(CubeMap::Faces::UP, 0);
@@ -1462,7 +1477,7 @@ void createScene12(shared_ptr<Scene> scene)
     //    rBRDFSphere1->cubeMap(rCubeMapSphere);
 
     // Create a shader for the sphere
-    auto rShaderSphere1 = make_shared<Shader>(rBRDFSphere1, reflectionCoeff, refractionCoeff, scene);
+    auto rShaderSphere1 = scene->create<Shader>(rBRDFSphere1, reflectionCoeff, refractionCoeff, scene);
     rShaderSphere1->setReflectionCountMax(4);
     rSphere1->shader(rShaderSphere1);
 
@@ -1472,15 +1487,15 @@ void createScene12(shared_ptr<Scene> scene)
 
     // Create a second sphere
     const auto             centerSphere2 = Point{ -21.0, -5.0, 8.0 };
-    shared_ptr<Renderable> rSphere2      = make_shared<Sphere>(centerSphere2, 9.);
+    shared_ptr<Renderable> rSphere2      = scene->create<Sphere>(centerSphere2, 9.);
 
     // Create a BRDF model for the sphere
     const auto       diffusionSphere2 = Color{ 0.9, 1.0, 0.8 };
     const auto       specularSphere2  = Color{ 1.0 };
-    shared_ptr<BRDF> rBRDFSphere2     = make_shared<Phong>(diffusionSphere2, specularSphere2, 3);
+    shared_ptr<BRDF> rBRDFSphere2     = scene->create<Phong>(diffusionSphere2, specularSphere2, 3);
 
     // Create a shader for the second sphere
-    auto rShaderSphere2 = make_shared<Shader>(rBRDFSphere2, reflectionCoeff, refractionCoeff, scene);
+    auto rShaderSphere2 = scene->create<Shader>(rBRDFSphere2, reflectionCoeff, refractionCoeff, scene);
     rShaderSphere2->setReflectionCountMax(4);
     rSphere2->shader(rShaderSphere2);
 
@@ -1490,15 +1505,15 @@ void createScene12(shared_ptr<Scene> scene)
 
     // Create a transparent sphere for refraction
     const auto             centerSphere3 = Point{ 21.0, -5.0, 8.0 };
-    shared_ptr<Renderable> rSphere3      = make_shared<Sphere>(centerSphere3, 9.0);
+    shared_ptr<Renderable> rSphere3      = scene->create<Sphere>(centerSphere3, 9.0);
 
     // Create a BRDF model for the sphere
     const auto       diffusionSphere3 = Color{ 0.95, 0.88, 0.60 };
     const auto       specularSphere3  = Color{ 1.0 };
-    shared_ptr<BRDF> rBRDFSphere3     = make_shared<Phong>(diffusionSphere3, specularSphere3, 3);
+    shared_ptr<BRDF> rBRDFSphere3     = scene->create<Phong>(diffusionSphere3, specularSphere3, 3);
 
     // Create a shader for the third sphere
-    auto rShaderSphere3 = make_shared<Shader>(rBRDFSphere3, 0.6, 1.0, scene);
+    auto rShaderSphere3 = scene->create<Shader>(rBRDFSphere3, 0.6, 1.0, scene);
     rShaderSphere3->setReflectionCountMax(4);
     rSphere3->shader(rShaderSphere3);
 
@@ -1511,7 +1526,7 @@ void createScene12(shared_ptr<Scene> scene)
     ////////////
     const auto        light1Position = Point{ 0., 25.0, 50.0 };
     const auto        light1Color    = Color{ 30.0 };
-    shared_ptr<Light> rLight1        = make_shared<PunctualLight>(light1Position, light1Color);
+    shared_ptr<Light> rLight1        = scene->create<PunctualLight>(light1Position, light1Color);
     scene->add(rLight1);
 
     ////////////
@@ -1547,7 +1562,7 @@ void createScene12(shared_ptr<Scene> scene)
     ////////////////
     // BACKGROUND //
     ////////////////
-    //    auto rCubeMap = make_shared<CubeMap>(centerSphere1, 750);
+    //    auto rCubeMap = scene->create<CubeMap>(centerSphere1, 750);
     //
     //    rCubeMap->addImage(CubeMap::Faces::BACK, "./resources/nightSky2.png");
     //    rCubeMap->setLink(CubeMap::Faces::FRONT, 0);
@@ -1568,10 +1583,10 @@ void createScene13(shared_ptr<Scene> scene)
     // Create BRDF model for the cones
     Color            diffusion(255, 105, 0);
     Color            specular(1.0);
-    shared_ptr<BRDF> rBRDFCones = make_shared<Phong>(diffusion, specular, 3);
+    shared_ptr<BRDF> rBRDFCones = scene->create<Phong>(diffusion, specular, 3);
 
     // Create a shader for the cones
-    auto rShaderCones = make_shared<Shader>(rBRDFCones, 0.8, 1.0, scene, Shader::NONE);
+    auto rShaderCones = scene->create<Shader>(rBRDFCones, 0.8, 1.0, scene, Shader::NONE);
 
     scene->add(rBRDFCones, "BRDF cones ");
     scene->add(rShaderCones, "Shader cones ");
@@ -1593,10 +1608,10 @@ void createScene13(shared_ptr<Scene> scene)
         it->shader(rShaderCones);
 
     // Create BRDF model for the torus
-    shared_ptr<BRDF> rBRDFTorus = make_shared<Phong>(Color(255, 99, 71), Color(1.0), 3);
+    shared_ptr<BRDF> rBRDFTorus = scene->create<Phong>(Color(255, 99, 71), Color(1.0), 3);
 
     // Create a shader for the torus
-    auto rShaderTorus = make_shared<Shader>(rBRDFTorus, 1.8, 1.0, scene, Shader::NONE);
+    auto rShaderTorus = scene->create<Shader>(rBRDFTorus, 1.8, 1.0, scene, Shader::NONE);
 
     scene->add(rBRDFTorus, "BRDF torus ");
     scene->add(rShaderTorus, "Shader torus ");
@@ -1610,10 +1625,10 @@ void createScene13(shared_ptr<Scene> scene)
         it->shader(rShaderTorus);
 
     // Create a BRDF model for the table
-    shared_ptr<BRDF> rBRDFPyramid = make_shared<Phong>(Color(128, 128, 0), Color(1.0), 10);
+    shared_ptr<BRDF> rBRDFPyramid = scene->create<Phong>(Color(128, 128, 0), Color(1.0), 10);
 
     // Create a shader for the table
-    auto rShaderPyramid = make_shared<Shader>(rBRDFPyramid, 1.0, 1.0, scene, Shader::Material::TURBULANCE);
+    auto rShaderPyramid = scene->create<Shader>(rBRDFPyramid, 1.0, 1.0, scene, Shader::Material::TURBULANCE);
 
     scene->add(rBRDFPyramid, "BRDF pyramid ");
     scene->add(rShaderPyramid, "Shader pyramid ");
@@ -1629,10 +1644,10 @@ void createScene13(shared_ptr<Scene> scene)
 
 
     // Create a BRDF model for the table
-    shared_ptr<BRDF> rBRDFTable = make_shared<Phong>(Color(1.0), Color(1.0), 10);
+    shared_ptr<BRDF> rBRDFTable = scene->create<Phong>(Color(1.0), Color(1.0), 10);
 
     // Create a shader for the table
-    auto rShaderTable = make_shared<Shader>(rBRDFTable, 1.0, 1.0, scene, Shader::Material::MARBLE);
+    auto rShaderTable = scene->create<Shader>(rBRDFTable, 1.0, 1.0, scene, Shader::Material::MARBLE);
 
     scene->add(rBRDFTable, "BRDF table ");
     scene->add(rShaderTable, "Shader table ");
@@ -1661,15 +1676,15 @@ void createScene13(shared_ptr<Scene> scene)
 
     // Sphere with texture
     Point                  centerSphere(0.0, 6.7, 0.0);
-    shared_ptr<Renderable> rSphere1 = make_shared<Sphere>(centerSphere, 2.0);
+    shared_ptr<Renderable> rSphere1 = scene->create<Sphere>(centerSphere, 2.0);
 
     // Create a BRDF model for the sphere
     Color            diffusionSphere1(1.0);
     Color            specularSphere1(1.0);
-    shared_ptr<BRDF> rBRDFSphere1 = make_shared<Phong>(diffusionSphere1, specularSphere1, 8);
+    shared_ptr<BRDF> rBRDFSphere1 = scene->create<Phong>(diffusionSphere1, specularSphere1, 8);
 
 
-    auto rCubeMapDesert = make_shared<CubeMap>(Point(0.0), 260);  // 260
+    auto rCubeMapDesert = scene->create<CubeMap>(Point(0.0), 260);  // 260
 
     rCubeMapDesert->addImage(CubeMap::Faces::BACK, "./resources/Desert_back.png");
     rCubeMapDesert->addImage(CubeMap::Faces::FRONT, "./resources/Desert_front.png");
@@ -1685,7 +1700,7 @@ void createScene13(shared_ptr<Scene> scene)
     rBRDFSphere1->cubeMap(rCubeMapDesert);
 
     // Create a shader for the sphere
-    auto rShaderSphere1 = make_shared<Shader>(rBRDFSphere1, 1.0, 1.0, scene);
+    auto rShaderSphere1 = scene->create<Shader>(rBRDFSphere1, 1.0, 1.0, scene);
     rShaderSphere1->setReflectionCountMax(1);
     rSphere1->shader(rShaderSphere1);
 
@@ -1696,9 +1711,9 @@ void createScene13(shared_ptr<Scene> scene)
     // Mirror on the right wall
     double                 mirrorXPos = 10.0;
     shared_ptr<Renderable> rMirror1
-    = make_shared<Triangle>(Point(mirrorXPos, 4.0, -10.0), Point(mirrorXPos, 12.0, -10.0), Point(mirrorXPos, 12.0, 18.0));
+    = scene->create<Triangle>(Point(mirrorXPos, 4.0, -10.0), Point(mirrorXPos, 12.0, -10.0), Point(mirrorXPos, 12.0, 18.0));
     shared_ptr<Renderable> rMirror2
-    = make_shared<Triangle>(Point(mirrorXPos, 4.0, -10.0), Point(mirrorXPos, 12.0, 18.0), Point(mirrorXPos, 4.0, 18.0));
+    = scene->create<Triangle>(Point(mirrorXPos, 4.0, -10.0), Point(mirrorXPos, 12.0, 18.0), Point(mirrorXPos, 4.0, 18.0));
 
     const auto minusX = Vector(-1.0, 0.0, 0.0);
 
@@ -1711,10 +1726,10 @@ void createScene13(shared_ptr<Scene> scene)
     static_pointer_cast<Triangle>(rMirror2)->vertexNormals()[2] = minusX;
 
     // Create a BRDF model for the mirror
-    shared_ptr<BRDF> rBRDFMirror = make_shared<Phong>(Color(0.4, 0.4, 0.6), Color(1.0), 8);
+    shared_ptr<BRDF> rBRDFMirror = scene->create<Phong>(Color(0.4, 0.4, 0.6), Color(1.0), 8);
 
     // Create a shader for the mirror
-    auto rShaderMirror = make_shared<Shader>(rBRDFMirror, 20.0, 1.0, scene);
+    auto rShaderMirror = scene->create<Shader>(rBRDFMirror, 20.0, 1.0, scene);
     rShaderMirror->setReflectionCountMax(2);
 
     rMirror1->shader(rShaderMirror);
@@ -1731,7 +1746,7 @@ void createScene13(shared_ptr<Scene> scene)
     ////////////
     Point             light1Position(-3.0, 10.0, 20.0);
     Color             lightColor(20.0);
-    shared_ptr<Light> rLight1 = make_shared<PunctualLight>(light1Position, lightColor);
+    shared_ptr<Light> rLight1 = scene->create<PunctualLight>(light1Position, lightColor);
     scene->add(rLight1);
 
 
@@ -1777,10 +1792,10 @@ void createScene14(shared_ptr<Scene> scene)
     // Create BRDF model for the cones
     Color            diffusion(255, 105, 0);
     Color            specular(1.0);
-    shared_ptr<BRDF> rBRDFCones = make_shared<Phong>(diffusion, specular, 3);
+    shared_ptr<BRDF> rBRDFCones = scene->create<Phong>(diffusion, specular, 3);
 
     // Create a shader for the cones
-    auto rShaderCones = make_shared<Shader>(rBRDFCones, 0.8, 1.0, scene, Shader::NONE);
+    auto rShaderCones = scene->create<Shader>(rBRDFCones, 0.8, 1.0, scene, Shader::NONE);
 
     scene->add(rBRDFCones, "BRDF cones ");
     scene->add(rShaderCones, "Shader cones ");
@@ -1802,10 +1817,10 @@ void createScene14(shared_ptr<Scene> scene)
         it->shader(rShaderCones);
 
     // Create BRDF model for the torus
-    shared_ptr<BRDF> rBRDFTorus = make_shared<Phong>(Color(255, 99, 71), Color(1.0), 3);
+    shared_ptr<BRDF> rBRDFTorus = scene->create<Phong>(Color(255, 99, 71), Color(1.0), 3);
 
     // Create a shader for the torus
-    auto rShaderTorus = make_shared<Shader>(rBRDFTorus, 1.8, 1.0, scene, Shader::NONE);
+    auto rShaderTorus = scene->create<Shader>(rBRDFTorus, 1.8, 1.0, scene, Shader::NONE);
 
     scene->add(rBRDFTorus, "BRDF torus ");
     scene->add(rShaderTorus, "Shader torus ");
@@ -1819,10 +1834,10 @@ void createScene14(shared_ptr<Scene> scene)
         it->shader(rShaderTorus);
 
     // Create a BRDF model for the table
-    shared_ptr<BRDF> rBRDFPyramid = make_shared<Phong>(Color(128, 128, 0), Color(1.0), 10);
+    shared_ptr<BRDF> rBRDFPyramid = scene->create<Phong>(Color(128, 128, 0), Color(1.0), 10);
 
     // Create a shader for the table
-    auto rShaderPyramid = make_shared<Shader>(rBRDFPyramid, 1.0, 1.0, scene, Shader::Material::TURBULANCE);
+    auto rShaderPyramid = scene->create<Shader>(rBRDFPyramid, 1.0, 1.0, scene, Shader::Material::TURBULANCE);
 
     scene->add(rBRDFPyramid, "BRDF pyramid ");
     scene->add(rShaderPyramid, "Shader pyramid ");
@@ -1837,10 +1852,10 @@ void createScene14(shared_ptr<Scene> scene)
         it->shader(rShaderPyramid);
 
 
-    shared_ptr<BRDF> rBRDFBackPyramid = make_shared<Phong>(Color(0, 255, 255), Color(1.0), 10);
+    shared_ptr<BRDF> rBRDFBackPyramid = scene->create<Phong>(Color(0, 255, 255), Color(1.0), 10);
 
     // Create a shader for the table
-    auto rShaderBackPyramid = make_shared<Shader>(rBRDFBackPyramid, 1.0, 1.0, scene, Shader::Material::BUMP);
+    auto rShaderBackPyramid = scene->create<Shader>(rBRDFBackPyramid, 1.0, 1.0, scene, Shader::Material::BUMP);
 
     scene->add(rBRDFBackPyramid, "BRDF pyramid in the background ");
     scene->add(rShaderBackPyramid, "Shader pyramid in the background ");
@@ -1851,10 +1866,10 @@ void createScene14(shared_ptr<Scene> scene)
 
 
     // Create a BRDF model for the table
-    shared_ptr<BRDF> rBRDFTable = make_shared<Phong>(Color(1.0), Color(1.0), 10);
+    shared_ptr<BRDF> rBRDFTable = scene->create<Phong>(Color(1.0), Color(1.0), 10);
 
     // Create a shader for the table
-    auto rShaderTable = make_shared<Shader>(rBRDFTable, 1.0, 1.0, scene, Shader::Material::MARBLE);
+    auto rShaderTable = scene->create<Shader>(rBRDFTable, 1.0, 1.0, scene, Shader::Material::MARBLE);
 
     scene->add(rBRDFTable, "BRDF table ");
     scene->add(rShaderTable, "Shader table ");
@@ -1883,15 +1898,15 @@ void createScene14(shared_ptr<Scene> scene)
 
     // Sphere with texture
     Point                  centerSphere(.0, 6.7, 0.0);
-    shared_ptr<Renderable> rSphere1 = make_shared<Sphere>(centerSphere, 2.0);
+    shared_ptr<Renderable> rSphere1 = scene->create<Sphere>(centerSphere, 2.0);
 
     // Create a BRDF model for the sphere
     Color            diffusionSphere1(0.1);
     Color            specularSphere1(0.1);
-    shared_ptr<BRDF> rBRDFSphere1 = make_shared<Phong>(diffusionSphere1, specularSphere1, 8);
+    shared_ptr<BRDF> rBRDFSphere1 = scene->create<Phong>(diffusionSphere1, specularSphere1, 8);
 
     // Create a shader for the sphere
-    auto rShaderSphere1 = make_shared<Shader>(rBRDFSphere1, 1.0, 2.4, scene);
+    auto rShaderSphere1 = scene->create<Shader>(rBRDFSphere1, 1.0, 2.4, scene);
     rShaderSphere1->setReflectionCountMax(1);
     rSphere1->shader(rShaderSphere1);
 
@@ -1905,16 +1920,16 @@ void createScene14(shared_ptr<Scene> scene)
     ////////////
     Point             light1Position(0.0, 20.0, 10.0);
     Color             lightColor(20.0);
-    shared_ptr<Light> rLight1 = make_shared<PunctualLight>(light1Position, lightColor);
+    shared_ptr<Light> rLight1 = scene->create<PunctualLight>(light1Position, lightColor);
     scene->add(rLight1);
 
 
     Point             light2Position(-5.0, 10.0, 10.0);
-    shared_ptr<Light> rLight2 = make_shared<PunctualLight>(light2Position, lightColor);
+    shared_ptr<Light> rLight2 = scene->create<PunctualLight>(light2Position, lightColor);
     scene->add(rLight2);
 
     Point             light3Position(5.0, 10.0, 10.0);
-    shared_ptr<Light> rLight3 = make_shared<PunctualLight>(light3Position, lightColor);
+    shared_ptr<Light> rLight3 = scene->create<PunctualLight>(light3Position, lightColor);
     scene->add(rLight3);
 
 
@@ -1932,7 +1947,7 @@ void createScene14(shared_ptr<Scene> scene)
     scene->add(move(camera));
 
 
-    auto rCubeMapBckGrd = make_shared<CubeMap>(Point(0.0), 260);  // 260
+    auto rCubeMapBckGrd = scene->create<CubeMap>(Point(0.0), 260);  // 260
 
     rCubeMapBckGrd->addImage(CubeMap::Faces::BACK, "./resources/Desert_back.png");
     rCubeMapBckGrd->addImage(CubeMap::Faces::FRONT, "./resources/Desert_front.png");
@@ -1951,9 +1966,9 @@ void createFloor(shared_ptr<Scene> scene, const FloorParameters& param)
     double deep = -1.0 * param.deep;
 
     shared_ptr<Renderable> rTriangleZ1
-    = make_shared<Triangle>(Point(-param.size, deep, -param.size), Point(-param.size, deep, param.size), Point(param.size, deep, param.size));
+    = scene->create<Triangle>(Point(-param.size, deep, -param.size), Point(-param.size, deep, param.size), Point(param.size, deep, param.size));
     shared_ptr<Renderable> rTriangleZ2
-    = make_shared<Triangle>(Point(-param.size, deep, -param.size), Point(param.size, deep, param.size), Point(param.size, deep, -param.size));
+    = scene->create<Triangle>(Point(-param.size, deep, -param.size), Point(param.size, deep, param.size), Point(param.size, deep, -param.size));
 
     const auto up = Vector(0.0, 1.0, 0.0);
 
@@ -1966,12 +1981,12 @@ void createFloor(shared_ptr<Scene> scene, const FloorParameters& param)
     static_pointer_cast<Triangle>(rTriangleZ2)->vertexNormals()[2] = up;
 
     // Create BRDF model for the triangle
-    shared_ptr<BRDF> bRDFTriangle = make_shared<Phong>(param.diffusion, param.specular, 3);
+    shared_ptr<BRDF> bRDFTriangle = scene->create<Phong>(param.diffusion, param.specular, 3);
     bRDFTriangle->ambient(Color(0.0));
 
     if (param.floorTexturePath.compare("no_texture"))
     {
-        auto rCubeMapFloor = make_shared<CubeMap>(Point(0.0, -4.0, 0.0), param.size * 2.0);
+        auto rCubeMapFloor = scene->create<CubeMap>(Point(0.0, -4.0, 0.0), param.size * 2.0);
 
         rCubeMapFloor->addImage(CubeMap::Faces::BACK, param.floorTexturePath);
         rCubeMapFloor->setLink(CubeMap::Faces::FRONT, 0);
@@ -1989,7 +2004,7 @@ void createFloor(shared_ptr<Scene> scene, const FloorParameters& param)
 
 
     // Create a shader for the triangle
-    auto shaderTriangle = make_shared<Shader>(bRDFTriangle, param.reflectionCoeff, param.refractionCoeff, scene);
+    auto shaderTriangle = scene->create<Shader>(bRDFTriangle, param.reflectionCoeff, param.refractionCoeff, scene);
     shaderTriangle->setReflectionCountMax(param.maxReflection);
 
     rTriangleZ1->shader(shaderTriangle);
@@ -2013,8 +2028,8 @@ void createRoom(shared_ptr<Scene> scene, const RoomParameters& param)
     const Point seven(zero.x() + param.dimensions.x(), zero.y() + param.dimensions.y(), zero.z());
 
     // Create floor
-    shared_ptr<Renderable> rTriFloor1 = make_shared<Triangle>(zero, one, two);
-    shared_ptr<Renderable> rTriFloor2 = make_shared<Triangle>(zero, two, three);
+    shared_ptr<Renderable> rTriFloor1 = scene->create<Triangle>(zero, one, two);
+    shared_ptr<Renderable> rTriFloor2 = scene->create<Triangle>(zero, two, three);
 
     const auto up = Vector(0.0, 1.0, 0.0);
 
@@ -2026,15 +2041,15 @@ void createRoom(shared_ptr<Scene> scene, const RoomParameters& param)
     static_pointer_cast<Triangle>(rTriFloor2)->vertexNormals()[1] = up;
     static_pointer_cast<Triangle>(rTriFloor2)->vertexNormals()[2] = up;
 
-    Point middleOfFace((zero.x() + one.x() + two.x() + three.x()) * 0.25,
-                       (zero.y() + one.y() + two.y() + three.y()) * 0.25,
-                       (zero.z() + one.z() + two.z() + three.z()) * 0.25);
+    Point middleOfFace((zero.x() + one.x() + two.x() + three.x()) * Real{ 0.25 },
+                       (zero.y() + one.y() + two.y() + three.y()) * Real{ 0.25 },
+                       (zero.z() + one.z() + two.z() + three.z()) * Real{ 0.25 });
 
-    shared_ptr<BRDF> rBRDF_Floor = make_shared<Phong>(param.diffusion, param.specular, 3);
+    shared_ptr<BRDF> rBRDF_Floor = scene->create<Phong>(param.diffusion, param.specular, 3);
 
     if (param.floorTexturePath.compare("no_texture"))
     {
-        auto rCubeMapFloor = make_shared<CubeMap>(middleOfFace, max(param.dimensions.x(), param.dimensions.z()));
+        auto rCubeMapFloor = scene->create<CubeMap>(middleOfFace, max(param.dimensions.x(), param.dimensions.z()));
 
         rCubeMapFloor->addImage(CubeMap::Faces::BACK, param.floorTexturePath);
         rCubeMapFloor->setLink(CubeMap::Faces::FRONT, 0);
@@ -2050,7 +2065,7 @@ void createRoom(shared_ptr<Scene> scene, const RoomParameters& param)
         rBRDF_Floor->cubeMap(rCubeMapFloor);
     }
 
-    auto rShaderFloor = make_shared<Shader>(rBRDF_Floor, param.reflectionCoeff, param.refractionCoeff, scene);
+    auto rShaderFloor = scene->create<Shader>(rBRDF_Floor, param.reflectionCoeff, param.refractionCoeff, scene);
     rShaderFloor->setReflectionCountMax(param.maxReflection);
 
     rTriFloor1->shader(rShaderFloor);
@@ -2063,8 +2078,8 @@ void createRoom(shared_ptr<Scene> scene, const RoomParameters& param)
 
 
     // Create left wall
-    shared_ptr<Renderable> rTriLeftWall1 = make_shared<Triangle>(zero, four, five);
-    shared_ptr<Renderable> rTriLeftWall2 = make_shared<Triangle>(zero, five, one);
+    shared_ptr<Renderable> rTriLeftWall1 = scene->create<Triangle>(zero, four, five);
+    shared_ptr<Renderable> rTriLeftWall2 = scene->create<Triangle>(zero, five, one);
 
     const auto right = Vector(1.0, 0.0, 0.0);
 
@@ -2076,16 +2091,16 @@ void createRoom(shared_ptr<Scene> scene, const RoomParameters& param)
     static_pointer_cast<Triangle>(rTriLeftWall2)->vertexNormals()[1] = right;
     static_pointer_cast<Triangle>(rTriLeftWall2)->vertexNormals()[2] = right;
 
-    middleOfFace.x((zero.x() + one.x() + four.x() + five.x()) * 0.25);
-    middleOfFace.y((zero.y() + one.y() + four.y() + five.y()) * 0.25);
-    middleOfFace.z((zero.z() + one.z() + four.z() + five.z()) * 0.25);
+    middleOfFace.x((zero.x() + one.x() + four.x() + five.x()) * Real{ 0.25 });
+    middleOfFace.y((zero.y() + one.y() + four.y() + five.y()) * Real{ 0.25 });
+    middleOfFace.z((zero.z() + one.z() + four.z() + five.z()) * Real{ 0.25 });
 
-    shared_ptr<BRDF> rBRDFLeftWall = make_shared<Phong>(param.diffusion, param.specular, 3);
+    shared_ptr<BRDF> rBRDFLeftWall = scene->create<Phong>(param.diffusion, param.specular, 3);
     rBRDFLeftWall->ambient(Color(0.1));
 
     if (param.wallLeftTexturePath.compare("no_texture"))
     {
-        auto rCubeMapLeftWall = make_shared<CubeMap>(middleOfFace, max(param.dimensions.y(), param.dimensions.z()));
+        auto rCubeMapLeftWall = scene->create<CubeMap>(middleOfFace, max(param.dimensions.y(), param.dimensions.z()));
 
         rCubeMapLeftWall->addImage(CubeMap::Faces::BACK, param.wallLeftTexturePath);
         rCubeMapLeftWall->setLink(CubeMap::Faces::FRONT, 0);
@@ -2101,7 +2116,7 @@ void createRoom(shared_ptr<Scene> scene, const RoomParameters& param)
         rBRDFLeftWall->cubeMap(rCubeMapLeftWall);
     }
 
-    auto rShaderLeftWall = make_shared<Shader>(rBRDFLeftWall, param.reflectionCoeff, param.refractionCoeff, scene);
+    auto rShaderLeftWall = scene->create<Shader>(rBRDFLeftWall, param.reflectionCoeff, param.refractionCoeff, scene);
     rShaderLeftWall->setReflectionCountMax(param.maxReflection);
 
     rTriLeftWall1->shader(rShaderLeftWall);
@@ -2113,8 +2128,8 @@ void createRoom(shared_ptr<Scene> scene, const RoomParameters& param)
     scene->add(rShaderLeftWall, string("shader of the triangles of the left wall"));
 
     // Create back wall
-    shared_ptr<Renderable> rTriBackWall1 = make_shared<Triangle>(zero, three, four);
-    shared_ptr<Renderable> rTriBackWall2 = make_shared<Triangle>(four, three, seven);
+    shared_ptr<Renderable> rTriBackWall1 = scene->create<Triangle>(zero, three, four);
+    shared_ptr<Renderable> rTriBackWall2 = scene->create<Triangle>(four, three, seven);
 
     const auto forward = Vector(0.0, 0.0, 1.0);
 
@@ -2126,16 +2141,16 @@ void createRoom(shared_ptr<Scene> scene, const RoomParameters& param)
     static_pointer_cast<Triangle>(rTriBackWall2)->vertexNormals()[1] = forward;
     static_pointer_cast<Triangle>(rTriBackWall2)->vertexNormals()[2] = forward;
 
-    middleOfFace.x((zero.x() + three.x() + four.x() + seven.x()) * 0.25);
-    middleOfFace.y((zero.y() + three.y() + four.y() + seven.y()) * 0.25);
-    middleOfFace.z((zero.z() + three.z() + four.z() + seven.z()) * 0.25);
+    middleOfFace.x((zero.x() + three.x() + four.x() + seven.x()) * Real{ 0.25 });
+    middleOfFace.y((zero.y() + three.y() + four.y() + seven.y()) * Real{ 0.25 });
+    middleOfFace.z((zero.z() + three.z() + four.z() + seven.z()) * Real{ 0.25 });
 
-    shared_ptr<BRDF> rBRDFBackWall = make_shared<Phong>(param.diffusion, param.specular, 3);
+    shared_ptr<BRDF> rBRDFBackWall = scene->create<Phong>(param.diffusion, param.specular, 3);
     rBRDFBackWall->ambient(Color(0.1));
 
     if (param.wallBackTexturePath.compare("no_texture"))
     {
-        auto rCubeMapBackWall = make_shared<CubeMap>(middleOfFace, max(param.dimensions.x(), param.dimensions.y()));
+        auto rCubeMapBackWall = scene->create<CubeMap>(middleOfFace, max(param.dimensions.x(), param.dimensions.y()));
 
         rCubeMapBackWall->addImage(CubeMap::Faces::BACK, param.wallBackTexturePath);
         rCubeMapBackWall->setLink(CubeMap::Faces::FRONT, 0);
@@ -2151,7 +2166,7 @@ void createRoom(shared_ptr<Scene> scene, const RoomParameters& param)
         rBRDFBackWall->cubeMap(rCubeMapBackWall);
     }
 
-    auto rShaderBackWall = make_shared<Shader>(rBRDFBackWall, param.reflectionCoeff, param.refractionCoeff, scene);
+    auto rShaderBackWall = scene->create<Shader>(rBRDFBackWall, param.reflectionCoeff, param.refractionCoeff, scene);
     rShaderBackWall->setReflectionCountMax(param.maxReflection);
 
     rTriBackWall1->shader(rShaderBackWall);
@@ -2163,8 +2178,8 @@ void createRoom(shared_ptr<Scene> scene, const RoomParameters& param)
     scene->add(rShaderBackWall, string("shader of the triangles of the back wall"));
 
     // Create right wall
-    shared_ptr<Renderable> rTriRightWall1 = make_shared<Triangle>(three, two, six);
-    shared_ptr<Renderable> rTriRightWall2 = make_shared<Triangle>(three, six, seven);
+    shared_ptr<Renderable> rTriRightWall1 = scene->create<Triangle>(three, two, six);
+    shared_ptr<Renderable> rTriRightWall2 = scene->create<Triangle>(three, six, seven);
 
     const auto left = Vector(-1.0, 0.0, 0.0);
 
@@ -2176,16 +2191,16 @@ void createRoom(shared_ptr<Scene> scene, const RoomParameters& param)
     static_pointer_cast<Triangle>(rTriRightWall2)->vertexNormals()[1] = left;
     static_pointer_cast<Triangle>(rTriRightWall2)->vertexNormals()[2] = left;
 
-    middleOfFace.x((two.x() + three.x() + six.x() + seven.x()) * 0.25);
-    middleOfFace.y((two.y() + three.y() + six.y() + seven.y()) * 0.25);
-    middleOfFace.z((two.z() + three.z() + six.z() + seven.z()) * 0.25);
+    middleOfFace.x((two.x() + three.x() + six.x() + seven.x()) * Real{ 0.25 });
+    middleOfFace.y((two.y() + three.y() + six.y() + seven.y()) * Real{ 0.25 });
+    middleOfFace.z((two.z() + three.z() + six.z() + seven.z()) * Real{ 0.25 });
 
-    shared_ptr<BRDF> rBRDFRightWall = make_shared<Phong>(param.diffusion, param.specular, 3);
+    shared_ptr<BRDF> rBRDFRightWall = scene->create<Phong>(param.diffusion, param.specular, 3);
     rBRDFRightWall->ambient(Color(0.1));
 
     if (param.wallRightTexturePath.compare("no_texture"))
     {
-        auto rCubeMapRightWall = make_shared<CubeMap>(middleOfFace, max(param.dimensions.y(), param.dimensions.z()));
+        auto rCubeMapRightWall = scene->create<CubeMap>(middleOfFace, max(param.dimensions.y(), param.dimensions.z()));
 
         rCubeMapRightWall->addImage(CubeMap::Faces::BACK, param.wallRightTexturePath);
         rCubeMapRightWall->setLink(CubeMap::Faces::FRONT, 0);
@@ -2201,7 +2216,7 @@ void createRoom(shared_ptr<Scene> scene, const RoomParameters& param)
         rBRDFRightWall->cubeMap(rCubeMapRightWall);
     }
 
-    auto rShaderRightWall = make_shared<Shader>(rBRDFRightWall, param.reflectionCoeff, param.refractionCoeff, scene);
+    auto rShaderRightWall = scene->create<Shader>(rBRDFRightWall, param.reflectionCoeff, param.refractionCoeff, scene);
     rShaderRightWall->setReflectionCountMax(param.maxReflection);
 
     rTriRightWall1->shader(rShaderRightWall);
@@ -2213,8 +2228,8 @@ void createRoom(shared_ptr<Scene> scene, const RoomParameters& param)
     scene->add(rShaderRightWall, string("shader of the triangles of the right wall"));
 
     // Create roof
-    shared_ptr<Renderable> rTriCeiling1 = make_shared<Triangle>(four, five, six);
-    shared_ptr<Renderable> rTriCeiling2 = make_shared<Triangle>(four, six, seven);
+    shared_ptr<Renderable> rTriCeiling1 = scene->create<Triangle>(four, five, six);
+    shared_ptr<Renderable> rTriCeiling2 = scene->create<Triangle>(four, six, seven);
 
     const auto down = Vector(0.0, -1.0, 0.0);
 
@@ -2226,16 +2241,16 @@ void createRoom(shared_ptr<Scene> scene, const RoomParameters& param)
     static_pointer_cast<Triangle>(rTriCeiling2)->vertexNormals()[1] = down;
     static_pointer_cast<Triangle>(rTriCeiling2)->vertexNormals()[2] = down;
 
-    middleOfFace.x((four.x() + five.x() + six.x() + seven.x()) * 0.25);
-    middleOfFace.y((four.y() + five.y() + six.y() + seven.y()) * 0.25);
-    middleOfFace.z((four.z() + five.z() + six.z() + seven.z()) * 0.25);
+    middleOfFace.x((four.x() + five.x() + six.x() + seven.x()) * Real{ 0.25 });
+    middleOfFace.y((four.y() + five.y() + six.y() + seven.y()) * Real{ 0.25 });
+    middleOfFace.z((four.z() + five.z() + six.z() + seven.z()) * Real{ 0.25 });
 
-    shared_ptr<BRDF> rBRDFCeiling = make_shared<Phong>(param.diffusion, param.specular, 13);
+    shared_ptr<BRDF> rBRDFCeiling = scene->create<Phong>(param.diffusion, param.specular, 13);
     rBRDFCeiling->ambient(Color(0.1));
 
     if (param.ceilingTexturePath.compare("no_texture"))
     {
-        auto rCubeMapCeiling = make_shared<CubeMap>(middleOfFace, max(param.dimensions.x(), param.dimensions.z()));
+        auto rCubeMapCeiling = scene->create<CubeMap>(middleOfFace, max(param.dimensions.x(), param.dimensions.z()));
 
         rCubeMapCeiling->addImage(CubeMap::Faces::DOWN, param.ceilingTexturePath);
         rCubeMapCeiling->setLink(CubeMap::Faces::FRONT, 0);
@@ -2252,7 +2267,7 @@ void createRoom(shared_ptr<Scene> scene, const RoomParameters& param)
     }
 
 
-    auto rShaderCeiling = make_shared<Shader>(rBRDFCeiling, param.reflectionCoeff, param.refractionCoeff, scene);
+    auto rShaderCeiling = scene->create<Shader>(rBRDFCeiling, param.reflectionCoeff, param.refractionCoeff, scene);
     rShaderCeiling->setReflectionCountMax(param.maxReflection);
 
     rTriCeiling1->shader(rShaderCeiling);
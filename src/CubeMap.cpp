@@ -13,21 +13,27 @@
 #include <memory>
 #include <tuple>
 
+#include "AssetLoader.hpp"
 #include "Color.hpp"
 #include "Image.hpp"
 #include "Point.hpp"
 #include "Ray.hpp"
+#include "Trace.hpp"
 
 using std::make_tuple;
-using std::make_unique;
+using std::make_shared;
 using std::move;
 using std::tuple;
 
+using LCNS::AssetLoader;
 using LCNS::Color;
 using LCNS::CubeMap;
 using LCNS::Image;
 using LCNS::Point;
 using LCNS::Ray;
+using LCNS::Real;
+using LCNS::toReal;
+using LCNS::TraceScope;
 
 CubeMap::CubeMap(void)
 : _center(0.0)
@@ -46,12 +52,20 @@ CubeMap::CubeMap(const Point& center, double size)
 
 void CubeMap::addImage(Faces face, const std::string& path)
 {
-    auto image = make_unique<Image>(path);
+    TraceScope traceScope("CubeMap::addImage", "scene");
+
+    auto image = make_shared<Image>();
+    _loads.push_back(AssetLoader::loadImage(image, path));
     _images.push_back(move(image));
 
     setLink(face, static_cast<unsigned int>(_images.size() - 1));
 }
 
+void CubeMap::waitForImages(void)
+{
+    AssetLoader::wait(_loads);
+}
+
 void CubeMap::setLink(Faces face, unsigned int imageIdx)
 {
     _faceImageIDs[face] = imageIdx;
@@ -102,25 +116,25 @@ void CubeMap::interpolationMethod(Image::InterpolationMethod value) noexcept
 
 tuple<CubeMap::Faces, double, double> CubeMap::_intersect(const Ray& ray) const
 {
-    const double radius  = _size * 0.5;
-    const double invSize = 1.0 / _size;
-    Vector       max(_center.x() + radius, _center.y() + radius, _center.z() + radius);
-    Vector       min(_center.x() - radius, _center.y() - radius, _center.z() - radius);
+    const Real radius  = toReal(_size * 0.5);
+    const Real invSize = toReal(1.0 / _size);
+    Vector     max(_center.x() + radius, _center.y() + radius, _center.z() + radius);
+    Vector     min(_center.x() - radius, _center.y() - radius, _center.z() - radius);
 
     // Need to add/substract an epsilon value to min and max because of numerical error when comparing them with p coordinate values.
-    const Vector epsilon(0.00001);
+    const Vector epsilon(toReal(0.00001));
 
     min -= epsilon;
     max += epsilon;
 
     // Check if ray is not parallel to the XY plane
-    if (ray.direction().z() > 0.0)
+    if (ray.direction().z() > Real{ 0.0 })
     {
         // Front plane: Calculate the lenght the ray when intersecting the plane
-        const double length = (max.z() - ray.origin().z()) / ray.direction().z();
+        const Real length = (max.z() - ray.origin().z()) / ray.direction().z();
 
         // Front plane: Calculate the coordinates of the intersection point
-        const Point p = ray.origin() + ray.direction() * length;
+        const Point p = ray.origin().offset(ray.direction(), length);
 
         // Front plane: Check if the point in the plane is really inside the rectangle
         if (p.x() >= min.x() && p.x() <= max.x() && p.y() >= min.y() && p.y() <= max.y())
@@ -129,22 +143,22 @@ tuple<CubeMap::Faces, double, double> CubeMap::_intersect(const Ray& ray) const
         }
     }
 
-    if (ray.direction().z() < 0.0)
+    if (ray.direction().z() < Real{ 0.0 })
     {
         // Same for back plane:
-        const double length = (min.z() - ray.origin().z()) / ray.direction().z();
-        const Point  p      = ray.origin() + ray.direction() * length;
+        const Real  length = (min.z() - ray.origin().z()) / ray.direction().z();
+        const Point p      = ray.origin().offset(ray.direction(), length);
         if (p.x() >= min.x() && p.x() <= max.x() && p.y() >= min.y() && p.y() <= max.y())
         {
             return make_tuple(Faces::BACK, (p.x() - min.x()) * invSize, (p.y() - min.y()) * invSize);
         }
     }
 
-    if (ray.direction().y() > 0.0)  // Check if the ray is not parallel to the XZ plane
+    if (ray.direction().y() > Real{ 0.0 })  // Check if the ray is not parallel to the XZ plane
     {
         // Same for up plane:
-        const double length = (max.y() - ray.origin().y()) / ray.direction().y();
-        const Point  p      = ray.origin() + ray.direction() * length;
+        const Real  length = (max.y() - ray.origin().y()) / ray.direction().y();
+        const Point p      = ray.origin().offset(ray.direction(), length);
 
         if (p.x() >= min.x() && p.x() <= max.x() && p.z() >= min.z() && p.z() <= max.z())
         {
@@ -152,33 +166,33 @@ tuple<CubeMap::Faces, double, double> CubeMap::_intersect(const Ray& ray) const
         }
     }
 
-    if (ray.direction().y() < 0.0)
+    if (ray.direction().y() < Real{ 0.0 })
     {
         // Same for down plane:
-        const double length = (min.y() - ray.origin().y()) / ray.direction().y();
-        const Point  p      = ray.origin() + ray.direction() * length;
+        const Real  length = (min.y() - ray.origin().y()) / ray.direction().y();
+        const Point p      = ray.origin().offset(ray.direction(), length);
         if (p.x() >= min.x() && p.x() <= max.x() && p.z() >= min.z() && p.z() <= max.z())
         {
             return make_tuple(Faces::DOWN, (p.x() - min.x()) * invSize, (p.z() - min.z()) * invSize);
         }
     }
 
-    if (ray.direction().x() > 0.0)  // Check if the ray is not parallel to the YZ plane
+    if (ray.direction().x() > Real{ 0.0 })  // Check if the ray is not parallel to the YZ plane
     {
         // Same for right plane:
-        const double length = (max.x() - ray.origin().x()) / ray.direction().x();
-        const Point  p      = ray.origin() + ray.direction() * length;
+        const Real  length = (max.x() - ray.origin().x()) / ray.direction().x();
+        const Point p      = ray.origin().offset(ray.direction(), length);
         if (p.y() >= min.y() && p.y() <= max.y() && p.z() >= min.z() && p.z() <= max.z())
         {
             return make_tuple(Faces::RIGHT, (p.z() - min.z()) * invSize, (p.y() - min.y()) * invSize);
         }
     }
 
-    if (ray.direction().x() < 0.0)
+    if (ray.direction().x() < Real{ 0.0 })
     {
         // Same for left plane:
-        const double length = (min.x() - ray.origin().x()) / ray.direction().x();
-        const Point  p      = ray.origin() + ray.direction() * length;
+        const Real  length = (min.x() - ray.origin().x()) / ray.direction().x();
+        const Point p      = ray.origin().offset(ray.direction(), length);
         if (p.y() >= min.y() && p.y() <= max.y() && p.z() >= min.z() && p.z() <= max.z())
         {
             return make_tuple(Faces::LEFT, (p.z() - min.z()) * invSize, (p.y() - min.y()) * invSize);
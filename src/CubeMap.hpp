@@ -10,6 +10,7 @@
 
 #pragma once
 
+#include <future>
 #include <memory>
 #include <vector>
 #include <map>
@@ -54,9 +55,12 @@ namespace LCNS
         /// Destructor
         ~CubeMap(void) = default;
 
-        /// Add an image to a face of the cube
+        /// Add an image to a face of the cube, it is loaded in the background until the scene is committed (see AssetLoader)
         void addImage(Faces face, const std::string& path);
 
+        /// Wait for the images still loading, throws if one of them cannot be read (done by Scene::commit)
+        void waitForImages(void);
+
         /// Specify which image correspond to each face
         void setLink(Faces face, unsigned int imageIdx);
 
@@ -86,7 +90,8 @@ namespace LCNS
         std::tuple<Faces, double, double> _intersect(const Ray& ray) const;
 
     private:
-        std::vector<std::unique_ptr<Image>> _images;
+        std::vector<std::shared_ptr<Image>>   _images;
+        std::vector<std::shared_future<void>> _loads;
 
         std::map<Faces, unsigned int> _faceImageIDs
         = { { Faces::UP, 0 }, { Faces::DOWN, 1 }, { Faces::LEFT, 2 }, { Faces::RIGHT, 3 }, { Faces::BACK, 4 }, { Faces::FRONT, 5 } };
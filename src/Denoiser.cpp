@@ -0,0 +1,321 @@
+//===============================================================================================//
+/*!
+ *  \file      Denoiser.cpp
+ *  \author    Loïc Corenthy
+ *  \version   1.2
+ *  \date      19/10/2026
+ *  \copyright (c) 2026 Loïc Corenthy. All rights reserved.
+ */
+//===============================================================================================//
+
+#include "Denoiser.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdlib>
+#include <functional>
+#include <thread>
+#include <utility>
+
+#include "AOVBuffer.hpp"
+#include "Buffer.hpp"
+#include "Color.hpp"
+#include "Trace.hpp"
+
+using std::abs;
+using std::array;
+using std::cref;
+using std::exp;
+using std::max;
+using std::min;
+using std::pow;
+using std::ref;
+using std::size_t;
+using std::sqrt;
+using std::swap;
+using std::thread;
+using std::vector;
+
+using LCNS::AOVBuffer;
+using LCNS::Buffer;
+using LCNS::Color;
+using LCNS::Denoiser;
+using LCNS::Tile;
+using LCNS::TraceScope;
+
+namespace
+{
+    /// Weights of the B3 spline kernel of the à-trous wavelet, from -2 to 2 taps away
+    constexpr array<float, 5> kernel = { 1.0f / 16.0f, 1.0f / 4.0f, 3.0f / 8.0f, 1.0f / 4.0f, 1.0f / 16.0f };
+
+    /// Get the squared distance between two colors
+    float squaredDistance(const array<float, 3>& lhs, const array<float, 3>& rhs) noexcept
+    {
+        const float red   = lhs[0] - rhs[0];
+        const float green = lhs[1] - rhs[1];
+        const float blue  = lhs[2] - rhs[2];
+
+        return red * red + green * green + blue * blue;
+    }
+
+    /// Get the luminance of a color (Rec. 709)
+    float luminance(const array<float, 3>& color) noexcept
+    {
+        return 0.2126f * color[0] + 0.7152f * color[1] + 0.0722f * color[2];
+    }
+
+}  // namespace
+
+Denoiser::Denoiser(unsigned int iterationCount) noexcept
+: _iterationCount(iterationCount)
+{
+    assert(iterationCount <= maxIterationCount && "Too many iterations for the denoiser");
+}
+
+void Denoiser::denoise(Buffer& buffer, const AOVBuffer& aovs, const Tile& window, unsigned int threadCount) const
+{
+    TraceScope traceScope("Denoiser::denoise", "render", "pixels", window.pixelCount(), "iterations", _iterationCount);
+
+    assert(aovs.width() == buffer.width() && aovs.height() == buffer.height() && "The AOVs must have the dimensions of the buffer");
+    assert(window.x + window.width <= buffer.width() && window.y + window.height <= buffer.height() && "The window must be inside the buffer");
+
+    if (_iterationCount == 0u || window.pixelCount() == 0u)
+        return;
+
+    const auto guides = _guides(aovs, window);
+
+    Frame frame;
+    frame.colors.resize(window.pixelCount());
+    frame.variances.resize(window.pixelCount());
+
+    for (unsigned int j = 0; j < window.height; ++j)
+    {
+        for (unsigned int i = 0; i < window.width; ++i)
+        {
+            const Color  color = buffer.pixel(window.x + i, window.y + j);
+            const double red   = color.red();
+            const double green = color.green();
+            const double blue  = color.blue();
+
+            frame.colors[j * window.width + i] = { static_cast<float>(red), static_cast<float>(green), static_cast<float>(blue) };
+        }
+    }
+
+    _estimateVariances(frame, guides, window);
+
+    // The iterations depend on the whole result of the previous one, the threads only share the rows of an iteration
+    threadCount = max(1u, min(threadCount, window.height));
+
+    Frame filtered = frame;
+    for (unsigned int iteration = 0; iteration < _iterationCount; ++iteration)
+    {
+        const unsigned int step = 1u << iteration;
+
+        if (threadCount == 1u)
+        {
+            _iterate(frame, filtered, guides, window, step, 0u, window.height);
+        }
+        else
+        {
+            vector<thread> threads;
+            threads.reserve(threadCount);
+
+            for (unsigned int t = 0; t < threadCount; ++t)
+            {
+                const unsigned int firstRow = window.height * t / threadCount;
+                const unsigned int lastRow  = window.height * (t + 1u) / threadCount;
+                threads.emplace_back(&Denoiser::_iterate, cref(frame), ref(filtered), cref(guides), cref(window), step, firstRow, lastRow);
+            }
+
+            for (auto& worker : threads)
+                worker.join();
+        }
+
+        swap(frame, filtered);
+    }
+
+    // Half a step is added for the buffer to round the colors to the nearest 8 bits value instead of truncating them
+    const Color halfStep(0.5 / 255.0);
+    for (unsigned int j = 0; j < window.height; ++j)
+    {
+        for (unsigned int i = 0; i < window.width; ++i)
+        {
+            const auto& color = frame.colors[j * window.width + i];
+            buffer.pixel(window.x + i, window.y + j, Color(color[0], color[1], color[2]) + halfStep);
+        }
+    }
+}
+
+vector<Denoiser::Guide> Denoiser::_guides(const AOVBuffer& aovs, const Tile& window)
+{
+    vector<Guide> guides(window.pixelCount());
+
+    for (unsigned int j = 0; j < window.height; ++j)
+    {
+        for (unsigned int i = 0; i < window.width; ++i)
+        {
+            auto& guide = guides[j * window.width + i];
+
+            guide.normal   = aovs.normal(window.x + i, window.y + j);
+            guide.albedo   = aovs.albedo(window.x + i, window.y + j);
+            guide.depth    = aovs.depth(window.x + i, window.y + j);
+            guide.objectId = aovs.objectId(window.x + i, window.y + j);
+        }
+    }
+
+    // The slope is the smallest difference with the neighbours on the same object, a fold of the object does not make its depth look smooth
+    const auto slope = [](const Guide& guide, const Guide* previous, const Guide* next) {
+        float result = -1.0f;
+        for (const Guide* neighbour : { previous, next })
+        {
+            if (neighbour != nullptr && neighbour->objectId == guide.objectId)
+            {
+                const float difference = abs(neighbour->depth - guide.depth);
+                result                 = result < 0.0f ? difference : min(result, difference);
+            }
+        }
+
+        return max(result, 0.0f);
+    };
+
+    for (unsigned int j = 0; j < window.height; ++j)
+    {
+        for (unsigned int i = 0; i < window.width; ++i)
+        {
+            const size_t index = j * window.width + i;
+            auto&        guide = guides[index];
+            if (guide.objectId == 0u)
+                continue;
+
+            guide.slopeX = slope(guide, i > 0u ? &guides[index - 1u] : nullptr, i + 1u < window.width ? &guides[index + 1u] : nullptr);
+            guide.slopeY = slope(guide,
+                                 j > 0u ? &guides[index - window.width] : nullptr,
+                                 j + 1u < window.height ? &guides[index + window.width] : nullptr);
+        }
+    }
+
+    return guides;
+}
+
+void Denoiser::_estimateVariances(Frame& frame, const vector<Guide>& guides, const Tile& window)
+{
+    for (unsigned int j = 0; j < window.height; ++j)
+    {
+        for (unsigned int i = 0; i < window.width; ++i)
+        {
+            const size_t index  = j * window.width + i;
+            float        sum    = 0.0f;
+            float        sumSqr = 0.0f;
+            unsigned int count  = 0u;
+
+            for (unsigned int neighbourJ = j > 0u ? j - 1u : 0u; neighbourJ <= min(j + 1u, window.height - 1u); ++neighbourJ)
+            {
+                for (unsigned int neighbourI = i > 0u ? i - 1u : 0u; neighbourI <= min(i + 1u, window.width - 1u); ++neighbourI)
+                {
+                    const size_t neighbourIndex = neighbourJ * window.width + neighbourI;
+                    if (guides[neighbourIndex].objectId != guides[index].objectId)
+                        continue;
+
+                    const float value = luminance(frame.colors[neighbourIndex]);
+                    sum += value;
+                    sumSqr += value * value;
+                    ++count;
+                }
+            }
+
+            const float mean       = sum / static_cast<float>(count);
+            frame.variances[index] = max(sumSqr / static_cast<float>(count) - mean * mean, 0.0f);
+        }
+    }
+}
+
+void Denoiser::_iterate(const Frame&         frame,
+                        Frame&               filtered,
+                        const vector<Guide>& guides,
+                        const Tile&          window,
+                        unsigned int         step,
+                        unsigned int         firstRow,
+                        unsigned int         lastRow)
+{
+    const int   width         = static_cast<int>(window.width);
+    const int   height        = static_cast<int>(window.height);
+    const int   offset        = static_cast<int>(step);
+    const float inverseAlbedo = 1.0f / (_albedoSigma * _albedoSigma);
+
+    for (int j = static_cast<int>(firstRow); j < static_cast<int>(lastRow); ++j)
+    {
+        for (int i = 0; i < width; ++i)
+        {
+            const size_t index           = static_cast<size_t>(j * width + i);
+            const auto&  guide           = guides[index];
+            const float  pixelLuminance  = luminance(frame.colors[index]);
+            const float  inverseDistance = 1.0f / (_luminanceSigma * sqrt(frame.variances[index]) + _luminanceFloor);
+
+            array<float, 3> sum{};
+            float           weightSum   = 0.0f;
+            float           varianceSum = 0.0f;
+
+            for (int tapJ = -2; tapJ <= 2; ++tapJ)
+            {
+                const int neighbourJ = j + tapJ * offset;
+                if (neighbourJ < 0 || neighbourJ >= height)
+                    continue;
+
+                for (int tapI = -2; tapI <= 2; ++tapI)
+                {
+                    const int neighbourI = i + tapI * offset;
+                    if (neighbourI < 0 || neighbourI >= width)
+                        continue;
+
+                    const size_t neighbourIndex = static_cast<size_t>(neighbourJ * width + neighbourI);
+                    const auto&  neighbour      = guides[neighbourIndex];
+                    const auto&  neighbourColor = frame.colors[neighbourIndex];
+
+                    // The pixels of different objects are never mixed
+                    if (neighbour.objectId != guide.objectId)
+                        continue;
+
+                    float weight = kernel[static_cast<size_t>(tapI + 2)] * kernel[static_cast<size_t>(tapJ + 2)];
+                    weight *= exp(-abs(luminance(neighbourColor) - pixelLuminance) * inverseDistance);
+
+                    // The background has no geometry, only its color is compared
+                    if (guide.objectId != 0u)
+                    {
+                        const float cosine = guide.normal[0] * neighbour.normal[0] + guide.normal[1] * neighbour.normal[1]
+                                             + guide.normal[2] * neighbour.normal[2];
+                        weight *= pow(max(cosine, 0.0f), _normalPower);
+
+                        // Depth difference expected at the distance of the tap on the slope of the pixel
+                        const float expected = _depthSigma * (guide.slopeX * static_cast<float>(abs(tapI * offset))
+                                                              + guide.slopeY * static_cast<float>(abs(tapJ * offset)))
+                                               + _depthFloor * guide.depth;
+                        weight *= exp(-abs(guide.depth - neighbour.depth) / max(expected, 1e-6f));
+
+                        weight *= exp(-squaredDistance(guide.albedo, neighbour.albedo) * inverseAlbedo);
+                    }
+
+                    for (unsigned int c = 0; c < 3u; ++c)
+                        sum[c] += neighbourColor[c] * weight;
+
+                    weightSum += weight;
+                    varianceSum += frame.variances[neighbourIndex] * weight * weight;
+                }
+            }
+
+            // The pixel itself has a weight unless its normal is null (normals of its samples cancelling each other out)
+            if (weightSum <= 0.0f)
+            {
+                filtered.colors[index]    = frame.colors[index];
+                filtered.variances[index] = frame.variances[index];
+                continue;
+            }
+
+            for (unsigned int c = 0; c < 3u; ++c)
+                filtered.colors[index][c] = sum[c] / weightSum;
+
+            // Variance of the weighted mean of the pixels
+            filtered.variances[index] = varianceSum / (weightSum * weightSum);
+        }
+    }
+}
@@ -0,0 +1,104 @@
+//===============================================================================================//
+/*!
+ *  \file      Denoiser.hpp
+ *  \author    Loïc Corenthy
+ *  \version   1.2
+ *  \date      19/10/2026
+ *  \copyright (c) 2026 Loïc Corenthy. All rights reserved.
+ */
+//===============================================================================================//
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "Tile.hpp"
+
+namespace LCNS
+{
+    // Forward declaration
+    class AOVBuffer;
+    class Buffer;
+
+    /// Edge avoiding à-trous wavelet filter (Dammertz et al. 2010) run over a frame once it is rendered. Each iteration blurs the pixels with
+    /// a 5x5 B3 spline kernel whose taps are 2^iteration pixels apart, so that a few iterations of 25 taps cover a wide footprint. The weight
+    /// of a tap drops with the difference of its normal, of its depth (compared to the slope of the depth around the pixel) and of its albedo,
+    /// and it is 0 on another object. It also drops with the difference of its luminance compared to the standard deviation of the luminance
+    /// of the pixel, estimated on its 3x3 neighbourhood then filtered with the colors at each iteration (as in SVGF, Schied et al. 2017): the
+    /// tolerance is wide where the frame is noisy and narrows as the noise is smoothed. The noise and the aliasing of a frame rendered with few
+    /// samples are smoothed while the edges and the textures are kept.
+    class Denoiser
+    {
+    public:
+        /// Largest number of iterations, the taps of the last one are 1024 pixels apart (more would only reach pixels outside of the frame)
+        static constexpr unsigned int maxIterationCount = 10u;
+
+    public:
+        /// Constructor with the number of iterations (at most maxIterationCount), n iterations average the pixels up to 2^(n + 1) - 2 pixels
+        /// away
+        explicit Denoiser(unsigned int iterationCount = 5u) noexcept;
+
+        /// Filter the pixels of a window of the buffer, guided by the AOVs of the render (which must have the dimensions of the buffer). The
+        /// pixels outside of the window are neither read nor written. The rows are split between the threads.
+        void denoise(Buffer& buffer, const AOVBuffer& aovs, const Tile& window, unsigned int threadCount = 1u) const;
+
+    private:
+        /// AOVs of a pixel of the window, with the slope of its depth
+        struct Guide
+        {
+            std::array<float, 3> normal{};
+            std::array<float, 3> albedo{};
+            float                depth    = 0.0f;
+            float                slopeX   = 0.0f;  ///< Depth difference per pixel along the rows, on the object of the pixel
+            float                slopeY   = 0.0f;  ///< Depth difference per pixel along the columns, on the object of the pixel
+            std::uint32_t        objectId = 0u;
+        };
+
+        /// Colors of the pixels of the window, row by row, with the variance of their luminance
+        struct Frame
+        {
+            std::vector<std::array<float, 3>> colors;
+            std::vector<float>                variances;
+        };
+
+        /// Get the AOVs of the pixels of the window, row by row
+        static std::vector<Guide> _guides(const AOVBuffer& aovs, const Tile& window);
+
+        /// Estimate the variance of the luminance of each pixel from the pixels of the same object in its 3x3 neighbourhood
+        static void _estimateVariances(Frame& frame, const std::vector<Guide>& guides, const Tile& window);
+
+        /// Filter the rows [firstRow, lastRow[ of the window with the taps step pixels apart
+        static void _iterate(const Frame&              frame,
+                             Frame&                    filtered,
+                             const std::vector<Guide>& guides,
+                             const Tile&               window,
+                             unsigned int              step,
+                             unsigned int              firstRow,
+                             unsigned int              lastRow);
+
+    private:
+        /// Tolerance of the luminance difference, in standard deviations of the luminance of the pixel
+        static constexpr float _luminanceSigma = 4.0f;
+
+        /// Smallest tolerance of the luminance difference (in the [0, 1] range of the pixels), where the frame has no noise
+        static constexpr float _luminanceFloor = 0.01f;
+
+        /// Exponent of the cosine between the normals
+        static constexpr float _normalPower = 64.0f;
+
+        /// Tolerance of the depth difference, in multiples of the difference expected from the slope of the depth
+        static constexpr float _depthSigma = 1.0f;
+
+        /// Smallest tolerance of the depth difference, relative to the depth of the pixel (for the surfaces facing the camera)
+        static constexpr float _depthFloor = 0.01f;
+
+        /// Tolerance of the albedo difference
+        static constexpr float _albedoSigma = 0.1f;
+
+        unsigned int _iterationCount = 5u;
+
+    };  // class Denoiser
+
+}  // namespace LCNS
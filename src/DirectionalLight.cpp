@@ -14,6 +14,7 @@
 #include "Renderable.hpp"
 #include "Ray.hpp"
 #include "Scene.hpp"
+#include "Transform.hpp"
 #include "Vector.hpp"
 #include <memory>
 
@@ -21,6 +22,7 @@ using std::shared_ptr;
 
 using LCNS::Color;
 using LCNS::DirectionalLight;
+using LCNS::Transform;
 using LCNS::Vector;
 
 DirectionalLight::DirectionalLight(const Vector& direction, const Color& intensity)
@@ -70,7 +72,7 @@ Color DirectionalLight::intensityAt(const Point& point, const Scene& scene, Rend
     myRay.direction(_direction * (-1.0));
     myRay.intersected(currentObject);
 
-    bool hasIntersection = scene.intersect(myRay);
+    bool hasIntersection = _isOccluded(myRay, scene);
 
     if (hasIntersection)
         return Color(0.0f);
@@ -80,3 +82,8 @@ Color DirectionalLight::intensityAt(const Point& point, const Scene& scene, Rend
         return _intensity * cos;
     }
 }
+
+void DirectionalLight::transform(const Transform& transform)
+{
+    _direction = transform.apply(_direction);
+}
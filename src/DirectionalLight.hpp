@@ -48,6 +48,9 @@ namespace LCNS
         /// Implementation of virtual funcion from Light
         Vector directionFrom([[maybe_unused]] const Point& point) const override;
 
+        /// Implementation of virtual funcion from Light
+        void transform(const Transform& transform) override;
+
     private:
         Vector _direction;
 
@@ -10,23 +10,27 @@
 
 #include "Image.hpp"
 
-#include <memory>
+#include <cmath>
+
+#include "TextureCache.hpp"
 
-using std::make_unique;
 using std::string;
 
 using LCNS::Color;
 using LCNS::Image;
-
-using OIIO::ImageInput;
-using OIIO::ImageSpec;
-using OIIO::TypeDesc;
+using LCNS::TextureCache;
 
 Image::Image(const string& path)
 {
     _createImageFromFile(path);
 }
 
+Image::~Image(void)
+{
+    if (_imageLoaded)
+        TextureCache::unregister(_textureId);
+}
+
 bool Image::loadFromFile(const string& path)
 {
     return _createImageFromFile(path);
@@ -34,24 +38,15 @@ bool Image::loadFromFile(const string& path)
 
 Color Image::pixelColor(double i, double j) const
 {
-    // _rawData contains the image data in the RGBA8888 pixel format, do not forget that _rawData[byteIndex + 3] is the alpha component
-
     assert(-0.000001 <= i && i <= 1.000001 && "Index out of image's bounds");
     assert(-0.000001 <= j && j <= 1.000001 && "Index out of image's bounds");
 
-    const double inv255 = 1.0 / 255.0;
-
     if (_interpolation == InterpolationMethod::NEAREST)
     {
         auto ii = static_cast<unsigned int>(i * _width);
         auto jj = static_cast<unsigned int>(j * _height);
 
-        // unsigned int byteIndex = _width*_height*_bytesPerPixel - (_bytesPerRow * j) + i * _bytesPerPixel;
-        unsigned int byteIndex = (_bytesPerRow * jj) + ii * _bytesPerPixel;
-
-        return Color(static_cast<double>(_rawData[byteIndex]) * inv255,
-                     static_cast<double>(_rawData[byteIndex + 1]) * inv255,
-                     static_cast<double>(_rawData[byteIndex + 2]) * inv255);
+        return _texel(ii, jj);
     }
     else
     {
@@ -68,29 +63,10 @@ Color Image::pixelColor(double i, double j) const
         if (jj >= _height - 1)
             jj--;
 
-        unsigned int byteIndex = (_bytesPerRow * jj) + ii * _bytesPerPixel;
-
-        Color c0(static_cast<double>(_rawData[byteIndex]) * inv255,
-                 static_cast<double>(_rawData[byteIndex + 1]) * inv255,
-                 static_cast<double>(_rawData[byteIndex + 2]) * inv255);
-
-        byteIndex = (_bytesPerRow * jj) + (ii + 1) * _bytesPerPixel;
-
-        Color c1(static_cast<double>(_rawData[byteIndex]) * inv255,
-                 static_cast<double>(_rawData[byteIndex + 1]) * inv255,
-                 static_cast<double>(_rawData[byteIndex + 2]) * inv255);
-
-        byteIndex = (_bytesPerRow * (jj + 1)) + (ii) *_bytesPerPixel;
-
-        Color c2(static_cast<double>(_rawData[byteIndex]) * inv255,
-                 static_cast<double>(_rawData[byteIndex + 1]) * inv255,
-                 static_cast<double>(_rawData[byteIndex + 2]) * inv255);
-
-        byteIndex = (_bytesPerRow * (jj + 1)) + (ii + 1) * _bytesPerPixel;
-
-        Color c3(static_cast<double>(_rawData[byteIndex]) * inv255,
-                 static_cast<double>(_rawData[byteIndex + 1]) * inv255,
-                 static_cast<double>(_rawData[byteIndex + 2]) * inv255);
+        Color c0 = _texel(ii, jj);
+        Color c1 = _texel(ii + 1, jj);
+        Color c2 = _texel(ii, jj + 1);
+        Color c3 = _texel(ii + 1, jj + 1);
 
         Color cLine1 = c0 * decimalPartI + c1 * (1.0 - decimalPartI);
         Color cLine2 = c2 * decimalPartI + c3 * (1.0 - decimalPartI);
@@ -124,24 +100,51 @@ bool Image::imageLoaded(void) const noexcept
     return _imageLoaded;
 }
 
+void Image::prefetch(void) const
+{
+    if (_imageLoaded)
+        TextureCache::prefetch(_textureId);
+}
+
 bool Image::_createImageFromFile(const string& path)
 {
-    _image = ImageInput::open(path);
+    // Only the header of the file is read here, the pixels are decoded by the texture cache the first time they are accessed
+    const auto texture = TextureCache::open(path);
 
-    if (!_image)
+    if (!texture)
         return false;
 
-    const ImageSpec& spec = _image->spec();
-    _width                = static_cast<unsigned int>(spec.width);
-    _height               = static_cast<unsigned int>(spec.height);
-    _bytesPerPixel        = static_cast<unsigned int>(spec.nchannels);
+    // An image loaded again does not keep its previous file in the cache
+    if (_imageLoaded)
+        TextureCache::unregister(_textureId);
 
-    _rawData     = make_unique<unsigned char[]>(_width * _height * _bytesPerPixel);
-    _bytesPerRow = _bytesPerPixel * _width;
-
-    _image->read_image(TypeDesc::UINT8, _rawData.get());
-    _image->close();
+    _textureId     = texture->id;
+    _width         = texture->width;
+    _height        = texture->height;
+    _bytesPerPixel = texture->bytesPerPixel;
 
     _imageLoaded = true;
     return true;
 }
+
+Color Image::_texel(unsigned int ii, unsigned int jj) const
+{
+    // The tiles contain the image data in the RGBA8888 pixel format, do not forget that pixels[byteIndex + 3] is the alpha component
+
+    const double inv255 = 1.0 / 255.0;
+
+    // Coordinates exactly on the border of the image (i or j equal to 1.0) use the last column or row
+    if (ii >= _width)
+        ii = _width - 1;
+
+    if (jj >= _height)
+        jj = _height - 1;
+
+    const auto& tile = TextureCache::tile(_textureId, jj);
+
+    const unsigned int byteIndex = (tile.bytesPerRow * (jj - tile.firstRow)) + ii * _bytesPerPixel;
+
+    return Color(static_cast<double>(tile.pixels[byteIndex]) * inv255,
+                 static_cast<double>(tile.pixels[byteIndex + 1]) * inv255,
+                 static_cast<double>(tile.pixels[byteIndex + 2]) * inv255);
+}
@@ -13,13 +13,11 @@
 #include <string>
 #include <cassert>
 
-#include <OpenImageIO/imageio.h>
-#include <OpenImageIO/typedesc.h>
-
 #include "Color.hpp"
 
 namespace LCNS
 {
+    /// Image used as a texture. The pixels are not kept by the image itself, they are decoded on demand by the TextureCache.
     class Image
     {
     public:
@@ -42,8 +40,8 @@ namespace LCNS
         /// Copy operator
         Image operator=(const Image& image) = delete;
 
-        /// Destructor
-        ~Image(void) = default;
+        /// Destructor, removes the image from the TextureCache
+        ~Image(void);
 
         /// Load an image from a file
         bool loadFromFile(const std::string& path);
@@ -66,20 +64,24 @@ namespace LCNS
         /// Check if the image has been loaded or not
         bool imageLoaded(void) const noexcept;
 
+        /// Decode all the pixels of the image in the texture cache (within its memory budget)
+        void prefetch(void) const;
+
     private:
         /// Implementation of the method loading an image from the file system
         bool _createImageFromFile(const std::string& path);
 
+        /// Get the color of the pixel at column ii and row jj
+        Color _texel(unsigned int ii, unsigned int jj) const;
+
     private:
-        std::unique_ptr<OIIO::ImageInput> _image;
-        std::unique_ptr<unsigned char[]>  _rawData;
-        unsigned int                      _width            = 0u;
-        unsigned int                      _height           = 0u;
-        unsigned int                      _bytesPerPixel    = 4u;
-        unsigned int                      _bytesPerRow      = 0u;
-        unsigned int                      _bitsPerComponent = 8u;
-        InterpolationMethod               _interpolation    = InterpolationMethod::NEAREST;
-        bool                              _imageLoaded      = false;
+        unsigned int        _textureId        = 0u;
+        unsigned int        _width            = 0u;
+        unsigned int        _height           = 0u;
+        unsigned int        _bytesPerPixel    = 4u;
+        unsigned int        _bitsPerComponent = 8u;
+        InterpolationMethod _interpolation    = InterpolationMethod::NEAREST;
+        bool                _imageLoaded      = false;
 
     };  // Class Image
 
@@ -0,0 +1,372 @@
+//===============================================================================================//
+/*!
+ *  \file      JsonValue.cpp
+ *  \author    Loïc Corenthy
+ *  \version   1.2
+ *  \date      19/10/2026
+ *  \copyright (c) 2026 Loïc Corenthy. All rights reserved.
+ */
+//===============================================================================================//
+
+#include "JsonValue.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+
+using std::all_of;
+using std::count;
+using std::isdigit;
+using std::isspace;
+using std::isxdigit;
+using std::make_tuple;
+using std::map;
+using std::min;
+using std::ptrdiff_t;
+using std::runtime_error;
+using std::size_t;
+using std::strtod;
+using std::strtoul;
+using std::to_string;
+using std::vector;
+
+using LCNS::JsonValue;
+
+namespace
+{
+    /// Deepest nesting of arrays and objects accepted, a deeper document is most likely not a scene
+    constexpr size_t maxDepth = 64u;
+
+    /// Get the name of a type for the error messages
+    const char* typeName(JsonValue::Type type)
+    {
+        switch (type)
+        {
+            case JsonValue::Type::NUL:
+                return "null";
+            case JsonValue::Type::BOOLEAN:
+                return "a boolean";
+            case JsonValue::Type::NUMBER:
+                return "a number";
+            case JsonValue::Type::STRING:
+                return "a string";
+            case JsonValue::Type::ARRAY:
+                return "an array";
+            case JsonValue::Type::OBJECT:
+                return "an object";
+        }
+
+        return "unknown";
+    }
+}  // namespace
+
+JsonValue JsonValue::parse(const std::string& text)
+{
+    Parser parser{ text };
+
+    JsonValue document = parser.value(std::string(), 0u);
+    if (parser.next() != '\0')
+        parser.fail("Unexpected character after the end of the document");
+
+    return document;
+}
+
+JsonValue::Type JsonValue::type(void) const noexcept
+{
+    return _type;
+}
+
+const std::string& JsonValue::path(void) const noexcept
+{
+    return _path;
+}
+
+bool JsonValue::boolean(void) const
+{
+    _checkType(Type::BOOLEAN, typeName(Type::BOOLEAN));
+    return _boolean;
+}
+
+double JsonValue::number(void) const
+{
+    _checkType(Type::NUMBER, typeName(Type::NUMBER));
+    return _number;
+}
+
+const std::string& JsonValue::string(void) const
+{
+    _checkType(Type::STRING, typeName(Type::STRING));
+    return _string;
+}
+
+const vector<JsonValue>& JsonValue::array(void) const
+{
+    _checkType(Type::ARRAY, typeName(Type::ARRAY));
+    return _array;
+}
+
+const map<std::string, JsonValue>& JsonValue::object(void) const
+{
+    _checkType(Type::OBJECT, typeName(Type::OBJECT));
+    return _object;
+}
+
+bool JsonValue::has(const std::string& name) const
+{
+    return object().count(name) != 0u;
+}
+
+const JsonValue& JsonValue::operator[](const std::string& name) const
+{
+    const auto member = object().find(name);
+    if (member == _object.end())
+        throw runtime_error((_path.empty() ? std::string("The document") : _path) + " has no member " + name);
+
+    return member->second;
+}
+
+void JsonValue::_checkType(Type type, const char* name) const
+{
+    if (_type != type)
+        throw runtime_error((_path.empty() ? std::string("The document") : _path) + " should be " + name + ", it is " + typeName(_type));
+}
+
+JsonValue JsonValue::Parser::value(const std::string& path, size_t depth)
+{
+    if (depth > maxDepth)
+        fail("The document is nested too deeply");
+
+    JsonValue result;
+    result._path = path;
+
+    const char character = next();
+
+    if (character == '{')
+    {
+        result._type = Type::OBJECT;
+        ++position;
+
+        if (next() == '}')
+        {
+            ++position;
+            return result;
+        }
+
+        while (true)
+        {
+            expect('"');
+            const auto name = string();
+            expect(':');
+
+            if (result._object.count(name) != 0u)
+                fail("The member " + name + " is defined twice");
+
+            result._object.emplace(name, value(path.empty() ? name : path + "." + name, depth + 1u));
+
+            if (next() == '}')
+            {
+                ++position;
+                return result;
+            }
+
+            expect(',');
+        }
+    }
+
+    if (character == '[')
+    {
+        result._type = Type::ARRAY;
+        ++position;
+
+        if (next() == ']')
+        {
+            ++position;
+            return result;
+        }
+
+        while (true)
+        {
+            result._array.push_back(value(path + "[" + to_string(result._array.size()) + "]", depth + 1u));
+
+            if (next() == ']')
+            {
+                ++position;
+                return result;
+            }
+
+            expect(',');
+        }
+    }
+
+    if (character == '"')
+    {
+        ++position;
+        result._type   = Type::STRING;
+        result._string = string();
+        return result;
+    }
+
+    if (character == '-' || isdigit(static_cast<unsigned char>(character)))
+    {
+        char*       end   = nullptr;
+        const char* start = text.c_str() + position;
+
+        result._type   = Type::NUMBER;
+        result._number = strtod(start, &end);
+        position += static_cast<size_t>(end - start);
+        return result;
+    }
+
+    // The keywords
+    for (const auto& [keyword, type, boolean] :
+         { make_tuple("true", Type::BOOLEAN, true), make_tuple("false", Type::BOOLEAN, false), make_tuple("null", Type::NUL, false) })
+    {
+        const std::string word(keyword);
+        if (text.compare(position, word.size(), word) == 0)
+        {
+            position += word.size();
+            result._type    = type;
+            result._boolean = boolean;
+            return result;
+        }
+    }
+
+    fail(character == '\0' ? "Unexpected end of the document" : std::string("Unexpected character ") + character);
+}
+
+std::string JsonValue::Parser::string(void)
+{
+    std::string result;
+
+    while (position < text.size() && text[position] != '"')
+    {
+        char character = text[position++];
+
+        if (character == '\\')
+        {
+            if (position >= text.size())
+                break;
+
+            character = text[position++];
+            switch (character)
+            {
+                case 'b':
+                    character = '\b';
+                    break;
+                case 'f':
+                    character = '\f';
+                    break;
+                case 'n':
+                    character = '\n';
+                    break;
+                case 'r':
+                    character = '\r';
+                    break;
+                case 't':
+                    character = '\t';
+                    break;
+                case 'u':
+                {
+                    // The names and the paths of a scene are expected to be ASCII, the other characters are encoded in UTF-8
+                    auto code = codeUnit();
+
+                    // The characters after the first 65536 ones are escaped as a high surrogate followed by a low surrogate
+                    if (0xDC00u <= code && code <= 0xDFFFu)
+                        fail("Low surrogate without a high surrogate in a unicode escape sequence");
+
+                    if (0xD800u <= code && code <= 0xDBFFu)
+                    {
+                        if (text.compare(position, 2u, "\\u") != 0)
+                            fail("High surrogate without a low surrogate in a unicode escape sequence");
+
+                        position += 2u;
+
+                        const auto lowSurrogate = codeUnit();
+                        if (lowSurrogate < 0xDC00u || 0xDFFFu < lowSurrogate)
+                            fail("High surrogate without a low surrogate in a unicode escape sequence");
+
+                        code = 0x10000u + ((code - 0xD800u) << 10u) + (lowSurrogate - 0xDC00u);
+                    }
+
+                    if (code < 0x80u)
+                        character = static_cast<char>(code);
+                    else
+                    {
+                        if (code < 0x800u)
+                            result += static_cast<char>(0xC0u | (code >> 6u));
+                        else if (code < 0x10000u)
+                        {
+                            result += static_cast<char>(0xE0u | (code >> 12u));
+                            result += static_cast<char>(0x80u | ((code >> 6u) & 0x3Fu));
+                        }
+                        else
+                        {
+                            result += static_cast<char>(0xF0u | (code >> 18u));
+                            result += static_cast<char>(0x80u | ((code >> 12u) & 0x3Fu));
+                            result += static_cast<char>(0x80u | ((code >> 6u) & 0x3Fu));
+                        }
+
+                        character = static_cast<char>(0x80u | (code & 0x3Fu));
+                    }
+                    break;
+                }
+                case '"':
+                case '\\':
+                case '/':
+                    // The character itself
+                    break;
+                default:
+                    fail(std::string("Invalid escape sequence \\") + character);
+            }
+        }
+
+        result += character;
+    }
+
+    if (position >= text.size())
+        fail("Unterminated string");
+
+    // Closing quote
+    ++position;
+
+    return result;
+}
+
+unsigned int JsonValue::Parser::codeUnit(void)
+{
+    if (position + 4u > text.size())
+        fail("Incomplete unicode escape sequence");
+
+    const auto digits = text.substr(position, 4u);
+    if (!all_of(digits.begin(), digits.end(), [](char digit) { return isxdigit(static_cast<unsigned char>(digit)) != 0; }))
+        fail("Invalid unicode escape sequence \\u" + digits);
+
+    position += 4u;
+
+    return static_cast<unsigned int>(strtoul(digits.c_str(), nullptr, 16));
+}
+
+char JsonValue::Parser::next(void)
+{
+    while (position < text.size() && isspace(static_cast<unsigned char>(text[position])))
+        ++position;
+
+    return position < text.size() ? text[position] : '\0';
+}
+
+void JsonValue::Parser::expect(char character)
+{
+    if (next() != character)
+        fail(std::string("Expected ") + character);
+
+    ++position;
+}
+
+void JsonValue::Parser::fail(const std::string& message) const
+{
+    const auto line = count(text.begin(), text.begin() + static_cast<ptrdiff_t>(min(position, text.size())), '\n') + 1;
+    throw runtime_error(message + " at line " + to_string(line));
+}
@@ -0,0 +1,111 @@
+//===============================================================================================//
+/*!
+ *  \file      JsonValue.hpp
+ *  \author    Loïc Corenthy
+ *  \version   1.2
+ *  \date      19/10/2026
+ *  \copyright (c) 2026 Loïc Corenthy. All rights reserved.
+ */
+//===============================================================================================//
+
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace LCNS
+{
+    /// Value of a JSON document (null, boolean, number, string, array or object), read with JsonValue::parse. The accessors throw a runtime
+    /// error naming the path of the value in the document (e.g. objects[2].radius) when it does not have the expected type, so that the
+    /// errors of a file written by hand can be found.
+    class JsonValue
+    {
+    public:
+        enum class Type
+        {
+            NUL,
+            BOOLEAN,
+            NUMBER,
+            STRING,
+            ARRAY,
+            OBJECT
+        };
+
+    public:
+        /// Default constructor, the value is null
+        JsonValue(void) = default;
+
+        /// Read a JSON document, throws a runtime error with the line of the first syntax error
+        static JsonValue parse(const std::string& text);
+
+        /// Get the type of the value
+        Type type(void) const noexcept;
+
+        /// Get the path of the value in the document
+        const std::string& path(void) const noexcept;
+
+        /// Get a boolean
+        bool boolean(void) const;
+
+        /// Get a number
+        double number(void) const;
+
+        /// Get a string
+        const std::string& string(void) const;
+
+        /// Get the values of an array
+        const std::vector<JsonValue>& array(void) const;
+
+        /// Get the members of an object, sorted by name
+        const std::map<std::string, JsonValue>& object(void) const;
+
+        /// Check if an object has a member
+        bool has(const std::string& name) const;
+
+        /// Get a member of an object, throws a runtime error if there is no such member
+        const JsonValue& operator[](const std::string& name) const;
+
+    private:
+        /// Parser of a document, the position is moved after each value read
+        struct Parser
+        {
+            const std::string& text;
+            std::size_t        position = 0u;
+
+            /// Read the value at the position, inside depth arrays and objects
+            JsonValue value(const std::string& path, std::size_t depth);
+
+            /// Read a string at the position (after its opening quote)
+            std::string string(void);
+
+            /// Read the 4 hexadecimal digits of a unicode escape sequence at the position (after its \u)
+            unsigned int codeUnit(void);
+
+            /// Skip the spaces and get the next character (0 at the end of the text)
+            char next(void);
+
+            /// Read the next character, throws if it is not the expected one
+            void expect(char character);
+
+            /// Throw a runtime error with the line of the position
+            [[noreturn]] void fail(const std::string& message) const;
+        };
+
+    private:
+        /// Throw a runtime error if the value does not have a type
+        void _checkType(Type type, const char* name) const;
+
+    private:
+        Type                             _type    = Type::NUL;
+        bool                             _boolean = false;
+        double                           _number  = 0.0;
+        std::string                      _string;
+        std::vector<JsonValue>           _array;
+        std::map<std::string, JsonValue> _object;
+        std::string                      _path;
+
+    };  // class JsonValue
+
+}  // namespace LCNS
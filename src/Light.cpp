@@ -10,15 +10,35 @@
 
 #include "Light.hpp"
 #include "Color.hpp"
+#include "Renderable.hpp"
+#include "Statistics.hpp"
 
 using LCNS::Color;
 using LCNS::Light;
+using LCNS::Ray;
+using LCNS::Renderable;
+using LCNS::Scene;
+using LCNS::ShadowCache;
+using LCNS::Statistics;
 
 Light::Light(const Color& color)
 : _intensity(color)
 {
 }
 
+Light::Light(const Light& light)
+: _intensity(light._intensity)
+{
+}
+
+Light& Light::operator=(const Light& light)
+{
+    // Two lights sharing a slot would keep on replacing each other's occluder
+    _intensity = light._intensity;
+
+    return *this;
+}
+
 void Light::intensity(const LCNS::Color& color)
 {
     _intensity = color;
@@ -28,3 +48,34 @@ Color Light::intensity(void) const
 {
     return _intensity;
 }
+
+bool Light::_isOccluded(Ray& shadowRay, const Scene& scene) const
+{
+    Statistics::count(Statistics::Counter::SHADOW_RAYS);
+
+    Renderable* currentObject = shadowRay.intersected();
+
+    // Test the last occluder of the light first, an object cannot block the light for its own points
+    if (auto* occluder = ShadowCache::occluder(_shadowCacheSlot); occluder != nullptr && occluder != currentObject)
+    {
+        if (occluder->intersect(shadowRay) && shadowRay.intersected() != currentObject)
+        {
+            Statistics::count(Statistics::Counter::SHADOW_CACHE_HITS);
+            Statistics::count(Statistics::Counter::HITS);
+            return true;
+        }
+
+        // Restore the ray for the intersection with the whole scene
+        shadowRay.intersected(currentObject);
+    }
+
+    Statistics::count(Statistics::Counter::SHADOW_CACHE_MISSES);
+
+    if (!scene.intersect(shadowRay))
+        return false;
+
+    // The closest object blocking the light (a triangle for a mesh) is the first one tested for the next point
+    ShadowCache::occluder(_shadowCacheSlot, shadowRay.intersected());
+
+    return true;
+}
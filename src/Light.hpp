@@ -14,11 +14,14 @@
 #include "Vector.hpp"
 #include "Color.hpp"
 #include "Scene.hpp"
+#include "Ray.hpp"
+#include "ShadowCache.hpp"
 
 namespace LCNS
 {
     // Forward declaration
     class Renderable;
+    class Transform;
 
     class Light
     {
@@ -29,11 +32,11 @@ namespace LCNS
         /// Constructor with parameters
         Light(const Color& color);
 
-        /// Copy constructor
-        Light(const Light& light) = default;
+        /// Copy constructor, the copy gets its own slot in the shadow cache
+        Light(const Light& light);
 
-        /// Copy operator
-        Light& operator=(const Light& light) = default;
+        /// Copy operator, the light keeps its slot in the shadow cache
+        Light& operator=(const Light& light);
 
         /// Destructor
         virtual ~Light(void) = default;
@@ -44,6 +47,9 @@ namespace LCNS
         /// Get the direction of the light from a point of an object in the scene
         virtual Vector directionFrom([[maybe_unused]] const Point& point) const = 0;
 
+        /// Move the light (animated scenes)
+        virtual void transform(const Transform& transform) = 0;
+
         /// Set the intensity (color) of the light
         void intensity(const Color& color);
 
@@ -51,7 +57,12 @@ namespace LCNS
         Color intensity(void) const;
 
     protected:
-        Color _intensity;
+        /// Check if an object of the scene blocks a shadow ray, the last occluder of the light is tested before the whole scene
+        bool _isOccluded(Ray& shadowRay, const Scene& scene) const;
+
+    protected:
+        Color        _intensity;
+        unsigned int _shadowCacheSlot = ShadowCache::newSlot();
 
     };  // class Light
 
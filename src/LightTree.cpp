@@ -0,0 +1,295 @@
+//===============================================================================================//
+/*!
+ *  \file      LightTree.cpp
+ *  \author    Loïc Corenthy
+ *  \version   1.2
+ *  \date      19/10/2026
+ *  \copyright (c) 2026 Loïc Corenthy. All rights reserved.
+ */
+//===============================================================================================//
+
+#include "LightTree.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+#include "Light.hpp"
+#include "PunctualLight.hpp"
+
+using std::dynamic_pointer_cast;
+using std::list;
+using std::max;
+using std::min;
+using std::numeric_limits;
+using std::nth_element;
+using std::ptrdiff_t;
+using std::runtime_error;
+using std::shared_ptr;
+using std::sqrt;
+using std::uint64_t;
+using std::vector;
+
+using LCNS::BoundingBox;
+using LCNS::Light;
+using LCNS::LightTree;
+using LCNS::Point;
+using LCNS::PunctualLight;
+using LCNS::Real;
+
+namespace
+{
+    /// Mix the bits of a 64 bits integer (splitmix64 finalizer)
+    uint64_t mix(uint64_t value) noexcept
+    {
+        value ^= value >> 30;
+        value *= 0xbf58476d1ce4e5b9ull;
+        value ^= value >> 27;
+        value *= 0x94d049bb133111ebull;
+        value ^= value >> 31;
+
+        return value;
+    }
+
+    /// Bits of a double
+    uint64_t bits(double value) noexcept
+    {
+        uint64_t result = 0u;
+        std::memcpy(&result, &value, sizeof(result));
+
+        return result;
+    }
+
+    /// Random number in [0, 1[ that only depends on the point and the light, so that the same point is always lit by the same lights whatever
+    /// the thread or the rendering backend
+    double uniform(const Point& point, unsigned int lightIndex) noexcept
+    {
+        uint64_t hash = mix(bits(point.x()) + 0x9e3779b97f4a7c15ull);
+        hash          = mix(hash ^ bits(point.y()));
+        hash          = mix(hash ^ bits(point.z()));
+        hash          = mix(hash ^ lightIndex);
+
+        // Keep the 53 bits of the mantissa
+        return static_cast<double>(hash >> 11) * 0x1.0p-53;
+    }
+
+    /// Distance between a point and a bounding box (0 if the point is inside the box)
+    double distance(const Point& point, const BoundingBox& boundingBox) noexcept
+    {
+        const Point boxMin = boundingBox.min();
+        const Point boxMax = boundingBox.max();
+
+        double squaredDistance = 0.0;
+        for (unsigned int i = 0; i < 3; ++i)
+        {
+            const double delta = max(max(double{ boxMin[i] - point[i] }, 0.0), double{ point[i] - boxMax[i] });
+            squaredDistance += delta * delta;
+        }
+
+        return sqrt(squaredDistance);
+    }
+
+    /// Largest component of the intensity of a light
+    double maxIntensity(const Light& light)
+    {
+        const auto intensity = light.intensity();
+
+        return max(intensity.red(), max(intensity.green(), intensity.blue()));
+    }
+
+}  // namespace
+
+void LightTree::build(const list<shared_ptr<Light>>& lights)
+{
+    _nodes.clear();
+    _punctualLights.clear();
+    _otherLights.clear();
+    _lightCount = 0u;
+
+    for (const auto& light : lights)
+    {
+        if (auto punctualLight = dynamic_pointer_cast<PunctualLight>(light))
+            _punctualLights.push_back({ punctualLight->position(), maxIntensity(*punctualLight), _lightCount });
+        else
+            _otherLights.push_back(_lightCount);
+
+        ++_lightCount;
+    }
+
+    if (!_punctualLights.empty())
+    {
+        _nodes.reserve(2u * _punctualLights.size());
+        _buildNode(0u, static_cast<unsigned int>(_punctualLights.size()));
+    }
+}
+
+void LightTree::threshold(double threshold)
+{
+    if (threshold < 0.0)
+        throw runtime_error("The light threshold cannot be negative");
+
+    _threshold = threshold;
+}
+
+double LightTree::threshold(void) const noexcept
+{
+    return _threshold;
+}
+
+void LightTree::sampleCount(unsigned int count) noexcept
+{
+    _sampleCount = count;
+}
+
+unsigned int LightTree::sampleCount(void) const noexcept
+{
+    return _sampleCount;
+}
+
+unsigned int LightTree::lightCount(void) const noexcept
+{
+    return _lightCount;
+}
+
+bool LightTree::selectsAll(void) const noexcept
+{
+    return _threshold <= 0.0 && (_sampleCount == 0u || _punctualLights.size() <= _sampleCount);
+}
+
+void LightTree::select(const Point& point, vector<double>& weights) const
+{
+    weights.assign(_lightCount, 0.0);
+
+    for (auto index : _otherLights)
+        weights[index] = 1.0;
+
+    if (_nodes.empty())
+        return;
+
+    // Find the punctual lights whose bound is above the threshold, their bound is temporarily stored as their weight
+    unsigned int stack[64];
+    unsigned int stackSize      = 0u;
+    unsigned int candidateCount = 0u;
+    double       boundSum       = 0.0;
+
+    stack[stackSize++] = 0u;
+    while (stackSize != 0u)
+    {
+        const Node& node = _nodes[stack[--stackSize]];
+
+        if (_bound(node, point) < _threshold)
+            continue;
+
+        if (node.rightChild == 0u)
+        {
+            for (unsigned int i = node.first; i < node.first + node.count; ++i)
+            {
+                const auto&  light = _punctualLights[i];
+                const double bound = light.intensity / (1.0 + double{ (light.position - point).length() });
+
+                if (bound < _threshold)
+                    continue;
+
+                // A light with no intensity does not contribute but is still selected, the shader skips it anyway
+                weights[light.index] = max(bound, numeric_limits<double>::min());
+                boundSum += bound;
+                ++candidateCount;
+            }
+        }
+        else
+        {
+            assert(stackSize + 2u <= 64u && "Light tree too deep");
+
+            stack[stackSize++] = node.rightChild;
+            stack[stackSize++] = static_cast<unsigned int>(&node - _nodes.data()) + 1u;
+        }
+    }
+
+    // Keep all the candidates
+    if (_sampleCount == 0u || candidateCount <= _sampleCount || boundSum <= 0.0)
+    {
+        for (const auto& light : _punctualLights)
+        {
+            if (weights[light.index] != 0.0)
+                weights[light.index] = 1.0;
+        }
+
+        return;
+    }
+
+    // Keep each candidate with a probability proportional to its bound, so that sampleCount lights are kept on average. A kept light is
+    // weighted by the inverse of its probability so that the expected intensity is the one of the candidate.
+    const double scale = static_cast<double>(_sampleCount) / boundSum;
+    for (const auto& light : _punctualLights)
+    {
+        double& weight = weights[light.index];
+        if (weight == 0.0)
+            continue;
+
+        const double probability = min(1.0, weight * scale);
+        weight                   = uniform(point, light.index) < probability ? 1.0 / probability : 0.0;
+    }
+}
+
+unsigned int LightTree::_buildNode(unsigned int first, unsigned int count)
+{
+    assert(count != 0u && "A node of the light tree needs at least one light");
+
+    const auto nodeIndex = static_cast<unsigned int>(_nodes.size());
+    _nodes.emplace_back();
+
+    // Bounding box and intensity of the lights of the node
+    Point  boxMin(numeric_limits<Real>::max());
+    Point  boxMax(numeric_limits<Real>::lowest());
+    double intensity = 0.0;
+
+    for (unsigned int i = first; i < first + count; ++i)
+    {
+        const auto& light = _punctualLights[i];
+        for (unsigned int j = 0; j < 3; ++j)
+        {
+            boxMin[j] = min(boxMin[j], light.position[j]);
+            boxMax[j] = max(boxMax[j], light.position[j]);
+        }
+        intensity += light.intensity;
+    }
+
+    _nodes[nodeIndex].boundingBox = BoundingBox(boxMin, boxMax);
+    _nodes[nodeIndex].intensity   = intensity;
+    _nodes[nodeIndex].first       = first;
+    _nodes[nodeIndex].count       = count;
+
+    if (count <= _maxLightsPerLeaf)
+        return nodeIndex;
+
+    // Split the lights at the median of the longest axis of the bounding box, the left child directly follows its parent
+    const auto   extent = boxMax - boxMin;
+    unsigned int axis   = 0u;
+    if (extent.y() > extent[axis])
+        axis = 1u;
+    if (extent.z() > extent[axis])
+        axis = 2u;
+
+    const unsigned int leftCount = count / 2u;
+    const auto         begin     = _punctualLights.begin() + static_cast<ptrdiff_t>(first);
+
+    const auto byAxis = [axis](const PunctualLightData& lhs, const PunctualLightData& rhs) { return lhs.position[axis] < rhs.position[axis]; };
+    nth_element(begin, begin + static_cast<ptrdiff_t>(leftCount), begin + static_cast<ptrdiff_t>(count), byAxis);
+
+    _buildNode(first, leftCount);
+    const unsigned int rightChild = _buildNode(first + leftCount, count - leftCount);
+
+    _nodes[nodeIndex].rightChild = rightChild;
+
+    return nodeIndex;
+}
+
+double LightTree::_bound(const Node& node, const Point& point) const noexcept
+{
+    return node.intensity / (1.0 + distance(point, node.boundingBox));
+}
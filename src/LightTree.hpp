@@ -0,0 +1,107 @@
+//===============================================================================================//
+/*!
+ *  \file      LightTree.hpp
+ *  \author    Loïc Corenthy
+ *  \version   1.2
+ *  \date      19/10/2026
+ *  \copyright (c) 2026 Loïc Corenthy. All rights reserved.
+ */
+//===============================================================================================//
+
+#pragma once
+
+#include <list>
+#include <memory>
+#include <vector>
+
+#include "BoundingBox.hpp"
+#include "Point.hpp"
+
+namespace LCNS
+{
+    // Forward declaration
+    class Light;
+
+    /// Bounding volume hierarchy over the punctual lights of a scene. Each node knows the sum of the intensities of its lights, which gives a
+    /// conservative bound on what the lights of the node can bring to a point: a punctual light of intensity I at distance d contributes
+    /// I / (1 + d), so a node can contribute at most sum(I) / (1 + distance to its bounding box).
+    /// The lights whose bound is below a threshold are culled and a subset of the remaining ones can be sampled, each sampled light then gets a
+    /// weight of 1 / (probability of being sampled) so that the expected lighting does not change. Lights that are not punctual (directional
+    /// lights for example) do not have a position, they are always selected.
+    class LightTree
+    {
+    public:
+        /// Default constructor
+        LightTree(void) = default;
+
+        /// Copy constructor
+        LightTree(const LightTree& lightTree) = default;
+
+        /// Copy operator
+        LightTree& operator=(const LightTree& lightTree) = default;
+
+        /// Destructor
+        ~LightTree(void) = default;
+
+        /// Build the hierarchy over a list of lights, the index of a light is its position in the list
+        void build(const std::list<std::shared_ptr<Light>>& lights);
+
+        /// Set the bound under which a light is culled (0 to keep all the lights)
+        void threshold(double threshold);
+
+        /// Get the bound under which a light is culled
+        double threshold(void) const noexcept;
+
+        /// Set the average number of punctual lights sampled at each point among the ones above the threshold (0 to keep all of them)
+        void sampleCount(unsigned int count) noexcept;
+
+        /// Get the average number of punctual lights sampled at each point
+        unsigned int sampleCount(void) const noexcept;
+
+        /// Get the number of lights the hierarchy has been built with
+        unsigned int lightCount(void) const noexcept;
+
+        /// Check if every light is always selected with a weight of 1, in this case there is no need to call select()
+        bool selectsAll(void) const noexcept;
+
+        /// Calculate the weight of each light at a point (same order as the list used to build the hierarchy), 0 if the light is not selected
+        void select(const Point& point, std::vector<double>& weights) const;
+
+    private:
+        struct Node
+        {
+            BoundingBox  boundingBox;
+            double       intensity  = 0.0;
+            unsigned int first      = 0u;
+            unsigned int count      = 0u;
+            unsigned int rightChild = 0u;
+        };
+
+        struct PunctualLightData
+        {
+            Point        position;
+            double       intensity = 0.0;
+            unsigned int index     = 0u;
+        };
+
+    private:
+        /// Recursively build the node covering the lights in [first, first + count[, return its index
+        unsigned int _buildNode(unsigned int first, unsigned int count);
+
+        /// Upper bound of the contribution of the lights of a node to a point
+        double _bound(const Node& node, const Point& point) const noexcept;
+
+    private:
+        static constexpr unsigned int _maxLightsPerLeaf = 4u;
+
+    private:
+        std::vector<Node>              _nodes;
+        std::vector<PunctualLightData> _punctualLights;
+        std::vector<unsigned int>      _otherLights;
+        unsigned int                   _lightCount  = 0u;
+        double                         _threshold   = 0.0;
+        unsigned int                   _sampleCount = 0u;
+
+    };  // class LightTree
+
+}  // namespace LCNS
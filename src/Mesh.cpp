@@ -10,25 +10,36 @@
 
 #include "Mesh.hpp"
 
+#include <algorithm>
+#include <limits>
 #include <optional>
+#include <vector>
 
 #include "BoundingBox.hpp"
 #include "Color.hpp"
 #include "Ray.hpp"
 #include "Renderable.hpp"
+#include "Transform.hpp"
 #include "Triangle.hpp"
 #include "Vector.hpp"
 
-using std::mutex;
+using std::max;
+using std::min;
 using std::nullopt;
+using std::numeric_limits;
 using std::optional;
 using std::shared_ptr;
+using std::vector;
 
 using LCNS::BoundingBox;
 using LCNS::Color;
 using LCNS::Mesh;
+using LCNS::Point;
 using LCNS::Ray;
+using LCNS::Real;
 using LCNS::Renderable;
+using LCNS::Transform;
+using LCNS::Triangle;
 using LCNS::Vector;
 
 Mesh::Mesh(void)
@@ -61,12 +72,17 @@ const BoundingBox& Mesh::boundingBox(void) const
     return _boundingBox;
 }
 
+const vector<Triangle>& Mesh::triangles(void) const noexcept
+{
+    return _triangles;
+}
+
 bool Mesh::intersect(LCNS::Ray& ray)
 {
     // Check if the ray intersect the bounding box
     if (_boundingBox.intersect(ray))
     {
-        auto        closestDist    = std::numeric_limits<double>::max();
+        auto        closestDist    = std::numeric_limits<Real>::max();
         Renderable* rClosestObject = nullptr;
         Renderable* objectFromRay  = ray.intersected();
 
@@ -110,6 +126,11 @@ Color Mesh::color(const Ray& ray, unsigned int reflectionCount)
     return _triangles[_intersectedTriangle].color(ray, reflectionCount);
 }
 
+Color Mesh::color(const Ray& ray, const Color* lightIntensities, unsigned int reflectionCount)
+{
+    return _triangles[_intersectedTriangle].color(ray, lightIntensities, reflectionCount);
+}
+
 Vector Mesh::normal(const Point& position) const
 {
     return _triangles[_intersectedTriangle].normal(position);
@@ -135,3 +156,28 @@ optional<Ray> Mesh::refractedRay(const Ray& incomingRay)
     assert(false && "Not implemented yet :)");
     return nullopt;
 }
+
+void Mesh::transform(const Transform& transform)
+{
+    if (_triangles.empty())
+        return;
+
+    Point boxMin(numeric_limits<Real>::max());
+    Point boxMax(numeric_limits<Real>::lowest());
+
+    for (auto& triangle : _triangles)
+    {
+        triangle.transform(transform);
+
+        for (const auto& vertex : triangle.vertexPositions())
+        {
+            for (unsigned int j = 0; j < 3; ++j)
+            {
+                boxMin[j] = min(boxMin[j], vertex[j]);
+                boxMax[j] = max(boxMax[j], vertex[j]);
+            }
+        }
+    }
+
+    boundingBoxLimits(boxMin, boxMax);
+}
@@ -27,7 +27,7 @@
 
 namespace LCNS
 {
-    class Mesh : public Renderable
+    class Mesh final : public Renderable
     {
     public:
         /// Default constructor
@@ -54,12 +54,18 @@ namespace LCNS
         /// Get bounding box (read only)
         const BoundingBox& boundingBox(void) const;
 
+        /// Get the triangles of the mesh (read only)
+        const std::vector<Triangle>& triangles(void) const noexcept;
+
         /// Virtual function from Renderable
         bool intersect(Ray& ray) override;
 
         /// Virtual function from Renderable
         Color color(const Ray& ray, unsigned int reflectionCount = 0) override;
 
+        /// Virtual function from Renderable
+        Color color(const Ray& ray, const Color* lightIntensities, unsigned int reflectionCount) override;
+
         /// Virtual function from Renderable
         Vector normal(const Point& position) const override;
 
@@ -72,6 +78,9 @@ namespace LCNS
         /// Virtual function from Renderable
         std::optional<Ray> refractedRay(const Ray& incomingRay) override;
 
+        /// Virtual function from Renderable, the bounding box is computed again around the moved triangles
+        void transform(const Transform& transform) override;
+
     private:
         std::vector<Triangle> _triangles;
         BoundingBox           _boundingBox;
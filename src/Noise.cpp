@@ -10,32 +10,97 @@
 
 #include "Noise.hpp"
 
+#include <algorithm>
+#include <array>
+#include <cassert>
+
 using namespace LCNS;
 using namespace std;
 
-const int Noise::smPermutations[]
-= { 151, 160, 137, 91,  90,  15,  131, 13,  201, 95,  96,  53,  194, 233, 7,   225, 140, 36,  103, 30,  69,  142, 8,   99,  37,  240, 21,  10,  23,
-    190, 6,   148, 247, 120, 234, 75,  0,   26,  197, 62,  94,  252, 219, 203, 117, 35,  11,  32,  57,  177, 33,  88,  237, 149, 56,  87,  174, 20,
-    125, 136, 171, 168, 68,  175, 74,  165, 71,  134, 139, 48,  27,  166, 77,  146, 158, 231, 83,  111, 229, 122, 60,  211, 133, 230, 220, 105, 92,
-    41,  55,  46,  245, 40,  244, 102, 143, 54,  65,  25,  63,  161, 1,   216, 80,  73,  209, 76,  132, 187, 208, 89,  18,  169, 200, 196, 135, 130,
-    116, 188, 159, 86,  164, 100, 109, 198, 173, 186, 3,   64,  52,  217, 226, 250, 124, 123, 5,   202, 38,  147, 118, 126, 255, 82,  85,  212, 207,
-    206, 59,  227, 47,  16,  58,  17,  182, 189, 28,  42,  23,  183, 170, 213, 119, 248, 152, 2,   44,  154, 163, 70,  221, 153, 101, 155, 167, 43,
-    172, 9,   129, 22,  39,  253, 19,  98,  108, 110, 79,  113, 224, 232, 178, 185, 112, 104, 218, 246, 97,  228, 251, 34,  242, 193, 238, 210, 144,
-    12,  191, 179, 162, 241, 81,  51,  145, 235, 249, 14,  239, 107, 49,  192, 214, 31,  181, 199, 106, 157, 184, 84,  204, 176, 115, 121, 50,  45,
-    127, 4,   150, 254, 138, 236, 205, 93,  222, 114, 67,  29,  24,  72,  243, 141, 128, 195, 78,  66,  215, 61,  156, 180 };
+namespace
+{
+    /// Reference permutation of the improved Perlin noise
+    constexpr array<unsigned int, 256> basePermutations
+    = { 151, 160, 137, 91,  90,  15,  131, 13,  201, 95,  96,  53,  194, 233, 7,   225, 140, 36,  103, 30,  69,  142, 8,   99,  37,  240, 21,  10,  23,
+        190, 6,   148, 247, 120, 234, 75,  0,   26,  197, 62,  94,  252, 219, 203, 117, 35,  11,  32,  57,  177, 33,  88,  237, 149, 56,  87,  174, 20,
+        125, 136, 171, 168, 68,  175, 74,  165, 71,  134, 139, 48,  27,  166, 77,  146, 158, 231, 83,  111, 229, 122, 60,  211, 133, 230, 220, 105, 92,
+        41,  55,  46,  245, 40,  244, 102, 143, 54,  65,  25,  63,  161, 1,   216, 80,  73,  209, 76,  132, 187, 208, 89,  18,  169, 200, 196, 135, 130,
+        116, 188, 159, 86,  164, 100, 109, 198, 173, 186, 3,   64,  52,  217, 226, 250, 124, 123, 5,   202, 38,  147, 118, 126, 255, 82,  85,  212, 207,
+        206, 59,  227, 47,  16,  58,  17,  182, 189, 28,  42,  23,  183, 170, 213, 119, 248, 152, 2,   44,  154, 163, 70,  221, 153, 101, 155, 167, 43,
+        172, 9,   129, 22,  39,  253, 19,  98,  108, 110, 79,  113, 224, 232, 178, 185, 112, 104, 218, 246, 97,  228, 251, 34,  242, 193, 238, 210, 144,
+        12,  191, 179, 162, 241, 81,  51,  145, 235, 249, 14,  239, 107, 49,  192, 214, 31,  181, 199, 106, 157, 184, 84,  204, 176, 115, 121, 50,  45,
+        127, 4,   150, 254, 138, 236, 205, 93,  222, 114, 67,  29,  24,  72,  243, 141, 128, 195, 78,  66,  215, 61,  156, 180 };
 
-const double Noise::_pi = 3.141592653589793238462643383279;
+    /// The permutations are repeated twice so that the indices computed in perlinNoise never need to be wrapped
+    constexpr array<unsigned int, 512> duplicatePermutations(const array<unsigned int, 256>& base) noexcept
+    {
+        array<unsigned int, 512> duplicated = {};
 
-Noise::Noise(void)
-{
-    _init();
-}
+        for (size_t i = 0; i < duplicated.size(); ++i)
+            duplicated[i] = base[i & 255];
+
+        return duplicated;
+    }
+
+    constexpr array<unsigned int, 512> permutations = duplicatePermutations(basePermutations);
+
+    /// Gradient directions selected by the 4 low bits of a hash, each one is the sum of 2 signed axis among x, y and z
+    struct Gradient
+    {
+        double x = 0.0;
+        double y = 0.0;
+        double z = 0.0;
+    };
+
+    constexpr Gradient makeGradient(unsigned int h) noexcept
+    {
+        Gradient gradient;
+
+        const double uSign = (h & 1) == 0 ? 1.0 : -1.0;
+        const double vSign = (h & 2) == 0 ? 1.0 : -1.0;
+
+        if (h < 8 || h == 12 || h == 13)
+            gradient.x = uSign;
+        else
+            gradient.y = uSign;
+
+        if (h < 4 || h == 12 || h == 13)
+            gradient.y = vSign;
+        else
+            gradient.z = vSign;
+
+        return gradient;
+    }
+
+    constexpr array<Gradient, 16> makeGradients(void) noexcept
+    {
+        array<Gradient, 16> gradients = {};
+
+        for (unsigned int h = 0; h < 16; ++h)
+            gradients[h] = makeGradient(h);
+
+        return gradients;
+    }
+
+    constexpr array<Gradient, 16> gradients = makeGradients();
+
+    /// Number of points processed together in the batch version of perlinNoise
+    constexpr size_t laneCount = 4;
+
+    /// Position of the lattice cell containing a coordinate, wrapped to the size of the permutation table
+    unsigned int latticeIndex(double coordinate) noexcept
+    {
+        return static_cast<unsigned int>(static_cast<long long>(floor(coordinate)) & 255);
+    }
+}  // namespace
+
+const double Noise::_pi = 3.141592653589793238462643383279;
 
 double Noise::perlinNoise(double x, double y, double z) const
 {
-    const auto xx = static_cast<size_t>(floor(x)) & 255;
-    const auto yy = static_cast<size_t>(floor(y)) & 255;
-    const auto zz = static_cast<size_t>(floor(z)) & 255;
+    const auto xx = latticeIndex(x);
+    const auto yy = latticeIndex(y);
+    const auto zz = latticeIndex(z);
 
     x -= floor(x);
     y -= floor(y);
@@ -45,41 +110,146 @@ double Noise::perlinNoise(double x, double y, double z) const
     const double v = _fade(y);
     const double w = _fade(z);
 
-    const auto a  = _permutations[xx] + yy;
-    const auto aA = _permutations[a] + zz;
-    const auto aB = _permutations[a + 1] + zz;
-    const auto b  = _permutations[xx + 1] + yy;
-    const auto bA = _permutations[b] + zz;
-    const auto bB = _permutations[b + 1] + zz;
+    const auto a  = permutations[xx] + yy;
+    const auto aA = permutations[a] + zz;
+    const auto aB = permutations[a + 1] + zz;
+    const auto b  = permutations[xx + 1] + yy;
+    const auto bA = permutations[b] + zz;
+    const auto bB = permutations[b + 1] + zz;
 
     double tmp1 = _lerp(v,
-                        _lerp(u, _grad(_permutations[aA], x, y, z), _grad(_permutations[bA], x - 1.0, y, z)),
-                        _lerp(u, _grad(_permutations[aB], x, y - 1.0, z), _grad(_permutations[bB], x - 1.0, y - 1.0, z)));
+                        _lerp(u, _grad(permutations[aA], x, y, z), _grad(permutations[bA], x - 1.0, y, z)),
+                        _lerp(u, _grad(permutations[aB], x, y - 1.0, z), _grad(permutations[bB], x - 1.0, y - 1.0, z)));
 
     double tmp2 = _lerp(v,
-                        _lerp(u, _grad(_permutations[aA + 1], x, y, z - 1.0), _grad(_permutations[bA + 1], x - 1.0, y, z - 1.0)),
-                        _lerp(u, _grad(_permutations[aB + 1], x, y - 1.0, z - 1.0), _grad(_permutations[bB + 1], x - 1.0, y - 1.0, z - 1.0)));
+                        _lerp(u, _grad(permutations[aA + 1], x, y, z - 1.0), _grad(permutations[bA + 1], x - 1.0, y, z - 1.0)),
+                        _lerp(u, _grad(permutations[aB + 1], x, y - 1.0, z - 1.0), _grad(permutations[bB + 1], x - 1.0, y - 1.0, z - 1.0)));
 
     return _lerp(w, tmp1, tmp2);
 }
 
-void Noise::_init(void) noexcept
+void Noise::perlinNoise(const double* x, const double* y, const double* z, double* result, size_t count) const
 {
-    for (unsigned int i = 0; i < 256; i++)
-        _permutations.push_back(smPermutations[i]);
+    // Gradients of the 8 corners of a lattice cell, in the order 000, 100, 010, 110, 001, 101, 011, 111 (xyz)
+    using CornerValues = array<array<double, laneCount>, 8>;
+
+    for (size_t first = 0; first < count; first += laneCount)
+    {
+        const size_t lanes = min(laneCount, count - first);
+
+        // The unused lanes of the last block stay at zero, they are computed but never written back
+        array<double, laneCount> fx = {};
+        array<double, laneCount> fy = {};
+        array<double, laneCount> fz = {};
+        CornerValues             gx = {};
+        CornerValues             gy = {};
+        CornerValues             gz = {};
+
+        // Hashing needs lookups in the permutation table, it is done one point at a time
+        for (size_t lane = 0; lane < lanes; ++lane)
+        {
+            const double px = x[first + lane];
+            const double py = y[first + lane];
+            const double pz = z[first + lane];
+
+            const auto xx = latticeIndex(px);
+            const auto yy = latticeIndex(py);
+            const auto zz = latticeIndex(pz);
+
+            fx[lane] = px - floor(px);
+            fy[lane] = py - floor(py);
+            fz[lane] = pz - floor(pz);
+
+            const auto a  = permutations[xx] + yy;
+            const auto aA = permutations[a] + zz;
+            const auto aB = permutations[a + 1] + zz;
+            const auto b  = permutations[xx + 1] + yy;
+            const auto bA = permutations[b] + zz;
+            const auto bB = permutations[b + 1] + zz;
+
+            const array<unsigned int, 8> hashes = { permutations[aA],     permutations[bA],     permutations[aB],     permutations[bB],
+                                                    permutations[aA + 1], permutations[bA + 1], permutations[aB + 1], permutations[bB + 1] };
+
+            for (size_t corner = 0; corner < hashes.size(); ++corner)
+            {
+                const auto& gradient = gradients[hashes[corner] & 15];
+
+                gx[corner][lane] = gradient.x;
+                gy[corner][lane] = gradient.y;
+                gz[corner][lane] = gradient.z;
+            }
+        }
+
+        // The rest is the same arithmetic for every lane without any branch, the loop has a fixed length so that the compiler can turn it into
+        // packed instructions
+        array<double, laneCount> noise = {};
+
+        for (size_t lane = 0; lane < laneCount; ++lane)
+        {
+            const double x0 = fx[lane];
+            const double y0 = fy[lane];
+            const double z0 = fz[lane];
+            const double x1 = x0 - 1.0;
+            const double y1 = y0 - 1.0;
+            const double z1 = z0 - 1.0;
+
+            const double u = _fade(x0);
+            const double v = _fade(y0);
+            const double w = _fade(z0);
+
+            const double g000 = gx[0][lane] * x0 + gy[0][lane] * y0 + gz[0][lane] * z0;
+            const double g100 = gx[1][lane] * x1 + gy[1][lane] * y0 + gz[1][lane] * z0;
+            const double g010 = gx[2][lane] * x0 + gy[2][lane] * y1 + gz[2][lane] * z0;
+            const double g110 = gx[3][lane] * x1 + gy[3][lane] * y1 + gz[3][lane] * z0;
+            const double g001 = gx[4][lane] * x0 + gy[4][lane] * y0 + gz[4][lane] * z1;
+            const double g101 = gx[5][lane] * x1 + gy[5][lane] * y0 + gz[5][lane] * z1;
+            const double g011 = gx[6][lane] * x0 + gy[6][lane] * y1 + gz[6][lane] * z1;
+            const double g111 = gx[7][lane] * x1 + gy[7][lane] * y1 + gz[7][lane] * z1;
+
+            const double tmp1 = _lerp(v, _lerp(u, g000, g100), _lerp(u, g010, g110));
+            const double tmp2 = _lerp(v, _lerp(u, g001, g101), _lerp(u, g011, g111));
+
+            noise[lane] = _lerp(w, tmp1, tmp2);
+        }
+
+        copy_n(noise.begin(), lanes, result + first);
+    }
+}
+
+double Noise::turbulence(double x, double y, double z, unsigned int octaveCount) const
+{
+    assert(octaveCount <= maxOctaveCount && "Too many octaves for the turbulence");
+    octaveCount = min(octaveCount, maxOctaveCount);
+
+    array<double, maxOctaveCount> xs     = {};
+    array<double, maxOctaveCount> ys     = {};
+    array<double, maxOctaveCount> zs     = {};
+    array<double, maxOctaveCount> noises = {};
+
+    for (unsigned int octave = 0; octave < octaveCount; ++octave)
+    {
+        const auto level = static_cast<double>(octave + 1);
+
+        xs[octave] = level * x;
+        ys[octave] = level * y;
+        zs[octave] = level * z;
+    }
+
+    perlinNoise(xs.data(), ys.data(), zs.data(), noises.data(), octaveCount);
+
+    double sum = 0.0;
+    for (unsigned int octave = 0; octave < octaveCount; ++octave)
+        sum += (1.0 / static_cast<double>(octave + 1)) * fabs(noises[octave]);
 
-    for (unsigned int i = 0; i < 256; i++)
-        _permutations.push_back(smPermutations[i]);
+    return sum;
 }
 
-double Noise::_grad(int hash, double x, double y, double z) const noexcept
+double Noise::_grad(unsigned int hash, double x, double y, double z) const noexcept
 {
-    int h = hash & 15;
-    // CONVERT LO 4 BITS OF HASH CODE
-    const auto u = (h < 8 || h == 12 || h == 13) ? x : y;  // INTO 12 GRADIENT DIRECTIONS.
-    const auto v = (h < 4 || h == 12 || h == 13) ? y : z;
+    // The 4 low bits of the hash code select one of the 12 gradient directions
+    const auto& gradient = gradients[hash & 15];
 
-    return (((h & 1) == 0 ? u : -u) + ((h & 2) == 0 ? v : -v));
+    return gradient.x * x + gradient.y * y + gradient.z * z;
 }
 
 double Noise::_fade(double t) const noexcept
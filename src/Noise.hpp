@@ -10,16 +10,20 @@
 
 #pragma once
 
-#include <vector>
+#include <cstddef>
 #include <cmath>
 
 namespace LCNS
 {
     class Noise
     {
+    public:
+        /// Maximum number of octaves that can be summed by the turbulence function
+        static constexpr unsigned int maxOctaveCount = 16u;
+
     public:
         /// Default constructor
-        Noise(void);
+        Noise(void) = default;
 
         /// Copy constructor
         Noise(const Noise& noise) = default;
@@ -33,10 +37,13 @@ namespace LCNS
         /// Perlin noise
         double perlinNoise(double x, double y, double z) const;
 
-    private:
-        /// Initialize the array of permutations
-        void _init(void) noexcept;
+        /// Perlin noise of several points at once, the coordinates of the points are given as separate arrays (x[i], y[i], z[i])
+        void perlinNoise(const double* x, const double* y, const double* z, double* result, std::size_t count) const;
 
+        /// Sum of the absolute values of the noise at levels 1 to octaveCount, each one weighted by the inverse of its level
+        double turbulence(double x, double y, double z, unsigned int octaveCount) const;
+
+    private:
         /// Return the value of a polynom for parameter t : t
         double _fade(double t) const noexcept;
 
@@ -44,7 +51,7 @@ namespace LCNS
         constexpr double _lerp(double t, double a, double b) const noexcept;
 
         /// Some gradient?
-        double _grad(int hash, double x, double y, double z) const noexcept;
+        double _grad(unsigned int hash, double x, double y, double z) const noexcept;
 
         /// Pseudo random number generator
         double _prandFromInt(int value) const noexcept;
@@ -53,9 +60,7 @@ namespace LCNS
         double _cerp(double a, double b, double t) const noexcept;
 
     private:
-        static const int    smPermutations[256];
         static const double _pi;
-        std::vector<size_t> _permutations;
 
     };  // class Noise
 
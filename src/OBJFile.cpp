@@ -0,0 +1,375 @@
+//===============================================================================================//
+/*!
+ *  \file      OBJFile.cpp
+ *  \author    Loïc Corenthy
+ *  \version   1.2
+ *  \date      19/10/2026
+ *  \copyright (c) 2026 Loïc Corenthy. All rights reserved.
+ */
+//===============================================================================================//
+
+#include "OBJFile.hpp"
+
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "Real.hpp"
+#include "Trace.hpp"
+#include "Vector.hpp"
+
+using std::cerr;
+using std::endl;
+using std::ifstream;
+using std::size_t;
+using std::stoi;
+using std::string;
+using std::stringstream;
+using std::vector;
+
+using LCNS::OBJFile;
+using LCNS::OBJParameters;
+using LCNS::Point;
+using LCNS::toReal;
+using LCNS::TraceScope;
+using LCNS::Triangle;
+using LCNS::Vector;
+
+namespace
+{
+    /// Limits of an empty bounding box, any vertex is inside them
+    const Point emptyMinPoint(1000000.0, 1000000.0, 1000000.0);
+    const Point emptyMaxPoint(-1000000.0, -1000000.0, -1000000.0);
+}  // namespace
+
+OBJFile::OBJFile(const string& path)
+: _path(path)
+{
+    _isLoaded = _read();
+}
+
+const string& OBJFile::path(void) const noexcept
+{
+    return _path;
+}
+
+const vector<OBJFile::Object>& OBJFile::objects(void) const noexcept
+{
+    return _objects;
+}
+
+bool OBJFile::isLoaded(void) const noexcept
+{
+    return _isLoaded;
+}
+
+bool OBJFile::_read(void)
+{
+    TraceScope traceScope("OBJFile::read", "scene");
+
+    // Count the different parameters (vertices, normals, faces, ...) in the file
+    OBJParameters parameters;
+    _countVerticesAndFaces(parameters);
+
+    // Create containers for the vertices and normals
+    vector<Point> vertices;
+    vertices.reserve(parameters.vertexCount);
+
+    vector<Vector> normals;
+    if (parameters.normalCount > 0)
+        normals.reserve(parameters.normalCount);
+
+    // Index of the mesh containing all the triangles of the current group (none between a "g default" line and the name of the next group)
+    constexpr size_t noMesh      = static_cast<size_t>(-1);
+    size_t           currentMesh = noMesh;
+
+    Point minPoint = emptyMinPoint;
+    Point maxPoint = emptyMaxPoint;
+
+    Point  tmpPoint(0.0, 0.0, 0.0);
+    Vector tmpNormal(0.0, 0.0, 0.0);
+
+    // Create the triangles
+    ifstream objFile(_path.c_str(), ifstream::in);
+
+    if (!objFile)
+    {
+        cerr << "ERROR: Impossible to open file " << _path << endl;
+        return false;
+    }
+
+    string       line;
+    unsigned int currentObjectIdx = 0;
+    bool         lineNotProcessed = true;
+    bool         firstGDefault    = true;
+
+    while (getline(objFile, line))
+    {
+        stringstream stringStream(line);
+        string       word;
+        lineNotProcessed = true;
+
+        switch (line[0])
+        {
+            case 'g':
+                if (line == "g default")
+                {
+                    if (firstGDefault)
+                        firstGDefault = false;
+                    else
+                    {
+                        if (currentMesh != noMesh)
+                        {
+                            _objects[currentMesh].minPoint = minPoint;
+                            _objects[currentMesh].maxPoint = maxPoint;
+                        }
+
+                        currentMesh = noMesh;
+                        minPoint    = emptyMinPoint;
+                        maxPoint    = emptyMaxPoint;
+                        currentObjectIdx++;
+                    }
+                }
+                else
+                {
+                    currentMesh = _objects.size();
+
+                    auto& mesh  = _objects.emplace_back();
+                    mesh.isMesh = true;
+
+                    if (currentObjectIdx < parameters.faceCount.size())
+                        mesh.triangles.reserve(parameters.faceCount[currentObjectIdx]);
+
+                    // Read the "g"
+                    stringStream >> word;
+
+                    // Read the name of the object
+                    stringStream >> word;
+
+                    mesh.name = word;
+                }
+                break;
+
+            case 'v':
+                if (line[1] == ' ')
+                {
+                    while (stringStream.good() && lineNotProcessed)
+                    {
+                        double tmpDoubleValue = 0.0;
+
+                        // Read the "v"
+                        stringStream >> word;
+
+                        // Read the x coordinate of the vertex
+                        stringStream >> tmpDoubleValue;
+                        tmpPoint.x(toReal(tmpDoubleValue));
+
+                        stringStream >> tmpDoubleValue;
+                        tmpPoint.y(toReal(tmpDoubleValue));
+
+                        stringStream >> tmpDoubleValue;
+                        tmpPoint.z(toReal(tmpDoubleValue));
+
+                        vertices.push_back(tmpPoint);
+
+                        lineNotProcessed = false;
+                    }
+                }
+                else if (line[1] == 'n')
+                {
+                    while (stringStream.good() && lineNotProcessed)
+                    {
+                        double tmpDoubleValue = 0.0;
+
+                        // Read the "vn"
+                        stringStream >> word;
+
+                        // Read the x coordinate of the vertex
+                        stringStream >> tmpDoubleValue;
+                        tmpNormal.setX(toReal(tmpDoubleValue));
+
+                        stringStream >> tmpDoubleValue;
+                        tmpNormal.setY(toReal(tmpDoubleValue));
+
+                        stringStream >> tmpDoubleValue;
+                        tmpNormal.setZ(toReal(tmpDoubleValue));
+
+                        normals.push_back(tmpNormal);
+
+                        lineNotProcessed = false;
+                    }
+                }
+                break;
+
+            case 'f':
+                if (parameters.textureCount == 0 && parameters.normalCount == 0)
+                {
+                    // The faces without normals are triangles on their own
+                    while (stringStream.good() && lineNotProcessed)
+                    {
+                        Triangle     triangle;
+                        unsigned int vertexIdx = 0;
+
+                        // Read the "f"
+                        stringStream >> word;
+
+                        // Read the first vertex index
+                        stringStream >> vertexIdx;
+                        triangle.vertexPositions()[0] = vertices[vertexIdx - 1];
+
+                        // Read the second vertex index
+                        stringStream >> vertexIdx;
+                        triangle.vertexPositions()[1] = vertices[vertexIdx - 1];
+
+                        // Read the third vertex index
+                        stringStream >> vertexIdx;
+                        triangle.vertexPositions()[2] = vertices[vertexIdx - 1];
+
+                        // Calculate the normal
+                        triangle.updateNormal();
+
+                        auto& object = _objects.emplace_back();
+                        object.triangles.push_back(triangle);
+
+                        lineNotProcessed = false;
+                    }
+                }
+                else
+                {
+                    // The faces before the name of their group are in a mesh without name
+                    if (currentMesh == noMesh)
+                    {
+                        currentMesh                    = _objects.size();
+                        _objects.emplace_back().isMesh = true;
+                    }
+
+                    while (stringStream.good() && lineNotProcessed)
+                    {
+                        Triangle triangle;
+
+                        // Read the "f"
+                        stringStream >> word;
+
+                        for (unsigned int i = 0; i < 3; ++i)
+                        {
+                            // Read the first combination of vertex/texture/normal indices
+                            stringStream >> word;
+
+                            char* str = new char[word.size() + 1];
+                            strcpy(str, word.c_str());
+
+                            char*      subStr    = strtok(str, "/");
+                            const auto vertexIdx = static_cast<unsigned int>(stoi(subStr));
+
+                            subStr = strtok(NULL, "/");
+                            static_cast<void>(stoi(subStr));
+
+                            subStr               = strtok(NULL, "/");
+                            const auto normalIdx = static_cast<unsigned int>(stoi(subStr));
+
+                            delete[] str;
+
+                            const auto& vertex = vertices[vertexIdx - 1];
+
+                            triangle.vertexPositions()[i] = vertex;
+
+                            // Update bounding box
+                            if (vertex.x() < minPoint.x())
+                                minPoint.x(vertex.x());
+
+                            if (vertex.y() < minPoint.y())
+                                minPoint.y(vertex.y());
+
+                            if (vertex.z() < minPoint.z())
+                                minPoint.z(vertex.z());
+
+                            if (vertex.x() > maxPoint.x())
+                                maxPoint.x(vertex.x());
+
+                            if (vertex.y() > maxPoint.y())
+                                maxPoint.y(vertex.y());
+
+                            if (vertex.z() > maxPoint.z())
+                                maxPoint.z(vertex.z());
+
+                            triangle.vertexNormals()[i] = normals[normalIdx - 1];
+                        }
+
+                        // Calculate the normal
+                        triangle.updateNormal();
+
+                        _objects[currentMesh].triangles.push_back(triangle);
+
+                        lineNotProcessed = false;
+                    }
+                }
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    // Set the bounding box of the last object
+    if (currentMesh != noMesh)
+    {
+        _objects[currentMesh].minPoint = minPoint;
+        _objects[currentMesh].maxPoint = maxPoint;
+    }
+
+    return true;
+}
+
+void OBJFile::_countVerticesAndFaces(OBJParameters& parameters) const
+{
+    TraceScope traceScope("OBJFile::countVerticesAndFaces", "scene");
+
+    // Open file
+    ifstream objFile(_path.c_str(), ifstream::in);
+
+    if (objFile)
+    {
+        string line;
+
+        // Read all the lines
+        while (getline(objFile, line))
+        {
+            // Check the first character
+            switch (line[0])
+            {
+                // If it's a "v", increase the vertex count
+                case 'v':
+                    if (line[1] == ' ')
+                        ++parameters.vertexCount;
+                    else if (line[1] == 't')
+                        ++parameters.textureCount;
+                    else if (line[1] == 'n')
+                        ++parameters.normalCount;
+                    break;
+
+                // If it's a "f", increase the face count
+                case 'f':
+                    ++parameters.currentFaceCount;
+                    break;
+
+                case 'g':
+                    if (line == "g default" && parameters.currentFaceCount != 0)
+                    {
+                        parameters.faceCount.push_back(parameters.currentFaceCount);
+                        parameters.currentFaceCount = 0u;
+                    }
+                    break;
+
+                default:
+                    break;
+            }
+        }
+
+        // Save the number of faces of the last object
+        parameters.faceCount.push_back(parameters.currentFaceCount);
+        parameters.currentFaceCount = 0u;
+    }
+}
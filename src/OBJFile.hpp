@@ -0,0 +1,80 @@
+//===============================================================================================//
+/*!
+ *  \file      OBJFile.hpp
+ *  \author    Loïc Corenthy
+ *  \version   1.2
+ *  \date      19/10/2026
+ *  \copyright (c) 2026 Loïc Corenthy. All rights reserved.
+ */
+//===============================================================================================//
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "OBJParameters.hpp"
+#include "Point.hpp"
+#include "Triangle.hpp"
+
+namespace LCNS
+{
+    /// Objects of a .obj file, read without a scene so that several files can be read at the same time (the objects are then created in a
+    /// scene with Scene::createFromFile). Each group of faces of the file is a mesh, except the faces without normals which are triangles
+    /// on their own.
+    class OBJFile
+    {
+    public:
+        /// Object of the file, in the order of the file
+        struct Object
+        {
+            std::string           name;
+            bool                  isMesh = false;
+            std::vector<Triangle> triangles;
+            Point                 minPoint;  ///< Bounding box of the triangles of a mesh
+            Point                 maxPoint;
+        };
+
+    public:
+        /// Constructor with the path of the file, which is read (no object if it can not be read)
+        explicit OBJFile(const std::string& path);
+
+        /// Copy constructor (copy not allowed)
+        OBJFile(const OBJFile& objFile) = delete;
+
+        /// Move constructor
+        OBJFile(OBJFile&& objFile) = default;
+
+        /// Copy operator (copy not allowed)
+        OBJFile& operator=(const OBJFile& objFile) = delete;
+
+        /// Move operator
+        OBJFile& operator=(OBJFile&& objFile) = default;
+
+        /// Destructor
+        ~OBJFile(void) = default;
+
+        /// Get the path of the file
+        const std::string& path(void) const noexcept;
+
+        /// Get the objects of the file (read only)
+        const std::vector<Object>& objects(void) const noexcept;
+
+        /// Check if the file has been read
+        bool isLoaded(void) const noexcept;
+
+    private:
+        /// Read the objects of the file
+        bool _read(void);
+
+        /// Count the number of vertices and faces in the file
+        void _countVerticesAndFaces(OBJParameters& parameters) const;
+
+    private:
+        std::string         _path;
+        std::vector<Object> _objects;
+        bool                _isLoaded = false;
+
+    };  // class OBJFile
+
+}  // namespace LCNS
@@ -74,14 +74,14 @@ Color Phong::reflectance([[maybe_unused]] const Vector& vecToLight,
     double cosAlpha = vecToLightCopy * normal;
 
     // Calculate specular coefficient
-    double cosBeta   = (vecToLightCopy * normal) * 2.0;
+    Real   cosBeta   = (vecToLightCopy * normal) * Real{ 2.0 };
     Vector reflexion = vecNormal * cosBeta - vecToLightCopy;
 
     cosBeta = reflexion * vecToViewerCopy;
 
     // Set negative coefficents to zero
     cosAlpha = (cosAlpha < 0.0) ? 0.0 : cosAlpha;
-    cosBeta  = (cosBeta < 0.0) ? 0.0 : cosBeta;
+    cosBeta  = (cosBeta < Real{ 0.0 }) ? Real{ 0.0 } : cosBeta;
 
     const auto cubeMap = BRDF::cubeMap();
     if (cubeMap)
@@ -135,12 +135,12 @@ Color Phong::specular([[maybe_unused]] const Vector& vecToLight,
     vecToViewerCopy.normalize();
 
     // Calculate specular coefficient
-    double cosBeta   = (vecToLightCopy * normal) * 2.0;
+    Real   cosBeta   = (vecToLightCopy * normal) * Real{ 2.0 };
     Vector reflexion = vecNormal * cosBeta - vecToLightCopy;
     cosBeta          = reflexion * vecToViewerCopy;
 
     // Set negative coefficents to zero
-    cosBeta = (cosBeta < 0.0) ? 0.0 : cosBeta;
+    cosBeta = (cosBeta < Real{ 0.0 }) ? Real{ 0.0 } : cosBeta;
 
     return (_specularColor * pow(cosBeta, _exponent));
 }
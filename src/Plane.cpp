@@ -12,7 +12,7 @@
 
 using namespace LCNS;
 
-Plane::Plane(double a, double b, double c, double d)
+Plane::Plane(Real a, Real b, Real c, Real d)
 : _equationCoeffs{ a, b, c, d }
 , _normal(a, b, c)
 {
@@ -54,15 +54,15 @@ Plane& Plane::operator=(const Plane& plane)
 
 bool Plane::intersect(Ray& ray)
 {
-    const double scalarProd = ray.direction() * _normal;
+    const Real scalarProd = ray.direction() * _normal;
 
     // Check if ray is not parallel to triangle
-    if (scalarProd != 0.0)
+    if (scalarProd != Real{ 0.0 })
     {
         const Vector origin(ray.origin().x(), ray.origin().y(), ray.origin().z());
 
         // Calculate the lenght the ray when intersecting the plane
-        const double length = (-1.0) * (origin * _normal + _equationCoeffs[3]) / (scalarProd);
+        const Real length = -(origin * _normal + _equationCoeffs[3]) / scalarProd;
 
         ray.length(length);
         ray.intersected(nullptr);
@@ -73,7 +73,7 @@ bool Plane::intersect(Ray& ray)
         return false;
 }
 
-void Plane::coefficient(unsigned int index, double value)
+void Plane::coefficient(unsigned int index, Real value)
 {
     assert(index < 4 && "index out of boundaries for the coefficients");
     _equationCoeffs[index] = value;
@@ -94,7 +94,7 @@ void Plane::position(const Point& position)
     _updateEquation();
 }
 
-double Plane::coefficient(unsigned int index) const
+Real Plane::coefficient(unsigned int index) const
 {
     assert(index < 4 && "index out of boundaries for the coefficients");
     return _equationCoeffs[index];
@@ -117,7 +117,7 @@ void Plane::_updateEquation(void)
     _equationCoeffs[2] = _normal.z();
 
     const Vector position(_position.x(), _position.y(), _position.z());
-    _equationCoeffs[3] = (_normal * position) * (-1.0);
+    _equationCoeffs[3] = -(_normal * position);
 }
 
 void Plane::_updateNormal(void)
@@ -127,6 +127,6 @@ void Plane::_updateNormal(void)
 
 void Plane::_updatePosition(void)
 {
-    assert(_equationCoeffs[2] != 0.0 && "Problem in updating position in plane");
-    _position.set(_equationCoeffs[1] * (-1.0), _equationCoeffs[0], _equationCoeffs[3] / _equationCoeffs[2] * (-1.0));
+    assert(_equationCoeffs[2] != Real{ 0.0 } && "Problem in updating position in plane");
+    _position.set(-_equationCoeffs[1], _equationCoeffs[0], -_equationCoeffs[3] / _equationCoeffs[2]);
 }
@@ -25,7 +25,7 @@ namespace LCNS
         Plane(void) = default;
 
         /// Constructor with equation coefficients
-        Plane(double a, double b, double c, double d);
+        Plane(Real a, Real b, Real c, Real d);
 
         /// Constructor with position and normal direction
         Plane(const Vector& normal, const Point& position);
@@ -43,7 +43,7 @@ namespace LCNS
         bool intersect(Ray& ray);
 
         /// Set the coefficients of the equation
-        void coefficient(unsigned int index, double value);
+        void coefficient(unsigned int index, Real value);
 
         /// Set the normal vector
         void normal(const Vector& normal);
@@ -52,7 +52,7 @@ namespace LCNS
         void position(const Point& position);
 
         /// Get the coefficients of the equation
-        double coefficient(unsigned int index) const;
+        Real coefficient(unsigned int index) const;
 
         /// Get the normal vector
         Vector normal(void) const;
@@ -71,7 +71,7 @@ namespace LCNS
         void _updatePosition(void);
 
     private:
-        double _equationCoeffs[4] = { 0.0, 0.0, 0.0, 0.0 };
+        Real _equationCoeffs[4] = { 0.0, 0.0, 0.0, 0.0 };
         Point  _position;
         Vector _normal;
 
@@ -17,72 +17,166 @@
 
 namespace LCNS
 {
+    /// Point in 3D, all the operations are defined in this header to be inlined like the ones of Vector
     class Point
     {
     public:
         /// Default constructor
-        Point(void) = default;
+        constexpr Point(void) = default;
 
         /// Constructor with position parameters
-        Point(double x, double y, double z);
+        constexpr Point(Real x, Real y, Real z) noexcept;
 
         /// Constructor with same value for all coordinates
-        explicit Point(double commonValue);
+        constexpr explicit Point(Real commonValue) noexcept;
 
         /// Copy constructor
-        Point(const Point& point);
+        constexpr Point(const Point& point) = default;
 
         /// Destructor
         ~Point(void) = default;
 
         /// Copy operator
-        Point& operator=(const Point& point);
+        constexpr Point& operator=(const Point& point) = default;
 
         /// Coordinate operator (read only)
-        double operator[](unsigned int index) const;
+        constexpr Real operator[](unsigned int index) const;
 
         /// Coordinate operator (read,write)
-        double& operator[](unsigned int index);
+        constexpr Real& operator[](unsigned int index);
 
         /// Create a vector by subtracting 2 points
-        Vector operator-(const Point& point) const noexcept;
+        constexpr Vector operator-(const Point& point) const noexcept;
 
         /// Translate a point by a vector
-        Point operator+(const Vector& vector) const noexcept;
+        constexpr Point operator+(const Vector& vector) const noexcept;
+
+        /// Translate a point by a vector multiplied by a scalar (this + vector * scalar) without any temporary vector, e.g. to get the point at
+        /// a given length along a ray
+        constexpr Point offset(const Vector& vector, Real scalar) const noexcept;
 
         /// Set 3 coordinates
-        void set(double x, double y, double z) noexcept;
+        constexpr void set(Real x, Real y, Real z) noexcept;
 
         /// Set X coordinate
-        void x(double x) noexcept;
+        constexpr void x(Real x) noexcept;
 
         /// Set Y coordinate
-        void y(double y) noexcept;
+        constexpr void y(Real y) noexcept;
 
         /// Set Z coordinate
-        void z(double z) noexcept;
+        constexpr void z(Real z) noexcept;
 
         /// Get X coordinate (read only)
-        double x(void) const noexcept;
+        constexpr Real x(void) const noexcept;
 
         /// Get X coordinate (read only)
-        double y(void) const noexcept;
+        constexpr Real y(void) const noexcept;
 
         /// Get X coordinate (read only)
-        double z(void) const noexcept;
+        constexpr Real z(void) const noexcept;
 
         /// Get X coordinate (read/write )
-        double& x(void) noexcept;
+        constexpr Real& x(void) noexcept;
 
         /// Get X coordinate (read/write)
-        double& y(void) noexcept;
+        constexpr Real& y(void) noexcept;
 
         /// Get X coordinate (read/write)
-        double& z(void) noexcept;
+        constexpr Real& z(void) noexcept;
 
     private:
-        double _coords[3] = { 0.0, 0.0, 0.0 };
+        Real _coords[3] = { 0.0, 0.0, 0.0 };
 
     };  // class Point
 
+    constexpr Point::Point(Real x, Real y, Real z) noexcept
+    : _coords{ x, y, z }
+    {
+    }
+
+    constexpr Point::Point(Real commonValue) noexcept
+    : _coords{ commonValue, commonValue, commonValue }
+    {
+    }
+
+    constexpr Real Point::operator[](unsigned int index) const
+    {
+        assert(index < 3 && "Point: index out of bounds");
+        return _coords[index];
+    }
+
+    constexpr Real& Point::operator[](unsigned int index)
+    {
+        assert(index < 3 && "Point: index out of bounds");
+        return _coords[index];
+    }
+
+    constexpr Vector Point::operator-(const Point& point) const noexcept
+    {
+        return Vector(_coords[0] - point._coords[0], _coords[1] - point._coords[1], _coords[2] - point._coords[2]);
+    }
+
+    constexpr Point Point::operator+(const Vector& vector) const noexcept
+    {
+        return Point(_coords[0] + vector.x(), _coords[1] + vector.y(), _coords[2] + vector.z());
+    }
+
+    constexpr Point Point::offset(const Vector& vector, Real scalar) const noexcept
+    {
+        return Point(_coords[0] + vector.x() * scalar, _coords[1] + vector.y() * scalar, _coords[2] + vector.z() * scalar);
+    }
+
+    constexpr void Point::set(Real x, Real y, Real z) noexcept
+    {
+        _coords[0] = x;
+        _coords[1] = y;
+        _coords[2] = z;
+    }
+
+    constexpr void Point::x(Real x) noexcept
+    {
+        _coords[0] = x;
+    }
+
+    constexpr void Point::y(Real y) noexcept
+    {
+        _coords[1] = y;
+    }
+
+    constexpr void Point::z(Real z) noexcept
+    {
+        _coords[2] = z;
+    }
+
+    constexpr Real Point::x(void) const noexcept
+    {
+        return _coords[0];
+    }
+
+    constexpr Real Point::y(void) const noexcept
+    {
+        return _coords[1];
+    }
+
+    constexpr Real Point::z(void) const noexcept
+    {
+        return _coords[2];
+    }
+
+    constexpr Real& Point::x(void) noexcept
+    {
+        return _coords[0];
+    }
+
+    constexpr Real& Point::y(void) noexcept
+    {
+        return _coords[1];
+    }
+
+    constexpr Real& Point::z(void) noexcept
+    {
+        return _coords[2];
+    }
+
 }  // namespace LCNS
@@ -19,6 +19,7 @@
 #include "Ray.hpp"
 #include "Scene.hpp"
 #include "Renderable.hpp"
+#include "Transform.hpp"
 #include "Vector.hpp"
 
 using std::shared_ptr;
@@ -26,6 +27,8 @@ using std::shared_ptr;
 using LCNS::Color;
 using LCNS::Point;
 using LCNS::PunctualLight;
+using LCNS::Real;
+using LCNS::Transform;
 using LCNS::Vector;
 
 PunctualLight::PunctualLight(const LCNS::Point& position, const Color& intensity)
@@ -78,12 +81,17 @@ Color PunctualLight::intensityAt(const LCNS::Point& point, const Scene& scene, R
 
     // Check if there is an object between them. Ask for at least 2 intersections points with the scene as the ray will always intersect with the
     // object containing the point point.
-    bool hasIntersection = scene.intersect(myRay);
+    bool hasIntersection = _isOccluded(myRay, scene);
 
     // If an object is found, or if the light is inside the object, this light does not contribute on that point. Otherwise, calculate the amount of
     // light arriving at the point
-    if (hasIntersection || (direction * currentObject->normal(point) <= 0.0))
+    if (hasIntersection || (direction * currentObject->normal(point) <= Real{ 0.0 }))
         return Color{ 0.0 };
     else
-        return _intensity * (1.0 / (1.0 + direction.length()));
+        return _intensity * (1.0 / (1.0 + double{ direction.length() }));
+}
+
+void PunctualLight::transform(const Transform& transform)
+{
+    _position = transform.apply(_position);
 }
@@ -52,6 +52,9 @@ namespace LCNS
         /// Implementation of virtual function from Light
         Vector directionFrom(const Point& point) const override;
 
+        /// Implementation of virtual function from Light
+        void transform(const Transform& transform) override;
+
     private:
         Point _position;
 
@@ -15,6 +15,7 @@
 using std::shared_ptr;
 
 using LCNS::Point;
+using LCNS::Real;
 using LCNS::Ray;
 using LCNS::Renderable;
 using LCNS::Vector;
@@ -45,12 +46,12 @@ void Ray::direction(const Vector& vector)
     _direction = vector;
 }
 
-double Ray::length(void) const
+Real Ray::length(void) const
 {
     return _length;
 }
 
-void Ray::length(double length)
+void Ray::length(Real length)
 {
     _length = length;
 }
@@ -67,5 +68,5 @@ Renderable* Ray::intersected(void)
 
 Point Ray::intersection(void) const
 {
-    return (_origin + _direction * _length);
+    return _origin.offset(_direction, _length);
 }
@@ -53,10 +53,10 @@ namespace LCNS
         void direction(const Vector& vector);
 
         /// Get the length of the ray
-        double length(void) const;
+        Real length(void) const;
 
         /// Set the length of the ray
-        void length(double length);
+        void length(Real length);
 
         /// Get a pointer on the intersected object
         Renderable* intersected(void);
@@ -70,7 +70,7 @@ namespace LCNS
     private:
         Point       _origin;
         Vector      _direction;
-        double      _length      = std::numeric_limits<double>::max();
+        Real      _length      = std::numeric_limits<Real>::max();
         Renderable* _intersected = nullptr;
 
     };  // Class Ray
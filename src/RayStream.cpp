@@ -0,0 +1,136 @@
+//===============================================================================================//
+/*!
+ *  \file      RayStream.cpp
+ *  \author    Loïc Corenthy
+ *  \version   1.2
+ *  \date      19/10/2026
+ *  \copyright (c) 2026 Loïc Corenthy. All rights reserved.
+ */
+//===============================================================================================//
+
+#include "RayStream.hpp"
+
+#include <cassert>
+
+using std::size_t;
+
+using LCNS::Point;
+using LCNS::Ray;
+using LCNS::RayStream;
+using LCNS::Renderable;
+using LCNS::Vector;
+
+void RayStream::push(const Ray& ray, unsigned int sampleIndex, unsigned int rayDepth)
+{
+    // The ray is copied since intersected() is not const
+    Ray copy(ray);
+
+    originX.push_back(copy.origin().x());
+    originY.push_back(copy.origin().y());
+    originZ.push_back(copy.origin().z());
+    directionX.push_back(copy.direction().x());
+    directionY.push_back(copy.direction().y());
+    directionZ.push_back(copy.direction().z());
+    length.push_back(copy.length());
+    intersected.push_back(copy.intersected());
+    sample.push_back(sampleIndex);
+    depth.push_back(rayDepth);
+}
+
+void RayStream::push(const RayStream& rayStream, size_t index)
+{
+    assert(index < rayStream.size() && "Ray index out of range");
+
+    originX.push_back(rayStream.originX[index]);
+    originY.push_back(rayStream.originY[index]);
+    originZ.push_back(rayStream.originZ[index]);
+    directionX.push_back(rayStream.directionX[index]);
+    directionY.push_back(rayStream.directionY[index]);
+    directionZ.push_back(rayStream.directionZ[index]);
+    length.push_back(rayStream.length[index]);
+    intersected.push_back(rayStream.intersected[index]);
+    sample.push_back(rayStream.sample[index]);
+    depth.push_back(rayStream.depth[index]);
+}
+
+Ray RayStream::ray(size_t index) const
+{
+    assert(index < size() && "Ray index out of range");
+
+    Ray result(Point(originX[index], originY[index], originZ[index]), Vector(directionX[index], directionY[index], directionZ[index]));
+    result.length(length[index]);
+    result.intersected(intersected[index]);
+
+    return result;
+}
+
+void RayStream::intersection(size_t index, const Ray& ray)
+{
+    assert(index < size() && "Ray index out of range");
+
+    Ray copy(ray);
+
+    length[index]      = copy.length();
+    intersected[index] = copy.intersected();
+}
+
+Point RayStream::intersection(size_t index) const
+{
+    assert(index < size() && "Ray index out of range");
+
+    return Point(originX[index] + directionX[index] * length[index],
+                 originY[index] + directionY[index] * length[index],
+                 originZ[index] + directionZ[index] * length[index]);
+}
+
+size_t RayStream::size(void) const noexcept
+{
+    return sample.size();
+}
+
+bool RayStream::empty(void) const noexcept
+{
+    return sample.empty();
+}
+
+void RayStream::clear(void) noexcept
+{
+    originX.clear();
+    originY.clear();
+    originZ.clear();
+    directionX.clear();
+    directionY.clear();
+    directionZ.clear();
+    length.clear();
+    intersected.clear();
+    sample.clear();
+    depth.clear();
+}
+
+void RayStream::reserve(size_t count)
+{
+    originX.reserve(count);
+    originY.reserve(count);
+    originZ.reserve(count);
+    directionX.reserve(count);
+    directionY.reserve(count);
+    directionZ.reserve(count);
+    length.reserve(count);
+    intersected.reserve(count);
+    sample.reserve(count);
+    depth.reserve(count);
+}
+
+void RayStream::swap(RayStream& rayStream) noexcept
+{
+    originX.swap(rayStream.originX);
+    originY.swap(rayStream.originY);
+    originZ.swap(rayStream.originZ);
+    directionX.swap(rayStream.directionX);
+    directionY.swap(rayStream.directionY);
+    directionZ.swap(rayStream.directionZ);
+    length.swap(rayStream.length);
+    intersected.swap(rayStream.intersected);
+    sample.swap(rayStream.sample);
+    depth.swap(rayStream.depth);
+}
@@ -0,0 +1,85 @@
+//===============================================================================================//
+/*!
+ *  \file      RayStream.hpp
+ *  \author    Loïc Corenthy
+ *  \version   1.2
+ *  \date      19/10/2026
+ *  \copyright (c) 2026 Loïc Corenthy. All rights reserved.
+ */
+//===============================================================================================//
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "Ray.hpp"
+
+namespace LCNS
+{
+    // Forward declaration
+    class Renderable;
+
+    /// Queue of rays stored as a structure of arrays, each component of the rays is contiguous in memory so that a stage of the wavefront
+    /// pipeline can process all the rays of the queue with simple loops. Every ray keeps the index of the sample it contributes to and its depth
+    /// in the ray tree.
+    class RayStream
+    {
+    public:
+        /// Default constructor
+        RayStream(void) = default;
+
+        /// Copy constructor
+        RayStream(const RayStream& rayStream) = default;
+
+        /// Copy operator
+        RayStream& operator=(const RayStream& rayStream) = default;
+
+        /// Destructor
+        ~RayStream(void) = default;
+
+        /// Add a ray at the end of the stream
+        void push(const Ray& ray, unsigned int sample, unsigned int depth);
+
+        /// Add a copy of a ray of another stream at the end of the stream
+        void push(const RayStream& rayStream, std::size_t index);
+
+        /// Build the ray at a position in the stream
+        Ray ray(std::size_t index) const;
+
+        /// Store the result of the intersection of a ray of the stream
+        void intersection(std::size_t index, const Ray& ray);
+
+        /// Get the intersection point of a ray of the stream
+        Point intersection(std::size_t index) const;
+
+        /// Get the number of rays in the stream
+        std::size_t size(void) const noexcept;
+
+        /// Check if the stream is empty
+        bool empty(void) const noexcept;
+
+        /// Remove all the rays, the memory is kept for the next use of the stream
+        void clear(void) noexcept;
+
+        /// Reserve the memory for a number of rays
+        void reserve(std::size_t count);
+
+        /// Swap the content of 2 streams
+        void swap(RayStream& rayStream) noexcept;
+
+    public:
+        std::vector<Real>         originX;
+        std::vector<Real>         originY;
+        std::vector<Real>         originZ;
+        std::vector<Real>         directionX;
+        std::vector<Real>         directionY;
+        std::vector<Real>         directionZ;
+        std::vector<Real>         length;
+        std::vector<Renderable*>  intersected;
+        std::vector<unsigned int> sample;
+        std::vector<unsigned int> depth;
+
+    };  // class RayStream
+
+}  // namespace LCNS
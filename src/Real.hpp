@@ -0,0 +1,43 @@
+//===============================================================================================//
+/*!
+ *  \file      Real.hpp
+ *  \author    Loïc Corenthy
+ *  \version   1.2
+ *  \date      19/10/2026
+ *  \copyright (c) 2026 Loïc Corenthy. All rights reserved.
+ */
+//===============================================================================================//
+
+#pragma once
+
+namespace LCNS
+{
+    /// Floating point type of the geometry (points, vectors, rays and intersections). It is double unless RAY_TRACING_FLOAT is defined
+    /// (ENABLE_FLOAT_PRECISION option of CMake), float halves the memory used by the meshes and the rays.
+    ///
+    /// intersectionEpsilon is the distance under which the intersection tests ignore a hit and by which the edges of the triangles are widened.
+    /// Float rounding errors are large enough for a ray leaving a triangle to hit its neighbour, or for a ray to go through the shared edge of
+    /// two triangles, double ones are not.
+#ifdef RAY_TRACING_FLOAT
+    using Real = float;
+
+    constexpr Real intersectionEpsilon = 1.0e-4f;
+
+    /// Round a double to the floating point type of the geometry
+    constexpr Real toReal(double value) noexcept
+    {
+        return static_cast<Real>(value);
+    }
+#else
+    using Real = double;
+
+    constexpr Real intersectionEpsilon = 0.0;
+
+    /// Round a double to the floating point type of the geometry
+    constexpr Real toReal(double value) noexcept
+    {
+        return value;
+    }
+#endif
+
+}  // namespace LCNS
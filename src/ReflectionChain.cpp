@@ -0,0 +1,127 @@
+//===============================================================================================//
+/*!
+ *  \file      ReflectionChain.cpp
+ *  \author    Loïc Corenthy
+ *  \version   1.2
+ *  \date      19/10/2026
+ *  \copyright (c) 2026 Loïc Corenthy. All rights reserved.
+ */
+//===============================================================================================//
+
+#include "ReflectionChain.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+#include "Statistics.hpp"
+
+using std::exp2;
+using std::max;
+using std::min;
+using std::uint64_t;
+
+using LCNS::Color;
+using LCNS::Point;
+using LCNS::ReflectionChain;
+using LCNS::Statistics;
+
+namespace
+{
+    /// Mix the bits of a 64 bits integer (splitmix64 finalizer)
+    uint64_t mix(uint64_t value) noexcept
+    {
+        value ^= value >> 30;
+        value *= 0xbf58476d1ce4e5b9ull;
+        value ^= value >> 27;
+        value *= 0x94d049bb133111ebull;
+        value ^= value >> 31;
+
+        return value;
+    }
+
+    /// Bits of a double
+    uint64_t bits(double value) noexcept
+    {
+        uint64_t result = 0u;
+        std::memcpy(&result, &value, sizeof(result));
+
+        return result;
+    }
+
+    /// Random number in [0, 1[ that only depends on the point hit by a reflection and on its count
+    double uniform(const Point& point, unsigned int reflectionCount) noexcept
+    {
+        uint64_t hash = mix(bits(point.x()) + 0x632be59bd9b4e019ull);
+        hash          = mix(hash ^ bits(point.y()));
+        hash          = mix(hash ^ bits(point.z()));
+        hash          = mix(hash ^ reflectionCount);
+
+        // Keep the 53 bits of the mantissa
+        return static_cast<double>(hash >> 11) * 0x1.0p-53;
+    }
+}  // namespace
+
+ReflectionChain::ReflectionChain(double threshold, bool russianRoulette) noexcept
+: _threshold(threshold)
+, _russianRoulette(russianRoulette)
+{
+}
+
+void ReflectionChain::start(const Color& color, double reflectionCoeff) noexcept
+{
+    if (_threshold <= 0.0)
+        return;
+
+    _color = color;
+    _light = reflectionCoeff * max(max(color.red(), color.green()), color.blue());
+}
+
+Color ReflectionChain::contribution(const Color& color, unsigned int reflectionCount) noexcept
+{
+    if (_threshold <= 0.0)
+        return color;
+
+    // The light of the point hit, attenuated by the reflection coefficient of its shader but not by the reflection count
+    const double squaredCount = static_cast<double>(reflectionCount) * static_cast<double>(reflectionCount);
+    _light                    = max(_light, max(max(color.red(), color.green()), color.blue()) * squaredCount);
+
+    const Color weighted = _weight == 1.0 ? color : color * _weight;
+    _color += weighted;
+
+    return weighted;
+}
+
+bool ReflectionChain::next(const Point& point, unsigned int reflectionCount, unsigned int reflectionCountMax) noexcept
+{
+    if (_threshold <= 0.0 || reflectionCount + 1u >= reflectionCountMax)
+        return true;
+
+    // Color expected from the rest of the chain, each reflection j bringing light / j^2
+    double expected = 0.0;
+    for (unsigned int j = reflectionCount + 1u; j < reflectionCountMax; ++j)
+        expected += _light / (static_cast<double>(j) * static_cast<double>(j));
+
+    expected *= _weight;
+
+    // Change of the pixel after tone mapping, the component with the least light so far is the one that changes the most
+    const double darkest = min(min(_color.red(), _color.green()), _color.blue());
+    const double change  = exp2(-max(darkest, 0.0)) * (1.0 - exp2(-expected));
+
+    if (change >= _threshold)
+        return true;
+
+    if (_russianRoulette)
+    {
+        const double survival = max(change / _threshold, _minSurvival);
+        if (uniform(point, reflectionCount) < survival)
+        {
+            _weight /= survival;
+            return true;
+        }
+    }
+
+    Statistics::count(Statistics::Counter::STOPPED_REFLECTIONS);
+    return false;
+}
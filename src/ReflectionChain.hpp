@@ -0,0 +1,67 @@
+//===============================================================================================//
+/*!
+ *  \file      ReflectionChain.hpp
+ *  \author    Loïc Corenthy
+ *  \version   1.2
+ *  \date      19/10/2026
+ *  \copyright (c) 2026 Loïc Corenthy. All rights reserved.
+ */
+//===============================================================================================//
+
+#pragma once
+
+#include "Color.hpp"
+#include "Point.hpp"
+
+namespace LCNS
+{
+    /// Throughput of the reflections of a primary ray, to stop the chain when the next reflections can not change the pixel anymore.
+    /// The reflection j brings the light of the point it hits attenuated by reflectionCoeff / j^2 (see Shader::color). The chain keeps the
+    /// brightest attenuated light seen so far (starting with the primary intersection) as an estimate of what the next points reflect, so a
+    /// reflection in the shadow does not hide a bright one behind it. The tone mapping 1 - 2^-x of the pixel changes by at most
+    /// 2^-x * (1 - 2^-dx) when dx is added to x, which gives the change of the pixel expected from the rest of the chain. When it is below a
+    /// threshold, the chain either stops (deterministic cutoff, biased but without noise) or goes on with a probability proportional to it
+    /// (Russian roulette). A chain that survives the roulette weights its next reflections by the inverse of its probability, so that the
+    /// expected color is the one of the whole chain. The threshold is a fraction of the pixel range but it is not a bound: the estimate
+    /// assumes that no point further along the chain is brighter than the ones already seen, so a bright point behind dim ones can still
+    /// change the pixel by more (up to 5 steps of 8 bits with a threshold of 0.004 on scene 12).
+    class ReflectionChain
+    {
+    public:
+        /// Constructor with the change of the pixel under which the chain stops (0 to trace all the reflections) and the Russian roulette
+        explicit ReflectionChain(double threshold = 0.0, bool russianRoulette = false) noexcept;
+
+        /// Copy constructor
+        ReflectionChain(const ReflectionChain& reflectionChain) = default;
+
+        /// Copy operator
+        ReflectionChain& operator=(const ReflectionChain& reflectionChain) = default;
+
+        /// Destructor
+        ~ReflectionChain(void) = default;
+
+        /// Start the chain at the primary intersection, with its color (ambient and diffusion) and the reflection coefficient of its shader
+        void start(const Color& color, double reflectionCoeff) noexcept;
+
+        /// Get the color a reflection brings to the pixel (weighted by the inverse of the probability that the chain reached it)
+        Color contribution(const Color& color, unsigned int reflectionCount) noexcept;
+
+        /// Check if the reflection after the reflection count hit by the chain is traced, reflectionCountMax is the maximum count of the
+        /// shader of the primary intersection. The Russian roulette only depends on the point hit, the same chain gets the same result
+        /// whatever the thread or the rendering backend. The chains stopped are counted in the statistics.
+        bool next(const Point& point, unsigned int reflectionCount, unsigned int reflectionCountMax) noexcept;
+
+    private:
+        /// Probability to go on under the threshold (Russian roulette only), never 0 for the roulette to stay unbiased
+        static constexpr double _minSurvival = 0.05;
+
+    private:
+        double _threshold       = 0.0;
+        bool   _russianRoulette = false;
+        double _weight          = 1.0;
+        double _light           = 0.0;  ///< Brightest light reflected to the chain, before the attenuation of the reflection count
+        Color  _color;                  ///< Color of the pixel before tone mapping (without the refraction)
+
+    };  // class ReflectionChain
+
+}  // namespace LCNS
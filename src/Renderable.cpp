@@ -17,6 +17,7 @@ using std::shared_ptr;
 
 using LCNS::Renderable;
 using LCNS::Shader;
+using LCNS::toReal;
 
 void Renderable::shader(shared_ptr<Shader> shader)
 {
@@ -58,7 +59,7 @@ bool Renderable::_refraction(const Vector& incomingDirection, const Vector& norm
     else
     {
         const double cosTheta2 = sqrt(1.0 - sqrSinTheta2);
-        refractedDirection     = (incomingDirection - normal * minusCosTheta1) * n - normal * cosTheta2;
+        refractedDirection     = (incomingDirection - normal * toReal(minusCosTheta1)) * toReal(n) - normal * toReal(cosTheta2);
         return true;
     }
 }
@@ -23,6 +23,7 @@ namespace LCNS
     class Shader;
     class Vector;
     class Point;
+    class Transform;
 
     class Renderable
     {
@@ -44,6 +45,9 @@ namespace LCNS
         /// Get the color of the object at the intersection with the ray
         virtual Color color(const Ray& ray, unsigned int reflectionCount = 0) = 0;
 
+        /// Get the color of the object at the intersection with the ray, from the intensities of the lights of the scene at the intersection
+        virtual Color color(const Ray& ray, const Color* lightIntensities, unsigned int reflectionCount) = 0;
+
         /// Get the normal of the object at a specific position
         virtual Vector normal(const Point& position) const = 0;
 
@@ -53,6 +57,9 @@ namespace LCNS
         /// Calculate refracted ray from incoming ray
         virtual std::optional<Ray> refractedRay(const Ray& incomingRay) = 0;
 
+        /// Move the object (animated scenes)
+        virtual void transform(const Transform& transform) = 0;
+
         /// Set a shader
         virtual void shader(std::shared_ptr<Shader> shader);
 
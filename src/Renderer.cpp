@@ -17,25 +17,37 @@
 #include <vector>
 #include <chrono>
 
+#include "AOVBuffer.hpp"
 #include "Buffer.hpp"
+#include "Denoiser.hpp"
 #include "Scene.hpp"
 #include "Vector.hpp"
 #include "Point.hpp"
 #include "Ray.hpp"
+#include "ReflectionChain.hpp"
 #include "Renderable.hpp"
 #include "Shader.hpp"
 #include "Phong.hpp"
 #include "Noise.hpp"
+#include "ShadowCache.hpp"
+#include "Statistics.hpp"
+#include "Trace.hpp"
+#include "Wavefront.hpp"
 
 using std::ceil;
 using std::cerr;
 using std::cout;
 using std::endl;
 using std::make_tuple;
+using std::make_unique;
+using std::min;
+using std::nullopt;
+using std::optional;
 using std::runtime_error;
 using std::shared_ptr;
 using std::string;
 using std::thread;
+using std::to_string;
 using std::tuple;
 using std::vector;
 using std::chrono::duration;
@@ -43,14 +55,36 @@ using std::chrono::duration_cast;
 using std::chrono::milliseconds;
 using std::chrono::steady_clock;
 
+using LCNS::AOVBuffer;
 using LCNS::Buffer;
+using LCNS::Camera;
+using LCNS::Checkpoint;
+using LCNS::Color;
+using LCNS::CostBuffer;
+using LCNS::Denoiser;
+using LCNS::ReflectionChain;
 using LCNS::Renderer;
+using LCNS::ShadowCache;
+using LCNS::Statistics;
+using LCNS::Tile;
+using LCNS::toReal;
+using LCNS::TraceScope;
 
 const Buffer& Renderer::getBuffer(void)
 {
     return _instance()._buffer;
 }
 
+const CostBuffer& Renderer::getCostBuffer(void)
+{
+    return _instance()._costBuffer;
+}
+
+const AOVBuffer& Renderer::getAOVBuffer(void)
+{
+    return _instance()._aovBuffer;
+}
+
 void Renderer::setScene(shared_ptr<Scene> scene, unsigned int width, unsigned int height)
 {
     _instance()._setScene(scene, width, height);
@@ -61,6 +95,31 @@ void Renderer::render(void)
     _instance()._render();
 }
 
+void Renderer::renderTile(const Tile& tile)
+{
+    _instance()._render(tile);
+}
+
+void Renderer::renderProgressive(void)
+{
+    _instance()._renderProgressive();
+}
+
+void Renderer::cancelRender(void)
+{
+    _instance()._cancelRender();
+}
+
+bool Renderer::isRendering(void)
+{
+    return _instance()._backgroundRendering;
+}
+
+Camera& Renderer::camera(void)
+{
+    return *_instance()._scene->cameraList().front();
+}
+
 bool Renderer::isSuperSamplingActive(void)
 {
     return _instance()._isSuperSamplingActive();
@@ -86,6 +145,126 @@ void Renderer::displayRenderTime(bool activate)
     _instance()._displayRenderTime(activate);
 }
 
+Statistics Renderer::statistics(void)
+{
+    return _instance()._statistics;
+}
+
+bool Renderer::isWavefrontActive(void)
+{
+    return _instance()._isWavefrontActive();
+}
+
+unsigned int Renderer::threadCount(void)
+{
+    return _instance()._threadCount();
+}
+
+void Renderer::setThreadCount(unsigned int count)
+{
+    _instance()._setThreadCount(count);
+}
+
+void Renderer::setWavefront(bool activate)
+{
+    _instance()._setWavefront(activate);
+}
+
+bool Renderer::isRaySortingActive(void)
+{
+    return _instance()._isRaySortingActive();
+}
+
+void Renderer::setRaySorting(bool activate)
+{
+    _instance()._setRaySorting(activate);
+}
+
+double Renderer::lightThreshold(void)
+{
+    return _instance()._lightThreshold();
+}
+
+void Renderer::setLightThreshold(double threshold)
+{
+    _instance()._setLightThreshold(threshold);
+}
+
+unsigned int Renderer::lightSampleCount(void)
+{
+    return _instance()._lightSampleCount();
+}
+
+void Renderer::setLightSampleCount(unsigned int count)
+{
+    _instance()._setLightSampleCount(count);
+}
+
+double Renderer::reflectionThreshold(void)
+{
+    return _instance()._reflectionThreshold;
+}
+
+void Renderer::setReflectionThreshold(double threshold)
+{
+    _instance()._setReflectionThreshold(threshold);
+}
+
+bool Renderer::isRussianRouletteActive(void)
+{
+    return _instance()._isRussianRouletteActive();
+}
+
+void Renderer::setRussianRoulette(bool activate)
+{
+    _instance()._setRussianRoulette(activate);
+}
+
+CostBuffer::Metric Renderer::costMetric(void)
+{
+    return _instance()._costMetric();
+}
+
+void Renderer::setCostMetric(CostBuffer::Metric metric)
+{
+    _instance()._setCostMetric(metric);
+}
+
+bool Renderer::isAOVRecordingActive(void)
+{
+    return _instance()._isAOVRecordingActive();
+}
+
+void Renderer::setAOVRecording(bool activate)
+{
+    _instance()._setAOVRecording(activate);
+}
+
+unsigned int Renderer::denoiseIterationCount(void)
+{
+    return _instance()._denoiseIterationCount();
+}
+
+void Renderer::setDenoising(unsigned int iterationCount)
+{
+    _instance()._setDenoising(iterationCount);
+}
+
+void Renderer::setCheckpoint(const string& path, const string& frame, double period, bool resume)
+{
+    _instance()._setCheckpoint(path, frame, period, resume);
+}
+
+const Tile& Renderer::cropWindow(void)
+{
+    return _instance()._cropWindow;
+}
+
+void Renderer::setCropWindow(const Tile& window)
+{
+    _instance()._setCropWindow(window);
+}
+
 Renderer::Renderer(void)
 : _buffer()
 {
@@ -97,6 +276,11 @@ Renderer::Renderer(Scene* scene, unsigned int width, unsigned int height)
 {
 }
 
+Renderer::~Renderer(void)
+{
+    _cancelRender();
+}
+
 Renderer& Renderer::_instance(void)
 {
     static Renderer instance;
@@ -105,94 +289,132 @@ Renderer& Renderer::_instance(void)
 
 void Renderer::_render(void)
 {
-    // Start stop watch to measure render duration
-    const auto renderStarts = steady_clock::now();
+    const Tile window = _renderWindow();
+    _render(window);
+
+    // The denoiser filters the whole window at once, the render must have ended. The pixels restored from a checkpoint have no AOVs, the
+    // denoiser would take them for the background and average them with their neighbours
+    if (_denoiseIterations != 0u && !_cancelRequested)
+    {
+        if (_restoredCount == 0u)
+            _denoise(window);
+        else
+            cout << "The render resumed from a checkpoint is not denoised" << endl;
+    }
+}
 
-    // Get the number of processors on the hardware in case multithreading rendering is required
-    const auto processorCount = thread::hardware_concurrency();
+void Renderer::_render(const Tile& tile)
+{
+    TraceScope traceScope("Renderer::render", "render", "pixels", tile.pixelCount());
 
-    if (auto& camera = _scene->cameraList().front(); camera->aperture() == Camera::Aperture::F_SMALL
-                                                     || camera->aperture() == Camera::Aperture::F_MEDIUM
-                                                     || camera->aperture() == Camera::Aperture::F_BIG)
+    if (tile.x + tile.width > _buffer.width() || tile.y + tile.height > _buffer.height())
     {
-        Color meanLight = _scene->meanAmbiantLight();
+        throw runtime_error("The tile to render is not inside the image");
+    }
 
-        const auto allPixelsCount = _buffer.width() * _buffer.height();
-        const auto reductionCoeff = 10.0;
+    // Start stop watch to measure render duration
+    const auto renderStarts = steady_clock::now();
 
-        // Multithreading only if it is required, there are more than 1 processor and there are enough pixels in the image for each thread to process
-        // at least 100 pixels
-        if (_multiThreaded && processorCount > 1 && allPixelsCount > processorCount * reductionCoeff * 100)
-        {
-            cout << "Multi threading on. Processor count: " << processorCount << endl;
+    // Get the number of processors on the hardware in case multithreading rendering is required (unless the number of threads is fixed)
+    const auto processorCount = _renderThreadCount != 0u ? _renderThreadCount : thread::hardware_concurrency();
 
-            _threadHandler(&Renderer::_renderWithApertureInternal, allPixelsCount, processorCount, reductionCoeff, meanLight);
-        }
-        else  // no multithreading
-        {
-            cout << "Single thread rendering" << endl;
+    // Select the rendering method
+    void (Renderer::*renderingMethod)(ThreadData*, unsigned int, const Color&) = &Renderer::_renderNoApertureInternal;
 
-            auto* threadData       = new ThreadData;
-            threadData->startIndex = 0;
-            threadData->endIndex   = allPixelsCount;
-            threadData->runState   = RunState::running;
+    // The wavefront pipeline processes the pixels of a batch together, the cost of a pixel can only be measured when it is rendered depth first
+    const bool wavefront = _wavefront && !_costBuffer.isActive();
+    if (_wavefront && !wavefront)
+    {
+        cout << "The cost of the pixels is measured with depth first rendering" << endl;
+    }
 
-            _renderWithApertureInternal(threadData, 0, meanLight);
-        }
+    if (wavefront)
+    {
+        renderingMethod = &Renderer::_renderWavefrontInternal;
+    }
+    else if (auto& camera = _scene->cameraList().front(); camera->aperture() == Camera::Aperture::F_SMALL
+                                                          || camera->aperture() == Camera::Aperture::F_MEDIUM
+                                                          || camera->aperture() == Camera::Aperture::F_BIG)
+    {
+        renderingMethod = &Renderer::_renderWithApertureInternal;
     }
     else if (_superSampling)
     {
-        Color meanLight = _scene->meanAmbiantLight();
+        renderingMethod = &Renderer::_renderMultiSamplingInternal;
+    }
 
-        const auto allPixelsCount = _buffer.width() * _buffer.height();
-        const auto reductionCoeff = 10.0;
+    // Freeze the scene into the flat arrays and the hierarchies used while rendering (the lights are culled and sampled by the light tree)
+    _scene->lightTree().threshold(_lightCullingThreshold);
+    _scene->lightTree().sampleCount(_lightSamplingCount);
+    _scene->commit();
 
-        // Multithreading only if it is required, there are more than 1 processor and there are enough pixels in the image for each thread to process
-        // at least 100 pixels
-        if (_multiThreaded && processorCount > 1 && allPixelsCount > processorCount * reductionCoeff * 100)
-        {
-            cout << "Multi threading on. Processor count: " << processorCount << endl;
+    // The objects of the scene may have changed since the last render, the occluders cached for the shadow rays are not valid anymore
+    ShadowCache::invalidate();
+    Statistics::reset();
+    _costBuffer.reset();
 
-            _threadHandler(&Renderer::_renderMultiSamplingInternal, allPixelsCount, processorCount, reductionCoeff, meanLight);
-        }
-        else  // no multithreading
-        {
-            cout << "Single thread rendering" << endl;
+    // The AOVs are recorded for themselves or to guide the denoiser
+    _aovBuffer.record(_aovRecording || _denoiseIterations != 0u);
+    if (_aovBuffer.isRecorded())
+    {
+        _aovBuffer.reset();
+        _aovBuffer.identify(_scene->renderableList());
+    }
+
+    Color meanLight = _scene->meanAmbiantLight();
+
+    // The pixels of the tile are numbered row by row, the rendering methods get their position in the buffer with _pixelPosition
+    _tile = tile;
+
+    const auto allPixelsCount = _tile.pixelCount();
+    const auto reductionCoeff = 10.0;
 
-            auto* threadData       = new ThreadData;
-            threadData->startIndex = 0;
-            threadData->endIndex   = allPixelsCount;
-            threadData->runState   = RunState::running;
+    // A resumed render starts after the pixels of the checkpoint, the pixels of the tile are in the same order as in the previous render
+    unsigned int firstIndex = 0u;
+    _restoredCount          = 0u;
+    if (!_checkpointFile.empty())
+    {
+        _checkpoint = make_unique<Checkpoint>(_checkpointFile, _checkpointFrame, _buffer.width(), _buffer.height());
 
-            _renderMultiSamplingInternal(threadData, 0, meanLight);
+        if (_resumeCheckpoint && _checkpoint->read(_buffer))
+        {
+            firstIndex = _checkpoint->renderedCount(_tile);
+            cout << "Resuming from " << _checkpointFile << ", " << firstIndex << " pixels out of " << allPixelsCount << " already rendered" << endl;
         }
+
+        _resumeCheckpoint  = false;
+        _checkpointedCount = firstIndex;
+        _restoredCount     = firstIndex;
+        _lastCheckpoint    = steady_clock::now();
     }
-    else
+
+    // Multithreading only if it is required, there are more than 1 processor and there are enough pixels in the image for each thread to process
+    // at least 100 pixels
+    if (_multiThreaded && processorCount > 1 && allPixelsCount > processorCount * reductionCoeff * 100)
     {
-        Color meanLight = _scene->meanAmbiantLight();
+        cout << "Multi threading on. Processor count: " << processorCount << endl;
 
-        const auto allPixelsCount = _buffer.width() * _buffer.height();
-        const auto reductionCoeff = 10.0;
+        _threadHandler(renderingMethod, firstIndex, allPixelsCount, processorCount, reductionCoeff, meanLight);
+    }
+    else  // no multithreading
+    {
+        cout << "Single thread rendering" << endl;
 
-        // Multithreading only if it is required, there are more than 1 processor and there are enough pixels in the image for each thread to process
-        // at least 100 pixels
-        if (_multiThreaded && processorCount > 1 && allPixelsCount > processorCount * reductionCoeff * 100)
-        {
-            cout << "Multi threading on. Processor count: " << processorCount << endl;
+        // All the pixels in one batch rendered by a single thread, in several batches in the background to be able to cancel the render
+        // between them (the wavefront pipeline only stops at the end of a batch) and to save the finished batches in the checkpoints
+        _threadHandler(renderingMethod, firstIndex, allPixelsCount, 1u, (_backgroundRendering || _checkpoint) ? reductionCoeff : 1.0, meanLight);
+    }
 
-            _threadHandler(&Renderer::_renderNoApertureInternal, allPixelsCount, processorCount, reductionCoeff, meanLight);
-        }
-        else  // no multithreading
-        {
-            cout << "Single thread rendering" << endl;
+    // The threads have written the last checkpoint
+    _checkpoint.reset();
 
-            auto* threadData       = new ThreadData;
-            threadData->startIndex = 0;
-            threadData->endIndex   = allPixelsCount;
-            threadData->runState   = RunState::running;
+    // All the rendering threads have ended, their counters have been merged
+    _statistics = Statistics::merged();
 
-            _renderNoApertureInternal(threadData, 0, meanLight);
-        }
+    if (_cancelRequested)
+    {
+        cout << "\nRender cancelled" << endl;
+        return;
     }
 
     // Display a message when the render is finished
@@ -203,6 +425,9 @@ void Renderer::_render(void)
         const auto             renderFinished = steady_clock::now();
         const duration<double> renderDuration = renderFinished - renderStarts;
         cout << "Render time " << renderDuration.count() << " seconds\n";
+
+        if constexpr (Statistics::enabled)
+            _displayStatistics();
     }
 }
 
@@ -212,11 +437,14 @@ void Renderer::_renderWithApertureInternal(ThreadData* allIndices, unsigned int
     {
         if ((*(allIndices + index)).runState == RunState::running)
         {
+            const auto batchScope = _traceBatch(*(allIndices + index));
+
             const auto& camera = _scene->cameraList().front();
 
-            for (unsigned int i = (*(allIndices + index)).startIndex; i < (*(allIndices + index)).endIndex; ++i)
+            for (unsigned int i = (*(allIndices + index)).startIndex; i < (*(allIndices + index)).endIndex && !_cancelRequested; ++i)
             {
-                const auto [bufferI, bufferJ] = _2DFrom1D(i, _buffer.width());
+                const auto [bufferI, bufferJ] = _pixelPosition(i);
+                const auto pixelCostStart     = _costBuffer.measure();
 
                 // It's possible to use only one camera (front())
                 Vector rayDirection = camera->pixelDirection(bufferI, bufferJ, _buffer);
@@ -237,13 +465,19 @@ void Renderer::_renderWithApertureInternal(ThreadData* allIndices, unsigned int
                     for (double apertureJ = apertureRadius * (-1.0); apertureJ <= apertureRadius; apertureJ += apertureStep)
                     {
                         Point apertureOrigin(firstRay.origin());
-                        apertureOrigin.x(apertureOrigin.x() + apertureI);
-                        apertureOrigin.y(apertureOrigin.y() + apertureJ);
+                        apertureOrigin.x(apertureOrigin.x() + toReal(apertureI));
+                        apertureOrigin.y(apertureOrigin.y() + toReal(apertureJ));
 
                         Ray ray(apertureOrigin, (focalPt - apertureOrigin));
 
+                        Statistics::count(Statistics::Counter::PRIMARY_RAYS);
+
                         if (_scene->intersect(ray))
                         {
+                            // The first intersection of the pixel guides the denoiser (before the ray is reflected)
+                            if (_aovBuffer.isRecorded())
+                                _aovBuffer.add(bufferI, bufferJ, ray, ray.intersected(), camera->apertureColorCoeff(apertureI, apertureJ));
+
                             // Max reflection for the current object
                             unsigned short objectMaxReflection = ray.intersected()->shader()->reflectionCountMax();
 
@@ -264,6 +498,8 @@ void Renderer::_renderWithApertureInternal(ThreadData* allIndices, unsigned int
                                 {
                                     auto refractionRay = checkRefractionRay.value();
 
+                                    Statistics::count(Statistics::Counter::REFRACTION_RAYS);
+
                                     if (_scene->intersect(refractionRay))
                                         refractionColor = refractionRay.intersected()->color(refractionRay, 0);
                                     else
@@ -272,8 +508,10 @@ void Renderer::_renderWithApertureInternal(ThreadData* allIndices, unsigned int
                             }
 
                             // Reflections color
-                            Color          reflectionColor(0.0f);
-                            unsigned short reflectionCount = 1u;
+                            Color           reflectionColor(0.0f);
+                            unsigned short  reflectionCount = 1u;
+                            ReflectionChain reflectionChain(_reflectionThreshold, _russianRoulette);
+                            reflectionChain.start(ambientColor + diffusionColor, ray.intersected()->shader()->reflectionCoeff());
 
                             while (reflectionCount < objectMaxReflection && ray.intersected() != nullptr)
                             {
@@ -283,20 +521,34 @@ void Renderer::_renderWithApertureInternal(ThreadData* allIndices, unsigned int
 
                                 Vector incidentDirection(ray.direction());
                                 Vector normal(ray.intersected()->normal(ray.intersection()));
-                                double reflet              = (incidentDirection * normal) * (2.0);
+                                Real   reflet              = (incidentDirection * normal) * Real{ 2.0 };
                                 Vector reflectionDirection = incidentDirection - normal * reflet;
 
                                 reflection.direction(reflectionDirection);
                                 reflection.intersected(ray.intersected());
 
 
+                                Statistics::count(Statistics::Counter::REFLECTION_RAYS);
+                                Statistics::count(Statistics::Counter::REFLECTION_DEPTH, reflectionCount);
+
                                 if (_scene->intersect(reflection))
-                                    reflectionColor += reflection.intersected()->color(reflection, reflectionCount);  //*specular;
+                                {
+                                    const Color color = reflection.intersected()->color(reflection, reflectionCount);
+                                    reflectionColor += reflectionChain.contribution(color, reflectionCount);
+                                }
                                 else
-                                    reflectionColor += _scene->backgroundColor(reflection)
-                                                       * (1.0 / static_cast<double>((reflectionCount + 1) * (reflectionCount + 1)));
+                                {
+                                    const double attenuation = 1.0 / static_cast<double>((reflectionCount + 1) * (reflectionCount + 1));
+                                    const Color  background  = _scene->backgroundColor(reflection) * attenuation;
+                                    reflectionColor += reflectionChain.contribution(background, reflectionCount);
+                                }
 
                                 ray = reflection;
+
+                                // A reflection that does not hit anything stops the chain anyway
+                                if (ray.intersected() != nullptr && !reflectionChain.next(ray.intersection(), reflectionCount, objectMaxReflection))
+                                    break;
+
                                 reflectionCount++;
                             }
 
@@ -308,6 +560,9 @@ void Renderer::_renderWithApertureInternal(ThreadData* allIndices, unsigned int
                         }
                         else
                         {
+                            if (_aovBuffer.isRecorded())
+                                _aovBuffer.add(bufferI, bufferJ, ray, nullptr, camera->apertureColorCoeff(apertureI, apertureJ));
+
                             Color tmp = _scene->backgroundColor(ray);
                             apertureColor += tmp * camera->apertureColorCoeff(apertureI, apertureJ);
                         }
@@ -321,6 +576,7 @@ void Renderer::_renderWithApertureInternal(ThreadData* allIndices, unsigned int
                 colorAfterToneMapping.blue(1.0 - exp2(apertureColor.blue() * (-1.0)));
 
                 _buffer.pixel(bufferI, bufferJ, colorAfterToneMapping);
+                _costBuffer.cost(bufferI, bufferJ, _costBuffer.measure() - pixelCostStart);
             }
 
             if ((*(allIndices + index)).runState != RunState::sleeping)
@@ -337,11 +593,14 @@ void Renderer::_renderMultiSamplingInternal(ThreadData* allIndices, unsigned int
     {
         if ((*(allIndices + index)).runState == RunState::running)
         {
+            const auto batchScope = _traceBatch(*(allIndices + index));
+
             const auto& camera = _scene->cameraList().front();
 
-            for (unsigned int i = (*(allIndices + index)).startIndex; i < (*(allIndices + index)).endIndex; ++i)
+            for (unsigned int i = (*(allIndices + index)).startIndex; i < (*(allIndices + index)).endIndex && !_cancelRequested; ++i)
             {
-                const auto [bufferI, bufferJ] = _2DFrom1D(i, _buffer.width());
+                const auto [bufferI, bufferJ] = _pixelPosition(i);
+                const auto pixelCostStart     = _costBuffer.measure();
 
                 float ii = static_cast<float>(bufferI);
                 float jj = static_cast<float>(bufferJ);
@@ -358,8 +617,14 @@ void Renderer::_renderMultiSamplingInternal(ThreadData* allIndices, unsigned int
                         Point  rayOrigin    = camera->position();
                         Ray    ray(rayOrigin, rayDirection);
 
+                        Statistics::count(Statistics::Counter::PRIMARY_RAYS);
+
                         if (_scene->intersect(ray))
                         {
+                            // The first intersection of the pixel guides the denoiser (before the ray is reflected)
+                            if (_aovBuffer.isRecorded())
+                                _aovBuffer.add(bufferI, bufferJ, ray, ray.intersected(), contribution);
+
                             // Max reflection for the current object
                             unsigned short objectMaxReflection = ray.intersected()->shader()->reflectionCountMax();
 
@@ -380,6 +645,8 @@ void Renderer::_renderMultiSamplingInternal(ThreadData* allIndices, unsigned int
                                 {
                                     auto refractionRay = checkRefractionRay.value();
 
+                                    Statistics::count(Statistics::Counter::REFRACTION_RAYS);
+
                                     if (_scene->intersect(refractionRay))
                                         refractionColor = refractionRay.intersected()->color(refractionRay, 0);
                                     else
@@ -388,8 +655,11 @@ void Renderer::_renderMultiSamplingInternal(ThreadData* allIndices, unsigned int
                             }
 
                             // Reflections Color
-                            Color          reflectionColor(0.0f);
-                            unsigned short reflectionCount = 1u;
+                            Color           reflectionColor(0.0f);
+                            unsigned short  reflectionCount = 1u;
+                            ReflectionChain reflectionChain(_reflectionThreshold, _russianRoulette);
+                            reflectionChain.start(ambientColor + diffusionColor, ray.intersected()->shader()->reflectionCoeff());
+
                             while (reflectionCount < objectMaxReflection && ray.intersected() != nullptr)  //(c++11)
                             {
                                 // Calculate reflected ray
@@ -398,19 +668,33 @@ void Renderer::_renderMultiSamplingInternal(ThreadData* allIndices, unsigned int
 
                                 const Vector incidentDirection(ray.direction());
                                 const Vector normal(ray.intersected()->normal(ray.intersection()));
-                                const double reflet              = (incidentDirection * normal) * 2.0;
+                                const Real   reflet              = (incidentDirection * normal) * Real{ 2.0 };
                                 const Vector reflectionDirection = incidentDirection - normal * reflet;
 
                                 reflection.direction(reflectionDirection);
                                 reflection.intersected(ray.intersected());
 
+                                Statistics::count(Statistics::Counter::REFLECTION_RAYS);
+                                Statistics::count(Statistics::Counter::REFLECTION_DEPTH, reflectionCount);
+
                                 if (_scene->intersect(reflection))
-                                    reflectionColor += reflection.intersected()->color(reflection, reflectionCount);  //*specular;
+                                {
+                                    const Color color = reflection.intersected()->color(reflection, reflectionCount);
+                                    reflectionColor += reflectionChain.contribution(color, reflectionCount);
+                                }
                                 else
-                                    reflectionColor += _scene->backgroundColor(reflection)
-                                                       * (1.0 / static_cast<double>((reflectionCount + 1) * (reflectionCount + 1)));
+                                {
+                                    const double attenuation = 1.0 / static_cast<double>((reflectionCount + 1) * (reflectionCount + 1));
+                                    const Color  background  = _scene->backgroundColor(reflection) * attenuation;
+                                    reflectionColor += reflectionChain.contribution(background, reflectionCount);
+                                }
 
                                 ray = reflection;
+
+                                // A reflection that does not hit anything stops the chain anyway
+                                if (ray.intersected() != nullptr && !reflectionChain.next(ray.intersection(), reflectionCount, objectMaxReflection))
+                                    break;
+
                                 reflectionCount++;
                             }
 
@@ -428,12 +712,16 @@ void Renderer::_renderMultiSamplingInternal(ThreadData* allIndices, unsigned int
                         }
                         else
                         {
+                            if (_aovBuffer.isRecorded())
+                                _aovBuffer.add(bufferI, bufferJ, ray, nullptr, contribution);
+
                             superSampling += _scene->backgroundColor(ray) * contribution;
                         }
                     }
                 }
 
                 _buffer.pixel(bufferI, bufferJ, superSampling);
+                _costBuffer.cost(bufferI, bufferJ, _costBuffer.measure() - pixelCostStart);
             }
 
             if ((*(allIndices + index)).runState != RunState::sleeping)
@@ -451,93 +739,168 @@ void Renderer::_renderNoApertureInternal(ThreadData* allIndices, unsigned int in
     {
         if ((*(allIndices + index)).runState == RunState::running)
         {
+            const auto batchScope = _traceBatch(*(allIndices + index));
+
             const auto& camera = _scene->cameraList().front();
 
-            for (unsigned int i = (*(allIndices + index)).startIndex; i < (*(allIndices + index)).endIndex; ++i)
+            for (unsigned int i = (*(allIndices + index)).startIndex; i < (*(allIndices + index)).endIndex && !_cancelRequested; ++i)
             {
-                const auto [bufferI, bufferJ] = _2DFrom1D(i, _buffer.width());
+                const auto [bufferI, bufferJ] = _pixelPosition(i);
+                const auto pixelCostStart     = _costBuffer.measure();
 
                 // It's possible to use only one camera (front())
                 const Vector rayDirection = camera->pixelDirection(bufferI, bufferJ, _buffer);
                 const Point  rayOrigin    = camera->position();
                 Ray          ray(rayOrigin, rayDirection);
 
-                if (_scene->intersect(ray))
-                {
-                    // Max reflection for the current object
-                    unsigned short objectMaxReflection = ray.intersected()->shader()->reflectionCountMax();
+                Statistics::count(Statistics::Counter::PRIMARY_RAYS);
 
-                    // Ambient color
-                    Ray   ambiantRay(ray.intersection(), ray.intersected()->normal(ray.intersection()));
-                    Color ambientColor = meanLight * ray.intersected()->shader()->ambientColor(ambiantRay) * 0.1f;
+                _buffer.pixel(bufferI, bufferJ, _primaryRayColor(ray, meanLight, make_tuple(bufferI, bufferJ)));
 
-                    // Diffusion color
-                    Color diffusionColor = ray.intersected()->color(ray, 0);
+                _costBuffer.cost(bufferI, bufferJ, _costBuffer.measure() - pixelCostStart);
+            }
 
-                    // Refraction color
-                    Color refractionColor(0.0);
-                    if (ray.intersected()->shader()->refractionCoeff() > 1.0)
-                    {
-                        auto checkRefractionRay = ray.intersected()->refractedRay(ray);
+            if ((*(allIndices + index)).runState != RunState::sleeping)
+            {
+                (*(allIndices + index)).runState = RunState::done;
+            }
+        }
+    }
+}
 
-                        if (checkRefractionRay)
-                        {
-                            auto refractionRay = checkRefractionRay.value();
+Color Renderer::_primaryRayColor(Ray& ray, const Color& meanLight, optional<tuple<unsigned int, unsigned int>> aovPixel)
+{
+    const bool intersected = _scene->intersect(ray);
 
-                            if (_scene->intersect(refractionRay))
-                                refractionColor = refractionRay.intersected()->color(refractionRay, 0);
-                            else
-                                refractionColor = _scene->backgroundColor(refractionRay);
-                        }
-                    }
+    // The first intersection of the pixel guides the denoiser (before the ray is reflected)
+    if (aovPixel && _aovBuffer.isRecorded())
+    {
+        const auto [bufferI, bufferJ] = aovPixel.value();
+        _aovBuffer.add(bufferI, bufferJ, ray, ray.intersected(), 1.0);
+    }
 
-                    // Reflections color
-                    Color          reflectionColor(0.0f);
-                    unsigned short reflectionCount = 1u;
+    if (!intersected)
+        return _scene->backgroundColor(ray);
 
-                    while (reflectionCount < objectMaxReflection && ray.intersected() != nullptr)
-                    {
-                        // Calculate reflected ray
-                        Ray reflection;
-                        reflection.origin(ray.intersection());
+    // Max reflection for the current object
+    unsigned short objectMaxReflection = ray.intersected()->shader()->reflectionCountMax();
 
-                        const Vector incidentDirection(ray.direction());
-                        const Vector normal(ray.intersected()->normal(ray.intersection()));
-                        const double reflet              = (incidentDirection * normal) * 2.0;
-                        const Vector reflectionDirection = incidentDirection - normal * reflet;
+    // Ambient color
+    Ray   ambiantRay(ray.intersection(), ray.intersected()->normal(ray.intersection()));
+    Color ambientColor = meanLight * ray.intersected()->shader()->ambientColor(ambiantRay) * 0.1f;
 
-                        reflection.direction(reflectionDirection);
-                        reflection.intersected(ray.intersected());
+    // Diffusion color
+    Color diffusionColor = ray.intersected()->color(ray, 0);
 
-                        if (_scene->intersect(reflection))
-                        {
-                            reflectionColor += reflection.intersected()->color(reflection, reflectionCount);  //*specular;
-                        }
-                        else
-                        {
-                            reflectionColor
-                            += _scene->backgroundColor(reflection) * (1.0 / static_cast<double>((reflectionCount + 1) * (reflectionCount + 1)));
-                        }
+    // Refraction color
+    Color refractionColor(0.0);
+    if (ray.intersected()->shader()->refractionCoeff() > 1.0)
+    {
+        auto checkRefractionRay = ray.intersected()->refractedRay(ray);
 
-                        ray = reflection;
-                        reflectionCount++;
-                    }
+        if (checkRefractionRay)
+        {
+            auto refractionRay = checkRefractionRay.value();
 
+            Statistics::count(Statistics::Counter::REFRACTION_RAYS);
 
-                    // Final color equals the sum of all the components
-                    Color finalColor(ambientColor + diffusionColor + reflectionColor + refractionColor);
+            if (_scene->intersect(refractionRay))
+                refractionColor = refractionRay.intersected()->color(refractionRay, 0);
+            else
+                refractionColor = _scene->backgroundColor(refractionRay);
+        }
+    }
 
-                    // Tone mapping
-                    Color colorAfterToneMapping;
-                    colorAfterToneMapping.red(1.0 - exp2(finalColor.red() * (-1.0)));
-                    colorAfterToneMapping.green(1.0 - exp2(finalColor.green() * (-1.0)));
-                    colorAfterToneMapping.blue(1.0 - exp2(finalColor.blue() * (-1.0)));
+    // Reflections color
+    Color           reflectionColor(0.0f);
+    unsigned short  reflectionCount = 1u;
+    ReflectionChain reflectionChain(_reflectionThreshold, _russianRoulette);
+    reflectionChain.start(ambientColor + diffusionColor, ray.intersected()->shader()->reflectionCoeff());
 
-                    _buffer.pixel(bufferI, bufferJ, colorAfterToneMapping);
-                }
-                else
+    while (reflectionCount < objectMaxReflection && ray.intersected() != nullptr)
+    {
+        // Calculate reflected ray
+        Ray reflection;
+        reflection.origin(ray.intersection());
+
+        const Vector incidentDirection(ray.direction());
+        const Vector normal(ray.intersected()->normal(ray.intersection()));
+        const Real   reflet              = (incidentDirection * normal) * Real{ 2.0 };
+        const Vector reflectionDirection = incidentDirection - normal * reflet;
+
+        reflection.direction(reflectionDirection);
+        reflection.intersected(ray.intersected());
+
+        Statistics::count(Statistics::Counter::REFLECTION_RAYS);
+        Statistics::count(Statistics::Counter::REFLECTION_DEPTH, reflectionCount);
+
+        if (_scene->intersect(reflection))
+        {
+            reflectionColor += reflectionChain.contribution(reflection.intersected()->color(reflection, reflectionCount), reflectionCount);
+        }
+        else
+        {
+            const double attenuation = 1.0 / static_cast<double>((reflectionCount + 1) * (reflectionCount + 1));
+            reflectionColor += reflectionChain.contribution(_scene->backgroundColor(reflection) * attenuation, reflectionCount);
+        }
+
+        ray = reflection;
+
+        // A reflection that does not hit anything stops the chain anyway
+        if (ray.intersected() != nullptr && !reflectionChain.next(ray.intersection(), reflectionCount, objectMaxReflection))
+            break;
+
+        reflectionCount++;
+    }
+
+
+    // Final color equals the sum of all the components
+    Color finalColor(ambientColor + diffusionColor + reflectionColor + refractionColor);
+
+    // Tone mapping
+    Color colorAfterToneMapping;
+    colorAfterToneMapping.red(1.0 - exp2(finalColor.red() * (-1.0)));
+    colorAfterToneMapping.green(1.0 - exp2(finalColor.green() * (-1.0)));
+    colorAfterToneMapping.blue(1.0 - exp2(finalColor.blue() * (-1.0)));
+
+    return colorAfterToneMapping;
+}
+
+void Renderer::_renderWavefrontInternal(ThreadData* allIndices, unsigned int index, const Color& meanLight)
+{
+    // One pipeline per thread, the memory of its ray streams is reused from one batch to the next
+    Wavefront wavefront(*_scene, _buffer, meanLight, _superSampling);
+    wavefront.sortSecondaryRays(_raySorting);
+    wavefront.terminateReflections(_reflectionThreshold, _russianRoulette);
+
+    if (_aovBuffer.isRecorded())
+        wavefront.recordAOVs(_aovBuffer);
+
+    while ((*(allIndices + index)).runState != RunState::sleeping)
+    {
+        if ((*(allIndices + index)).runState == RunState::running)
+        {
+            const auto batchScope = _traceBatch(*(allIndices + index));
+
+            const unsigned int startIndex = (*(allIndices + index)).startIndex;
+            const unsigned int endIndex   = (*(allIndices + index)).endIndex;
+
+            // The pipeline numbers the pixels of the whole buffer, the pixels of a tile narrower than the image are rendered row by row
+            if (_tile.width == _buffer.width())
+            {
+                const auto offset = _tile.y * _buffer.width();
+                wavefront.render(offset + startIndex, offset + endIndex);
+            }
+            else
+            {
+                for (unsigned int i = startIndex; i < endIndex;)
                 {
-                    _buffer.pixel(bufferI, bufferJ, _scene->backgroundColor(ray));
+                    const auto [bufferI, bufferJ] = _pixelPosition(i);
+                    const auto rowEnd             = min(endIndex, i + _tile.x + _tile.width - bufferI);
+                    const auto first              = bufferJ * _buffer.width() + bufferI;
+
+                    wavefront.render(first, first + rowEnd - i);
+                    i = rowEnd;
                 }
             }
 
@@ -549,10 +912,125 @@ void Renderer::_renderNoApertureInternal(ThreadData* allIndices, unsigned int in
     }
 }
 
+void Renderer::_renderPreviewInternal(ThreadData* allIndices, unsigned int index, const Color& meanLight)
+{
+    const auto stride      = _previewStride;
+    const auto columnCount = (_tile.width + stride - 1u) / stride;
+    const auto lastI       = _tile.x + _tile.width;
+    const auto lastJ       = _tile.y + _tile.height;
+
+    while ((*(allIndices + index)).runState != RunState::sleeping)
+    {
+        if ((*(allIndices + index)).runState == RunState::running)
+        {
+            TraceScope batchScope("Renderer::previewBatch",
+                                  "render",
+                                  "stride",
+                                  stride,
+                                  "pixels",
+                                  (*(allIndices + index)).endIndex - (*(allIndices + index)).startIndex);
+
+            const auto& camera = _scene->cameraList().front();
+
+            for (unsigned int i = (*(allIndices + index)).startIndex; i < (*(allIndices + index)).endIndex && !_cancelRequested; ++i)
+            {
+                const auto [blockI, blockJ] = _2DFrom1D(i, columnCount);
+                const auto firstI           = _tile.x + blockI * stride;
+                const auto firstJ           = _tile.y + blockJ * stride;
+
+                // The ray goes through the center of the square, which is filled with its color
+                const double centerI = static_cast<double>(firstI) + 0.5 * static_cast<double>(stride - 1u);
+                const double centerJ = static_cast<double>(firstJ) + 0.5 * static_cast<double>(stride - 1u);
+                Ray          ray(camera->position(), camera->pixelDirection(centerI, centerJ, _buffer));
+
+                Statistics::count(Statistics::Counter::PRIMARY_RAYS);
+
+                const Color color = _primaryRayColor(ray, meanLight);
+
+                for (unsigned int bufferJ = firstJ; bufferJ < min(firstJ + stride, lastJ); ++bufferJ)
+                    for (unsigned int bufferI = firstI; bufferI < min(firstI + stride, lastI); ++bufferI)
+                        _buffer.pixel(bufferI, bufferJ, color);
+            }
+
+            if ((*(allIndices + index)).runState != RunState::sleeping)
+            {
+                (*(allIndices + index)).runState = RunState::done;
+            }
+        }
+    }
+}
+
+void Renderer::_renderProgressive(void)
+{
+    _cancelRender();
+
+    // Set before starting the thread so that the render is seen in progress as soon as this function returns
+    _backgroundRendering = true;
+    _backgroundThread    = thread(&Renderer::_renderPasses, this);
+}
+
+void Renderer::_renderPasses(void)
+{
+    TraceScope traceScope("Renderer::renderProgressive", "render");
+
+    _scene->lightTree().threshold(_lightCullingThreshold);
+    _scene->lightTree().sampleCount(_lightSamplingCount);
+
+    // The scene is committed by the thread, an asset that cannot be loaded ends the render without stopping the application
+    try
+    {
+        _scene->commit();
+    }
+    catch (const runtime_error& error)
+    {
+        cerr << "\nThe render failed: " << error.what() << endl;
+        _backgroundRendering = false;
+        return;
+    }
+
+    const Color meanLight = _scene->meanAmbiantLight();
+
+    const auto processorCount = _renderThreadCount != 0u ? _renderThreadCount : thread::hardware_concurrency();
+    const auto reductionCoeff = 10.0;
+
+    // The coarse passes only cover the crop window, starting from its first pixel
+    _tile = _renderWindow();
+
+    // Each pass traces 4 times more pixels than the previous one, the shadow cache is only reset by the full quality render
+    for (const unsigned int stride : { 8u, 4u, 2u })
+    {
+        if (_cancelRequested)
+            break;
+
+        _previewStride = stride;
+
+        const auto blockCount  = ((_tile.width + stride - 1u) / stride) * ((_tile.height + stride - 1u) / stride);
+        const auto threadCount = (_multiThreaded && processorCount > 1 && blockCount > processorCount * reductionCoeff * 100) ? processorCount : 1u;
+        _threadHandler(&Renderer::_renderPreviewInternal, 0u, blockCount, threadCount, reductionCoeff, meanLight);
+    }
+
+    if (!_cancelRequested)
+        _render();
+
+    _backgroundRendering = false;
+}
+
+void Renderer::_cancelRender(void)
+{
+    if (!_backgroundThread.joinable())
+        return;
+
+    _cancelRequested = true;
+    _backgroundThread.join();
+    _cancelRequested = false;
+}
+
 void Renderer::_setScene(shared_ptr<Scene> scene, unsigned int width, unsigned int height)
 {
     assert(scene != nullptr && "The scene assigned to the Renderer is not valid");
     _buffer.dimensions(width, height);
+    _costBuffer.dimensions(width, height);
+    _aovBuffer.dimensions(width, height);
     _scene = scene;
 }
 
@@ -576,6 +1054,231 @@ bool Renderer::_isSuperSamplingActive(void) const
     return _superSampling;
 }
 
+bool Renderer::_isWavefrontActive(void) const
+{
+    return _wavefront;
+}
+
+unsigned int Renderer::_threadCount(void) const
+{
+    return _renderThreadCount;
+}
+
+void Renderer::_setThreadCount(unsigned int count)
+{
+    _renderThreadCount = count;
+}
+
+void Renderer::_setWavefront(bool activate)
+{
+    _wavefront = activate;
+}
+
+bool Renderer::_isRaySortingActive(void) const
+{
+    return _raySorting;
+}
+
+void Renderer::_setRaySorting(bool activate)
+{
+    _raySorting = activate;
+}
+
+double Renderer::_lightThreshold(void) const
+{
+    return _lightCullingThreshold;
+}
+
+void Renderer::_setLightThreshold(double threshold)
+{
+    if (threshold < 0.0)
+    {
+        throw runtime_error("The light threshold cannot be negative");
+    }
+
+    _lightCullingThreshold = threshold;
+}
+
+unsigned int Renderer::_lightSampleCount(void) const
+{
+    return _lightSamplingCount;
+}
+
+void Renderer::_setLightSampleCount(unsigned int count)
+{
+    _lightSamplingCount = count;
+}
+
+void Renderer::_setReflectionThreshold(double threshold)
+{
+    if (threshold < 0.0)
+    {
+        throw runtime_error("The reflection threshold cannot be negative");
+    }
+
+    _reflectionThreshold = threshold;
+}
+
+bool Renderer::_isRussianRouletteActive(void) const
+{
+    return _russianRoulette;
+}
+
+void Renderer::_setRussianRoulette(bool activate)
+{
+    _russianRoulette = activate;
+}
+
+CostBuffer::Metric Renderer::_costMetric(void) const
+{
+    return _costBuffer.metric();
+}
+
+void Renderer::_setCostMetric(CostBuffer::Metric metric)
+{
+    _costBuffer.metric(metric);
+}
+
+bool Renderer::_isAOVRecordingActive(void) const
+{
+    return _aovRecording;
+}
+
+void Renderer::_setAOVRecording(bool activate)
+{
+    _aovRecording = activate;
+}
+
+unsigned int Renderer::_denoiseIterationCount(void) const
+{
+    return _denoiseIterations;
+}
+
+void Renderer::_setDenoising(unsigned int iterationCount)
+{
+    if (iterationCount > Denoiser::maxIterationCount)
+    {
+        throw runtime_error("The denoiser cannot run more than " + to_string(Denoiser::maxIterationCount) + " iterations");
+    }
+
+    _denoiseIterations = iterationCount;
+}
+
+void Renderer::_denoise(const Tile& window)
+{
+    const auto denoiseStarts  = steady_clock::now();
+    const auto processorCount = _renderThreadCount != 0u ? _renderThreadCount : thread::hardware_concurrency();
+
+    Denoiser(_denoiseIterations).denoise(_buffer, _aovBuffer, window, _multiThreaded ? processorCount : 1u);
+
+    if (_shouldDisplayRenderTime)
+    {
+        const duration<double> denoiseDuration = steady_clock::now() - denoiseStarts;
+        cout << "Denoise time " << denoiseDuration.count() << " seconds" << endl;
+    }
+}
+
+void Renderer::_setCropWindow(const Tile& window)
+{
+    if (window.x + window.width > _buffer.width() || window.y + window.height > _buffer.height())
+    {
+        throw runtime_error("The crop window is not inside the image");
+    }
+
+    _cropWindow = window;
+}
+
+Tile Renderer::_renderWindow(void) const
+{
+    if (_cropWindow.pixelCount() == 0u)
+        return Tile{ 0u, 0u, _buffer.width(), _buffer.height() };
+
+    return _cropWindow;
+}
+
+void Renderer::_setCheckpoint(const string& path, const string& frame, double period, bool resume)
+{
+    if (period <= 0.0)
+    {
+        throw runtime_error("The period of the checkpoints must be positive");
+    }
+
+    _checkpointFile   = path;
+    _checkpointFrame  = frame;
+    _checkpointPeriod = period;
+    _resumeCheckpoint = resume;
+}
+
+bool Renderer::_isCheckpointDue(void) const
+{
+    return _checkpoint && steady_clock::now() - _lastCheckpoint >= duration<double>(_checkpointPeriod);
+}
+
+void Renderer::_writeCheckpoint(unsigned int renderedCount)
+{
+    // The pixels rendered since the last checkpoint are the end of a row, full rows and the start of a row of the tile
+    while (_checkpointedCount < renderedCount)
+    {
+        const auto [bufferI, bufferJ] = _pixelPosition(_checkpointedCount);
+        const auto newCount           = renderedCount - _checkpointedCount;
+
+        Tile pixels{ bufferI, bufferJ, min(_tile.x + _tile.width - bufferI, newCount), 1u };
+        if (bufferI == _tile.x && newCount >= _tile.width)
+            pixels.height = newCount / _tile.width;
+
+        _checkpoint->add(_buffer, pixels);
+        _checkpointedCount += pixels.pixelCount();
+    }
+
+    if (!_checkpoint->write())
+        cerr << "\nUnable to write the checkpoint " << _checkpoint->path() << endl;
+
+    _lastCheckpoint = steady_clock::now();
+}
+
+unsigned int Renderer::_renderedCount(const vector<ThreadData>& allRanges, unsigned int range, unsigned int allPixelsCount) const
+{
+    // The batches are handed over in order, all the pixels before the first batch in progress are rendered
+    unsigned int renderedCount = min(range, allPixelsCount);
+    unsigned int startedCount  = renderedCount;
+
+    for (const auto& threadData : allRanges)
+    {
+        if (threadData.startIndex < threadData.endIndex)
+        {
+            startedCount = min(startedCount, threadData.startIndex.load());
+
+            if (threadData.runState == RunState::running)
+                renderedCount = min(renderedCount, threadData.startIndex.load());
+        }
+    }
+
+    // Checked after the states of the threads: a thread stopped by a cancellation is done before the end of its batch
+    return _cancelRequested ? startedCount : renderedCount;
+}
+
+void Renderer::_displayStatistics(void) const
+{
+    using Counter = Statistics::Counter;
+
+    cout << "Primary rays " << _statistics[Counter::PRIMARY_RAYS] << '\n';
+    cout << "Rays intersected with the scene " << _statistics[Counter::SCENE_RAYS] << '\n';
+    cout << "Shadow rays " << _statistics[Counter::SHADOW_RAYS] << '\n';
+    cout << "Shadow cache hits " << _statistics[Counter::SHADOW_CACHE_HITS] << " (misses " << _statistics[Counter::SHADOW_CACHE_MISSES] << ")\n";
+    cout << "Reflection rays " << _statistics[Counter::REFLECTION_RAYS] << " (average depth " << _statistics.averageReflectionDepth() << ")\n";
+    cout << "Reflection chains stopped early " << _statistics[Counter::STOPPED_REFLECTIONS] << '\n';
+    cout << "Refraction rays " << _statistics[Counter::REFRACTION_RAYS] << '\n';
+    cout << "Hits " << _statistics[Counter::HITS] << '\n';
+    cout << "Bounding box tests " << _statistics[Counter::BOX_TESTS] << '\n';
+    cout << "Triangle tests " << _statistics[Counter::TRIANGLE_TESTS] << '\n';
+    cout << "Sphere tests " << _statistics[Counter::SPHERE_TESTS] << '\n';
+}
+
+TraceScope Renderer::_traceBatch(const ThreadData& batch)
+{
+    return TraceScope("Renderer::batch", "render", "first pixel", batch.startIndex, "pixels", batch.endIndex - batch.startIndex);
+}
+
 void Renderer::_displayProgressBar(double currentProgress)
 {
     if (!(0.0 <= currentProgress && currentProgress <= 1.0))
@@ -619,3 +1322,10 @@ tuple<unsigned int, unsigned int> Renderer::_2DFrom1D(unsigned int position, uns
 
     return make_tuple(j, i);
 }
+
+tuple<unsigned int, unsigned int> Renderer::_pixelPosition(unsigned int index) const
+{
+    const auto [i, j] = _2DFrom1D(index, _tile.width);
+
+    return make_tuple(_tile.x + i, _tile.y + j);
+}
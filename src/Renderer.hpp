@@ -10,18 +10,32 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cassert>
+#include <chrono>
+#include <cmath>
 #include <memory>
 #include <atomic>
+#include <string>
+#include <optional>
 #include <thread>
+#include <tuple>
+#include <vector>
 
+#include "AOVBuffer.hpp"
 #include "Buffer.hpp"
 #include "Camera.hpp"
+#include "Checkpoint.hpp"
+#include "CostBuffer.hpp"
+#include "Statistics.hpp"
+#include "Tile.hpp"
 
 namespace LCNS
 {
     // Forward declaration
+    class Ray;
     class Scene;
+    class TraceScope;
 
     class Renderer
     {
@@ -32,18 +46,41 @@ namespace LCNS
         /// Copy operator (copy not allowed)
         Renderer operator=(const Renderer& renderer) = delete;
 
-        /// Destructor
-        ~Renderer(void) = default;
+        /// Destructor, cancels the background render
+        ~Renderer(void);
 
         /// Get buffer (read only)
         static const Buffer& getBuffer(void);
 
+        /// Get the cost of each pixel of the last render (read only)
+        static const CostBuffer& getCostBuffer(void);
+
+        /// Get the normal, albedo, depth and object of each pixel of the last render (read only, empty if they were not recorded)
+        static const AOVBuffer& getAOVBuffer(void);
+
         /// Copy a pointer to the scene to render
         static void setScene(std::shared_ptr<Scene> scene, unsigned int width, unsigned int height);
 
-        /// Render the specified scene
+        /// Render the specified scene (only the pixels of the crop window if there is one)
         static void render(void);
 
+        /// Only render the pixels of a tile of the image, the other pixels of the buffer are not modified (throws a runtime error if the tile
+        /// is not inside the image)
+        static void renderTile(const Tile& tile);
+
+        /// Render the scene in a background thread, first in coarse passes (each traced pixel fills a square of pixels) then at full quality
+        /// with the current settings. A render already in progress in the background is cancelled.
+        static void renderProgressive(void);
+
+        /// Stop the render in progress in the background (if any) and wait for its threads to end
+        static void cancelRender(void);
+
+        /// Check if a render is in progress in the background
+        static bool isRendering(void);
+
+        /// Get the camera the scene is rendered from (read/write), the render in progress must be cancelled before changing it
+        static Camera& camera(void);
+
         /// Check if the super sampling has been activated
         static bool isSuperSamplingActive(void);
 
@@ -56,9 +93,91 @@ namespace LCNS
         /// Activate or not multi threaded rendering
         static void setMultiThreading(bool activate);
 
-        /// Display the time it took to render the image
+        /// Display the time it took to render the image (and the statistics of the render if they are enabled)
         static void displayRenderTime(bool activate);
 
+        /// Get the counters of the rays and intersection tests of the last render (all 0 if the statistics are disabled at compile time)
+        static Statistics statistics(void);
+
+        /// Get the number of threads used by multi threaded rendering (0 for one thread per processor)
+        static unsigned int threadCount(void);
+
+        /// Set the number of threads used by multi threaded rendering (0 for one thread per processor)
+        static void setThreadCount(unsigned int count);
+
+        /// Check if the wavefront rendering pipeline is used
+        static bool isWavefrontActive(void);
+
+        /// Use the wavefront rendering pipeline (rays processed stage by stage in large streams) instead of rendering each pixel depth first
+        static void setWavefront(bool activate);
+
+        /// Check if the secondary rays are sorted before being traced (wavefront rendering only)
+        static bool isRaySortingActive(void);
+
+        /// Sort or not the secondary rays by origin and direction before tracing them, to trace similar rays one after the other (wavefront
+        /// rendering only)
+        static void setRaySorting(bool activate);
+
+        /// Get the bound under which a light is not traced
+        static double lightThreshold(void);
+
+        /// Do not trace the lights whose contribution to a point is known to be lower than a threshold (0 to trace all the lights)
+        static void setLightThreshold(double threshold);
+
+        /// Get the average number of lights traced at each point
+        static unsigned int lightSampleCount(void);
+
+        /// Only trace a random subset of the lights at each point, with this many lights on average (0 to trace all the lights)
+        static void setLightSampleCount(unsigned int count);
+
+        /// Get the contribution under which the reflections of a ray stop
+        static double reflectionThreshold(void);
+
+        /// Stop the reflections of a ray when the next ones are expected to change the pixel by less than a threshold, a fraction of the pixel
+        /// range (0 to trace the reflections up to the maximum count of the shaders). The expectation is a heuristic, see ReflectionChain
+        static void setReflectionThreshold(double threshold);
+
+        /// Check if the Russian roulette decides whether the reflections under the threshold are traced
+        static bool isRussianRouletteActive(void);
+
+        /// Under the reflection threshold, go on with the reflections of a ray with a probability proportional to their expected contribution
+        /// instead of stopping them (unbiased but noisy). It needs a reflection threshold, without one the reflections never stop early.
+        static void setRussianRoulette(bool activate);
+
+        /// Write the pixels rendered so far in a checkpoint file during the renders, every period (in seconds) and when a render ends or is
+        /// cancelled. With resume, the next render starts from the pixels of the file (if it exists) and only renders the other ones. The
+        /// description of the frame must change with the scene and the options changing the pixels, a render is only resumed from the
+        /// checkpoint of the same frame. An empty path disables the checkpoints.
+        static void setCheckpoint(const std::string& path, const std::string& frame, double period, bool resume);
+
+        /// Get the crop window of the renders (an empty tile if the whole image is rendered)
+        static const Tile& cropWindow(void);
+
+        /// Only render the pixels of a tile of the image (an empty tile to render the whole image), the other pixels of the buffer are not
+        /// modified. The rays of the camera are the same as in the render of the whole image. Throws a runtime error if the tile is not inside
+        /// the image of the scene.
+        static void setCropWindow(const Tile& window);
+
+        /// Get what the cost of a pixel measures
+        static CostBuffer::Metric costMetric(void);
+
+        /// Record the cost of each pixel during the render (NONE to record nothing), the pixels are rendered depth first to measure them
+        static void setCostMetric(CostBuffer::Metric metric);
+
+        /// Check if the AOVs of the pixels are recorded during the renders
+        static bool isAOVRecordingActive(void);
+
+        /// Record the AOVs of the first intersection of each pixel during the renders, they are always recorded when the frames are denoised
+        static void setAOVRecording(bool activate);
+
+        /// Get the number of iterations of the denoiser (0 if the frames are not denoised)
+        static unsigned int denoiseIterationCount(void);
+
+        /// Filter the frames with the Denoiser once they are rendered (only the pixels of the crop window), guided by the AOVs of the render.
+        /// Each iteration doubles the distance of the pixels averaged, 0 disables the denoiser and more than Denoiser::maxIterationCount throws.
+        /// The tiles of a distributed render are not denoised, the filter needs the neighbours of their pixels.
+        static void setDenoising(unsigned int iterationCount);
+
     private:
         /// Private member used in ThreadData to illustrate the current state of a thread
         enum class RunState
@@ -91,6 +210,22 @@ namespace LCNS
         /// Render the specified scene
         void _render(void);
 
+        /// Render the pixels of a tile of the image
+        void _render(const Tile& tile);
+
+        /// Internal method to start the progressive render in a background thread
+        void _renderProgressive(void);
+
+        /// Render the coarse passes then the full quality image, run by the background thread
+        void _renderPasses(void);
+
+        /// Internal method to stop the render in progress in the background
+        void _cancelRender(void);
+
+        /// Get the final color of a primary ray (reflections, refractions and tone mapping included), its first intersection is added to the
+        /// AOVs of the pixel if they are recorded
+        Color _primaryRayColor(Ray& ray, const Color& meanLight, std::optional<std::tuple<unsigned int, unsigned int>> aovPixel = std::nullopt);
+
         // Internal method to facilitate multi threading rendering
         void _renderWithApertureInternal(ThreadData* allIndices, unsigned int index, const Color& meanLight);
 
@@ -100,6 +235,12 @@ namespace LCNS
         // Internal method to facilitate multi threading rendering
         void _renderNoApertureInternal(ThreadData* allIndices, unsigned int index, const Color& meanLight);
 
+        // Internal method to facilitate multi threading rendering
+        void _renderWavefrontInternal(ThreadData* allIndices, unsigned int index, const Color& meanLight);
+
+        // Internal method to facilitate multi threading rendering, one pixel out of _previewStride in each direction is traced
+        void _renderPreviewInternal(ThreadData* allIndices, unsigned int index, const Color& meanLight);
+
         /// Internal method to check if the super sampling has been activated
         bool _isSuperSamplingActive(void) const;
 
@@ -112,79 +253,221 @@ namespace LCNS
         /// Internal method to activate or not multi threaded rendering
         void _setMultiThreading(bool activate);
 
+        /// Internal method to get the number of threads used by multi threaded rendering
+        unsigned int _threadCount(void) const;
+
+        /// Internal method to set the number of threads used by multi threaded rendering
+        void _setThreadCount(unsigned int count);
+
+        /// Internal method to check if the wavefront rendering pipeline is used
+        bool _isWavefrontActive(void) const;
+
+        /// Internal method to use the wavefront rendering pipeline or not
+        void _setWavefront(bool activate);
+
+        /// Internal method to check if the secondary rays are sorted
+        bool _isRaySortingActive(void) const;
+
+        /// Internal method to sort or not the secondary rays
+        void _setRaySorting(bool activate);
+
+        /// Internal method to get the bound under which a light is not traced
+        double _lightThreshold(void) const;
+
+        /// Internal method to set the bound under which a light is not traced
+        void _setLightThreshold(double threshold);
+
+        /// Internal method to get the average number of lights traced at each point
+        unsigned int _lightSampleCount(void) const;
+
+        /// Internal method to set the average number of lights traced at each point
+        void _setLightSampleCount(unsigned int count);
+
+        /// Internal method to set the contribution under which the reflections of a ray stop
+        void _setReflectionThreshold(double threshold);
+
+        /// Internal method to check if the Russian roulette is used for the reflections
+        bool _isRussianRouletteActive(void) const;
+
+        /// Internal method to use the Russian roulette for the reflections or not
+        void _setRussianRoulette(bool activate);
+
+        /// Internal method to set the checkpoint file of the renders
+        void _setCheckpoint(const std::string& path, const std::string& frame, double period, bool resume);
+
+        /// Check if the pixels rendered so far should be written in the checkpoint file
+        bool _isCheckpointDue(void) const;
+
+        /// Add the pixels of the tile rendered since the last checkpoint (the pixels are numbered row by row) and write the checkpoint file
+        void _writeCheckpoint(unsigned int renderedCount);
+
+        /// Internal method to set the crop window of the renders
+        void _setCropWindow(const Tile& window);
+
+        /// Get the pixels rendered by the renders, the crop window or the whole image
+        Tile _renderWindow(void) const;
+
+        /// Internal method to get what the cost of a pixel measures
+        CostBuffer::Metric _costMetric(void) const;
+
+        /// Internal method to set what the cost of a pixel measures
+        void _setCostMetric(CostBuffer::Metric metric);
+
+        /// Internal method to check if the AOVs of the pixels are recorded
+        bool _isAOVRecordingActive(void) const;
+
+        /// Internal method to record the AOVs of the pixels or not
+        void _setAOVRecording(bool activate);
+
+        /// Internal method to get the number of iterations of the denoiser
+        unsigned int _denoiseIterationCount(void) const;
+
+        /// Internal method to set the number of iterations of the denoiser
+        void _setDenoising(unsigned int iterationCount);
+
+        /// Filter the pixels of a window of the buffer with the denoiser
+        void _denoise(const Tile& window);
+
         /// Display a progress bar with ascii characters
         void _displayProgressBar(double currentProgress);
 
         /// Internal method to activate/deactivate the render time being displayed
         void _displayRenderTime(bool activate);
 
-        /// Internal helper method to manage multiple threads and their data batches
+        /// Internal method to display the statistics of the last render
+        void _displayStatistics(void) const;
+
+        /// Trace the rendering of the batch of pixels of a thread, the event ends with the returned scope
+        static TraceScope _traceBatch(const ThreadData& batch);
+
+        /// Internal helper method to manage multiple threads and their data batches, the pixels before the first index are not rendered
         template <typename T>
-        void _threadHandler(
-        T renderingMethod, unsigned int allPixelsCount, unsigned int processorCount, double reductionCoeff, const Color& meanLight);
+        void _threadHandler(T            renderingMethod,
+                            unsigned int firstIndex,
+                            unsigned int allPixelsCount,
+                            unsigned int processorCount,
+                            double       reductionCoeff,
+                            const Color& meanLight);
+
+        /// Get the number of pixels rendered before the first pixel of the batches in progress (all of them if the render is finished).
+        /// When the render is cancelled, the batches of the threads that stopped are not finished.
+        unsigned int _renderedCount(const std::vector<ThreadData>& allRanges, unsigned int range, unsigned int allPixelsCount) const;
 
         /// Helper method to get the 2D position in a buffer from 1D array
         std::tuple<unsigned int, unsigned int> _2DFrom1D(unsigned int position, unsigned int width) const;
 
+        /// Helper method to get the 2D position in the buffer of a pixel of the tile being rendered (its pixels are numbered row by row)
+        std::tuple<unsigned int, unsigned int> _pixelPosition(unsigned int index) const;
+
     private:
         std::shared_ptr<Scene> _scene;
         Buffer                 _buffer;
+        CostBuffer             _costBuffer;
+        AOVBuffer              _aovBuffer;
         bool                   _superSampling           = false;
         bool                   _multiThreaded           = false;
         bool                   _shouldDisplayRenderTime = false;
+        unsigned int           _renderThreadCount       = 0u;
+        Statistics             _statistics;
+        bool                   _wavefront               = false;
+        bool                   _raySorting              = false;
+        double                 _lightCullingThreshold   = 0.0;
+        unsigned int           _lightSamplingCount      = 0u;
+        double                 _reflectionThreshold     = 0.0;
+        bool                   _russianRoulette         = false;
+        bool                   _aovRecording            = false;
+        unsigned int           _denoiseIterations       = 0u;
+        std::thread            _backgroundThread;
+        std::atomic<bool>      _backgroundRendering     = false;
+        std::atomic<bool>      _cancelRequested         = false;
+        unsigned int           _previewStride           = 1u;
+        Tile                   _tile;
+        Tile                   _cropWindow;
+        std::string            _checkpointFile;
+        std::string            _checkpointFrame;
+        double                 _checkpointPeriod        = 60.0;
+        bool                   _resumeCheckpoint        = false;
+
+        // Checkpoint of the render in progress, with the number of pixels of the tile it holds and the time it was last written, and the
+        // number of pixels of the last render restored from a checkpoint (they have no AOVs)
+        std::unique_ptr<Checkpoint>           _checkpoint;
+        unsigned int                          _checkpointedCount = 0u;
+        unsigned int                          _restoredCount     = 0u;
+        std::chrono::steady_clock::time_point _lastCheckpoint;
 
     };  // class Renderer
 
     template <typename T>
-    void Renderer::_threadHandler(
-    T renderingMethod, unsigned int allPixelsCount, unsigned int processorCount, double reductionCoeff, const Color& meanLight)
+    void Renderer::_threadHandler(T            renderingMethod,
+                                  unsigned int firstIndex,
+                                  unsigned int allPixelsCount,
+                                  unsigned int processorCount,
+                                  double       reductionCoeff,
+                                  const Color& meanLight)
     {
-        const auto batchSize
-        = static_cast<unsigned int>(ceil(static_cast<double>(allPixelsCount) / static_cast<double>(processorCount)) / reductionCoeff);
+        const auto batchSize = std::max(
+        1u, static_cast<unsigned int>(ceil(static_cast<double>(allPixelsCount) / static_cast<double>(processorCount)) / reductionCoeff));
 
         std::vector<std::thread> allThreads;
         allThreads.reserve(processorCount);
 
-        ThreadData* allRanges = new ThreadData[processorCount];
+        std::vector<ThreadData> allRanges(processorCount);
 
-        // Create threads
-        unsigned int range = 0;
+        // Create threads, a thread without any pixel to render has nothing to do
+        unsigned int range = std::min(firstIndex, allPixelsCount);
         for (unsigned int i = 0; i < processorCount; ++i)
         {
             allRanges[i].startIndex = range;
-            allRanges[i].endIndex   = range + batchSize;
-            allRanges[i].runState   = RunState::running;
+            allRanges[i].endIndex   = std::min(range + batchSize, allPixelsCount);
+            allRanges[i].runState   = (range < allPixelsCount) ? RunState::running : RunState::done;
 
-            allThreads.push_back(std::thread(renderingMethod, this, allRanges, i, meanLight));
-            range += batchSize;
+            allThreads.push_back(std::thread(renderingMethod, this, allRanges.data(), i, meanLight));
+            range = std::min(range + batchSize, allPixelsCount);
         }
 
+        // A cancelled render does not give any new batch to the threads, they stop after their current pixel
         unsigned int j = 0u;
-        while (range < allPixelsCount)
+        while (range < allPixelsCount && !_cancelRequested)
         {
             if (allRanges[j].runState == RunState::done)
             {
                 allRanges[j].startIndex = range;
-                allRanges[j].endIndex   = range + batchSize;
+                allRanges[j].endIndex   = std::min(range + batchSize, allPixelsCount);
                 allRanges[j].runState   = RunState::running;
-                range += batchSize;
+                range                   = allRanges[j].endIndex;
 
-                if (range > allPixelsCount)
-                {
-                    range = allPixelsCount;
-                }
                 // std::cout << "new data for process " << j << std::endl;
                 _displayProgressBar(static_cast<double>(range) / static_cast<double>(allPixelsCount));
             }
 
+            if (_isCheckpointDue())
+                _writeCheckpoint(_renderedCount(allRanges, range, allPixelsCount));
+
             ++j;
 
             if (j >= processorCount)
             {
                 j = 0;
+                std::this_thread::yield();
             }
         }
 
+        // Wait for the last batches to be rendered before stopping the threads
+        for (unsigned int i = 0; i < processorCount; ++i)
+        {
+            while (allRanges[i].runState != RunState::done)
+            {
+                if (_isCheckpointDue())
+                    _writeCheckpoint(_renderedCount(allRanges, range, allPixelsCount));
+
+                std::this_thread::yield();
+            }
+        }
+
+        // The last checkpoint has all the pixels rendered (before the batches that were stopped if the render was cancelled)
+        if (_checkpoint)
+            _writeCheckpoint(_renderedCount(allRanges, range, allPixelsCount));
+
         for (unsigned int i = 0; i < processorCount; ++i)
         {
             allRanges[i].runState = RunState::sleeping;
@@ -197,8 +480,6 @@ namespace LCNS
                 t.join();
             }
         }
-
-        delete[] allRanges;
     }
 
 }  // namespace LCNS
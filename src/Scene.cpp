@@ -10,13 +10,10 @@
 
 #include "Scene.hpp"
 
-#include <iostream>
-#include <fstream>
 #include <limits>
 #include <memory>
 #include <stdexcept>
 #include <string>
-#include <sstream>
 #include <cassert>
 #include <vector>
 #include <algorithm>
@@ -30,64 +27,113 @@
 #include "Triangle.hpp"
 #include "Light.hpp"
 #include "Mesh.hpp"
+#include "OBJFile.hpp"
 #include "Light.hpp"
+#include "Sphere.hpp"
 #include "CubeMap.hpp"
+#include "Statistics.hpp"
+#include "Trace.hpp"
 
-using std::cerr;
-using std::cout;
 using std::end;
-using std::endl;
 using std::find_if;
-using std::ifstream;
 using std::iterator;
 using std::list;
-using std::make_shared;
+using std::max;
 using std::numeric_limits;
 using std::pair;
 using std::runtime_error;
 using std::shared_ptr;
-using std::static_pointer_cast;
-using std::stoi;
 using std::string;
-using std::stringstream;
 using std::unique_ptr;
 using std::vector;
 
+using LCNS::Animation;
 using LCNS::BRDF;
+using LCNS::BVH;
 using LCNS::Camera;
 using LCNS::Color;
 using LCNS::CubeMap;
 using LCNS::Light;
+using LCNS::LightTree;
 using LCNS::Mesh;
+using LCNS::OBJFile;
 using LCNS::Ray;
+using LCNS::Real;
 using LCNS::Renderable;
 using LCNS::Scene;
 using LCNS::Shader;
+using LCNS::Sphere;
+using LCNS::Statistics;
+using LCNS::TraceScope;
+using LCNS::Transform;
 using LCNS::Triangle;
 
+namespace
+{
+    /// Intersect a ray with all the objects of an array and keep the closest hit, the object the ray comes from is skipped
+    void intersectAll(const vector<Renderable*>& objects, Ray& ray, const Renderable* objectFromRay, BVH::Hit& hit)
+    {
+        for (auto object : objects)
+        {
+            const bool hasIntersection = object->intersect(ray);
+            if (hasIntersection && ray.length() < hit.distance && objectFromRay != ray.intersected())
+            {
+                hit.distance = ray.length();
+                hit.object   = ray.intersected();
+            }
+        }
+    }
+
+}  // namespace
+
 list<unique_ptr<Camera>>& Scene::cameraList(void)
 {
     return _cameraList;
 }
 
-list<shared_ptr<Light>>& Scene::lightList(void)
+const list<shared_ptr<Light>>& Scene::lightList(void) const
 {
     return _lightList;
 }
 
-list<shared_ptr<Renderable>>& Scene::renderableList(void)
+LightTree& Scene::lightTree(void) noexcept
+{
+    return _lightTree;
+}
+
+const LightTree& Scene::lightTree(void) const noexcept
+{
+    return _lightTree;
+}
+
+void Scene::buildLightTree(void)
+{
+    TraceScope traceScope("LightTree::build", "acceleration", "lights", _lightList.size());
+    _lightTree.build(_lightList);
+}
+
+const vector<Light*>& Scene::lights(void) const noexcept
+{
+    return _lights;
+}
+
+const list<shared_ptr<Renderable>>& Scene::renderableList(void) const
 {
     return _renderableList;
 }
 
 void Scene::setBackgroundColor(const Color& color)
 {
+    _checkEditable();
+
     _backgroundType  = BackgroundType::COLOR;
     _backgroundColor = color;
 }
 
 void Scene::backgroundCubeMap(shared_ptr<CubeMap> cubeMap)
 {
+    _checkEditable();
+
     _backgroundType    = BackgroundType::CUBEMAP;
     _backgroundCubeMap = cubeMap;
 }
@@ -116,6 +162,8 @@ shared_ptr<Renderable> Scene::objectNamed(const string& name)
 
 void Scene::add(unique_ptr<Camera>&& camera)
 {
+    _checkEditable();
+
     if (!camera.get())
     {
         throw runtime_error("Non initialised camera pointer added to scene");
@@ -126,6 +174,8 @@ void Scene::add(unique_ptr<Camera>&& camera)
 
 void Scene::add(shared_ptr<Light> light)
 {
+    _checkEditable();
+
     if (!light.get())
     {
         throw runtime_error("Non initialised light pointer added to scene");
@@ -136,6 +186,8 @@ void Scene::add(shared_ptr<Light> light)
 
 void Scene::add(shared_ptr<Renderable> renderable)
 {
+    _checkEditable();
+
     if (!renderable.get())
     {
         throw runtime_error("Non initialised object pointer added to scene");
@@ -146,6 +198,8 @@ void Scene::add(shared_ptr<Renderable> renderable)
 
 void Scene::add(shared_ptr<Shader> shader, const string& name)
 {
+    _checkEditable();
+
     if (!shader.get())
     {
         throw runtime_error("Non initialised shader pointer added to scene");
@@ -165,6 +219,8 @@ void Scene::add(shared_ptr<Shader> shader, const string& name)
 
 void Scene::add(shared_ptr<BRDF> bRDF, const string& name)
 {
+    _checkEditable();
+
     if (!bRDF.get())
     {
         throw runtime_error("Non initialised BRDF pointer added to scene");
@@ -184,6 +240,8 @@ void Scene::add(shared_ptr<BRDF> bRDF, const string& name)
 
 void Scene::add(shared_ptr<CubeMap> cubeMap)
 {
+    _checkEditable();
+
     if (!cubeMap.get())
     {
         throw runtime_error("Non initialised cubeMap pointer added to scene");
@@ -192,280 +250,215 @@ void Scene::add(shared_ptr<CubeMap> cubeMap)
     _cubeMapList.push_back(cubeMap);
 }
 
-bool Scene::intersect(Ray& ray) const
+void Scene::animate(shared_ptr<Renderable> renderable, const Animation& animation)
 {
-    double      closestDist    = numeric_limits<double>::max();
-    Renderable* rClosestObject = nullptr;
-    Renderable* objectFromRay  = ray.intersected();
+    _checkEditable();
 
-    int i = 0;
-
-    if (!(_renderableList.empty()))
+    if (!renderable.get())
     {
-        for (auto renderable : _renderableList)
-        {
-            const bool hasIntersection = renderable->intersect(ray);
-            if (hasIntersection && ray.length() < closestDist && objectFromRay != ray.intersected())
-            {
-                closestDist    = ray.length();
-                rClosestObject = ray.intersected();
-                i++;
-            }
-        }
+        throw runtime_error("Non initialised renderable pointer animated in scene");
     }
 
-    if (i > 0)
-    {
-        ray.length(closestDist);
-        ray.intersected(rClosestObject);
-        return true;
-    }
-    else
-    {
-        ray.length(numeric_limits<float>::max());
-        ray.intersected(nullptr);
-        return false;
-    }
+    _animatedRenderables.push_back({ renderable, animation, Transform() });
 }
 
-void Scene::createFromFile(const string& objFilePath)
+void Scene::animate(shared_ptr<Light> light, const Animation& animation)
 {
-    // Count the different parameters (vertices, normals, faces, ...) in the file
-    OBJParameters parameters;
-    _countVerticesAndFaces(objFilePath, parameters);
+    _checkEditable();
 
-    // Create containers for the vertices and normals
-    vector<Point> vertices;
-    vertices.reserve(parameters.vertexCount);
+    if (!light.get())
+    {
+        throw runtime_error("Non initialised light pointer animated in scene");
+    }
 
-    vector<Vector> normals;
-    if (parameters.normalCount > 0)
-        normals.reserve(parameters.normalCount);
+    _animatedLights.push_back({ light, animation, Transform() });
+}
 
-    // Create a mesh containing all the triangle of a group
-    shared_ptr<Renderable> currentObject;
+void Scene::time(double time)
+{
+    TraceScope traceScope("Scene::time", "scene", "objects", _animatedRenderables.size(), "lights", _animatedLights.size());
 
-    Point minPoint(1000000.0, 1000000.0, 1000000.0);
-    Point maxPoint(-1000000.0, -1000000.0, -1000000.0);
+    _time = time;
 
-    Point  tmpPoint(0.0, 0.0, 0.0);
-    Vector tmpNormal(0.0, 0.0, 0.0);
+    for (auto& animated : _animatedRenderables)
+        _moveTo(animated, time);
 
-    // Create the triangles
-    ifstream objFile(objFilePath.c_str(), ifstream::in);
+    for (auto& animated : _animatedLights)
+        _moveTo(animated, time);
 
-    if (objFile)
-    {
-        string       line;
-        unsigned int currentObjectIdx = 0;
-        bool         lineNotProcessed = true;
-        bool         firstGDefault    = true;
+    if (!_committed)
+        return;
 
-        while (getline(objFile, line))
+    // Most of the geometry usually does not move, the hierarchy keeps its tree and only its bounding boxes are updated. The tree is built
+    // again when the moved objects make the boxes overlap too much.
+    if (!_animatedRenderables.empty())
+    {
         {
-            stringstream stringStream(line);
-            string       word;
-            lineNotProcessed = true;
-
-
-            switch (line[0])
-            {
-                case 'g':
-                    if (line == "g default")
-                    {
-                        if (firstGDefault)
-                            firstGDefault = false;
-                        else
-                        {
-                            static_pointer_cast<Mesh>(currentObject)->boundingBoxLimits(minPoint, maxPoint);
-                            currentObject = nullptr;
-                            minPoint.set(1000000.0, 1000000.0, 1000000.0);
-                            maxPoint.set(-1000000.0, -1000000.0, -1000000.0);
-                            currentObjectIdx++;
-                        }
-                    }
-                    else
-                    {
-                        currentObject = make_shared<Mesh>(parameters.faceCount.at(currentObjectIdx));
-
-                        // Read the "g"
-                        stringStream >> word;
-
-                        // Read the name of the object
-                        stringStream >> word;
-
-                        currentObject->name(word);
-
-                        _renderableList.push_back(currentObject);
-                    }
-                    break;
-
-
-                case 'v':
-                    if (line[1] == ' ')
-                    {
-                        while (stringStream.good() && lineNotProcessed)
-                        {
-                            double tmpDoubleValue = 0.0;
-
-                            // Read the "v"
-                            stringStream >> word;
-
-                            // Read the x coordinate of the vertex
-                            stringStream >> tmpDoubleValue;
-                            tmpPoint.x(tmpDoubleValue);
-
-                            stringStream >> tmpDoubleValue;
-                            tmpPoint.y(tmpDoubleValue);
-
-                            stringStream >> tmpDoubleValue;
-                            tmpPoint.z(tmpDoubleValue);
-
-                            vertices.push_back(tmpPoint);
-
-                            lineNotProcessed = false;
-                        }
-                    }
-                    else if (line[1] == 'n')
-                    {
-                        while (stringStream.good() && lineNotProcessed)
-                        {
-                            double tmpDoubleValue = 0.0;
-
-                            // Read the "vn"
-                            stringStream >> word;
+            TraceScope refitTraceScope("BVH::refit", "acceleration", "objects", _bvh.objectCount());
+            _bvh.refit();
+        }
 
-                            // Read the x coordinate of the vertex
-                            stringStream >> tmpDoubleValue;
-                            tmpNormal.setX(tmpDoubleValue);
+        if (_bvh.cost() > _bvh.buildCost() * _bvhRebuildRatio)
+        {
+            TraceScope bvhTraceScope("BVH::build", "acceleration", "objects", _bvh.objectCount());
+            _bvh.rebuild();
+        }
+    }
 
-                            stringStream >> tmpDoubleValue;
-                            tmpNormal.setY(tmpDoubleValue);
+    if (!_animatedLights.empty())
+        buildLightTree();
+}
 
-                            stringStream >> tmpDoubleValue;
-                            tmpNormal.setZ(tmpDoubleValue);
+double Scene::time(void) const noexcept
+{
+    return _time;
+}
 
-                            normals.push_back(tmpNormal);
+double Scene::animationEndTime(void) const noexcept
+{
+    double endTime = 0.0;
 
-                            lineNotProcessed = false;
-                        }
-                    }
-                    break;
+    for (const auto& animated : _animatedRenderables)
+        endTime = max(endTime, animated.animation.endTime());
 
-                case 'f':
-                    if (parameters.textureCount == 0 && parameters.normalCount == 0)
-                    {
-                        while (stringStream.good() && lineNotProcessed)
-                        {
-                            shared_ptr<Renderable> triangle = make_shared<Triangle>();
+    for (const auto& animated : _animatedLights)
+        endTime = max(endTime, animated.animation.endTime());
 
-                            unsigned int vertexIdx = 0;
+    return endTime;
+}
 
-                            // Read the "f"
-                            stringStream >> word;
+void Scene::commit(void)
+{
+    if (_committed)
+        return;
 
-                            // Read the first vertex index
-                            stringStream >> vertexIdx;
-                            static_pointer_cast<Triangle>(triangle)->vertexPositions()[0] = vertices[vertexIdx - 1];
+    TraceScope traceScope("Scene::commit", "scene", "objects", _renderableList.size(), "lights", _lightList.size());
 
-                            // Read the second vertex index
-                            stringStream >> vertexIdx;
-                            static_pointer_cast<Triangle>(triangle)->vertexPositions()[1] = vertices[vertexIdx - 1];
+    // The concrete type of the objects is looked up once here instead of calling their virtual functions for each ray
+    vector<Sphere*>   spheres;
+    vector<Triangle*> triangles;
+    vector<Mesh*>     meshes;
 
-                            // Read the third vertex index
-                            stringStream >> vertexIdx;
-                            static_pointer_cast<Triangle>(triangle)->vertexPositions()[2] = vertices[vertexIdx - 1];
+    _otherRenderables.clear();
+    for (const auto& renderable : _renderableList)
+    {
+        if (auto sphere = dynamic_cast<Sphere*>(renderable.get()))
+            spheres.push_back(sphere);
+        else if (auto triangle = dynamic_cast<Triangle*>(renderable.get()))
+            triangles.push_back(triangle);
+        else if (auto mesh = dynamic_cast<Mesh*>(renderable.get()))
+            meshes.push_back(mesh);
+        else
+            _otherRenderables.push_back(renderable.get());
+    }
 
-                            // Calculate the normal
-                            if (parameters.normalCount > 0)
-                                static_pointer_cast<Triangle>(triangle)->normal(normals[vertexIdx - 1]);
-                            else
-                                static_pointer_cast<Triangle>(triangle)->updateNormal();
+    {
+        TraceScope bvhTraceScope("BVH::build", "acceleration", "objects", spheres.size() + triangles.size() + meshes.size());
+        _bvh.build(spheres, triangles, meshes);
+    }
 
-                            _renderableList.push_back(triangle);
+    _lights.clear();
+    for (const auto& light : _lightList)
+        _lights.push_back(light.get());
 
-                            lineNotProcessed = false;
-                        }
-                    }
-                    else
-                    {
-                        while (stringStream.good() && lineNotProcessed)
-                        {
-                            Triangle triangle;
+    buildLightTree();
 
-                            // Read the "f"
-                            stringStream >> word;
+    // The images still loading are only waited for once the hierarchies are built (the .obj files are needed to create the scene)
+    for (const auto& cubeMap : _cubeMapList)
+        cubeMap->waitForImages();
 
-                            Vector localNormals[3] = { Vector(0.0, 0.0, 0.0), Vector(0.0, 0.0, 0.0), Vector(0.0, 0.0, 0.0) };
+    for ([[maybe_unused]] const auto& [name, bRDF] : _bRDFMap)
+    {
+        if (bRDF->cubeMap())
+            bRDF->cubeMap()->waitForImages();
+    }
 
-                            for (unsigned int i = 0; i < 3; ++i)
-                            {
-                                // Read the first combination of vertex/texture/normal indices
-                                stringStream >> word;
+    if (_backgroundCubeMap)
+        _backgroundCubeMap->waitForImages();
 
-                                char* str = new char[word.size() + 1];
-                                strcpy(str, word.c_str());
+    _committed = true;
+}
 
-                                char*      subStr    = strtok(str, "/");
-                                const auto vertexIdx = static_cast<unsigned int>(stoi(subStr));
+void Scene::reopen(void)
+{
+    _committed = false;
 
-                                subStr                = strtok(NULL, "/");
-                                const auto textureIdx = static_cast<unsigned int>(stoi(subStr));
+    _bvh.clear();
+    _otherRenderables.clear();
+    _lights.clear();
+}
 
-                                subStr               = strtok(NULL, "/");
-                                const auto normalIdx = static_cast<unsigned int>(stoi(subStr));
+bool Scene::isCommitted(void) const noexcept
+{
+    return _committed;
+}
 
-                                delete[] str;
+bool Scene::intersect(Ray& ray) const
+{
+    assert(_committed && "The scene must be committed before intersecting rays with it");
 
-                                triangle.vertexPositions()[i] = vertices[vertexIdx - 1];
+    Statistics::count(Statistics::Counter::SCENE_RAYS);
 
-                                // Update bounding box
-                                if (vertices[vertexIdx - 1].x() < minPoint.x())
-                                    minPoint.x(vertices[vertexIdx - 1].x());
+    const Renderable* objectFromRay = ray.intersected();
+    BVH::Hit          hit;
 
-                                if (vertices[vertexIdx - 1].y() < minPoint.y())
-                                    minPoint.y(vertices[vertexIdx - 1].y());
+    _bvh.intersect(ray, objectFromRay, hit);
+    intersectAll(_otherRenderables, ray, objectFromRay, hit);
 
-                                if (vertices[vertexIdx - 1].z() < minPoint.z())
-                                    minPoint.z(vertices[vertexIdx - 1].z());
+    if (hit.object != nullptr)
+    {
+        Statistics::count(Statistics::Counter::HITS);
 
-                                if (vertices[vertexIdx - 1].x() > maxPoint.x())
-                                    maxPoint.x(vertices[vertexIdx - 1].x());
+        ray.length(hit.distance);
+        ray.intersected(hit.object);
+        return true;
+    }
+    else
+    {
+        ray.length(numeric_limits<float>::max());
+        ray.intersected(nullptr);
+        return false;
+    }
+}
 
-                                if (vertices[vertexIdx - 1].y() > maxPoint.y())
-                                    maxPoint.y(vertices[vertexIdx - 1].y());
+void Scene::createFromFile(const string& objFilePath)
+{
+    createFromFile(OBJFile(objFilePath));
+}
 
-                                if (vertices[vertexIdx - 1].z() > maxPoint.z())
-                                    maxPoint.z(vertices[vertexIdx - 1].z());
+vector<shared_ptr<Renderable>> Scene::createFromFile(const OBJFile& objFile)
+{
+    _checkEditable();
 
-                                triangle.vertexNormals()[i] = normals[normalIdx - 1];
-                                localNormals[i]             = normals[normalIdx - 1];
-                            }
+    TraceScope traceScope("Scene::createFromFile", "scene");
 
-                            // Calculate the normal
-                            triangle.updateNormal();
+    vector<shared_ptr<Renderable>> objects;
+    objects.reserve(objFile.objects().size());
 
-                            static_pointer_cast<Mesh>(currentObject)->addTriangle(triangle);
+    for (const auto& object : objFile.objects())
+    {
+        // A mesh contains all the triangles of a group of the file
+        if (object.isMesh)
+        {
+            auto mesh = create<Mesh>(static_cast<unsigned int>(object.triangles.size()));
+            mesh->name(object.name);
 
-                            lineNotProcessed = false;
-                        }
-                    }
-                    break;
+            for (const auto& triangle : object.triangles)
+                mesh->addTriangle(triangle);
 
-                default:
-                    break;
-            }
+            mesh->boundingBoxLimits(object.minPoint, object.maxPoint);
+            objects.push_back(mesh);
+        }
+        else
+        {
+            for (const auto& triangle : object.triangles)
+                objects.push_back(create<Triangle>(triangle));
         }
 
-        // Set the bouning box of the last object
-        static_pointer_cast<Mesh>(currentObject)->boundingBoxLimits(minPoint, maxPoint);
-
-        objFile.close();
-    }
-    else
-    {
-        cerr << "ERROR: Impossible to open file" << endl;
+        add(objects.back());
     }
+
+    return objects;
 }
 
 Color Scene::meanAmbiantLight(void) const
@@ -482,58 +475,10 @@ Color Scene::meanAmbiantLight(void) const
     return meanLight;
 }
 
-void Scene::_countVerticesAndFaces(const string& objFilePath, OBJParameters& parameters) const
+void Scene::_checkEditable(void) const
 {
-    // Open file
-    ifstream objFile(objFilePath.c_str(), ifstream::in);
-
-    if (objFile)
-    {
-        string line;
-
-        // Read all the lines
-        while (getline(objFile, line))
-        {
-            // Check the first character
-            switch (line[0])
-            {
-                // If it's a "v", increase the vertex count
-                case 'v':
-                    if (line[1] == ' ')
-                        ++parameters.vertexCount;
-                    else if (line[1] == 't')
-                        ++parameters.textureCount;
-                    else if (line[1] == 'n')
-                        ++parameters.normalCount;
-                    break;
-
-                // If it's a "f", increase the face count
-                case 'f':
-                    ++parameters.currentFaceCount;
-                    break;
-
-                case 'g':
-                    if (line == "g default" && parameters.currentFaceCount != 0)
-                    {
-                        parameters.faceCount.push_back(parameters.currentFaceCount);
-                        parameters.currentFaceCount = 0u;
-                    }
-                    break;
-
-                default:
-                    break;
-            }
-        }
-
-        // Save the number of faces of the last object
-        parameters.faceCount.push_back(parameters.currentFaceCount);
-        parameters.currentFaceCount = 0u;
-
-        // Close file
-        objFile.close();
-    }
-    else
+    if (_committed)
     {
-        cout << "ERROR: Impossible to open file" << endl;
+        throw runtime_error("The scene is committed, it must be reopened before being edited");
     }
 }
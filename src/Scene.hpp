@@ -14,11 +14,17 @@
 #include <map>
 #include <string>
 #include <memory>
+#include <utility>
+#include <vector>
 
+#include "Animation.hpp"
+#include "BVH.hpp"
 #include "Color.hpp"
-#include "OBJParameters.hpp"
 #include "Ray.hpp"
 #include "CubeMap.hpp"
+#include "LightTree.hpp"
+#include "SceneArena.hpp"
+#include "Transform.hpp"
 
 namespace LCNS
 {
@@ -28,7 +34,11 @@ namespace LCNS
     class Light;
     class Shader;
     class BRDF;
+    class OBJFile;
 
+    /// Objects, lights and cameras of a render. The scene is edited through its lists, then committed before being rendered: the commit
+    /// converts the lists into flat arrays of raw pointers and builds the hierarchies over the objects and the lights, which are what the
+    /// renderer uses. A committed scene rejects the edits until it is reopened.
     class Scene
     {
     private:
@@ -55,15 +65,32 @@ namespace LCNS
         /// Get the list of camera in the scene
         std::list<std::unique_ptr<Camera>>& cameraList(void);
 
-        /// Get the list of lights in the scene
-        std::list<std::shared_ptr<Light>>& lightList(void);
+        /// Get the list of lights in the scene, they are only added with add() so that a committed scene cannot be edited
+        const std::list<std::shared_ptr<Light>>& lightList(void) const;
 
-        /// Get the list of object in the scene
-        std::list<std::shared_ptr<Renderable>>& renderableList(void);
+        /// Get the hierarchy over the lights of the scene
+        LightTree& lightTree(void) noexcept;
+
+        /// Get the hierarchy over the lights of the scene (read only)
+        const LightTree& lightTree(void) const noexcept;
+
+        /// Build the hierarchy over the current list of lights, it is done by commit()
+        void buildLightTree(void);
+
+        /// Get the lights of a committed scene
+        const std::vector<Light*>& lights(void) const noexcept;
+
+        /// Get the list of object in the scene, they are only added with add() so that a committed scene cannot be edited
+        const std::list<std::shared_ptr<Renderable>>& renderableList(void) const;
 
         /// Get an object of the list of renderables with its name
         std::shared_ptr<Renderable> objectNamed(const std::string& name);
 
+        /// Create an object (renderable, light, shader, BRDF...) in the arena of the scene, next to the other objects of its type. An object
+        /// referenced after the scene is destroyed keeps the memory of the objects of its type alive until it is released.
+        template<typename T, typename... Arguments>
+        std::shared_ptr<T> create(Arguments&&... arguments);
+
         /// Add a pointer on a camera to the scene
         void add(std::unique_ptr<Camera>&& camera);
 
@@ -82,12 +109,41 @@ namespace LCNS
         /// Add a pointer on a CubeMap used as texture for an object
         void add(std::shared_ptr<CubeMap> cubeMap);
 
-        /// Check if a ray intersect one of the object of the scene
+        /// Animate an object of the scene, the transforms of the animation are relative to the current position of the object
+        void animate(std::shared_ptr<Renderable> renderable, const Animation& animation);
+
+        /// Animate a light of the scene, the transforms of the animation are relative to the current position of the light
+        void animate(std::shared_ptr<Light> light, const Animation& animation);
+
+        /// Move the animated objects and lights to where they are at a time (in seconds). If the scene is committed, the bounding volume
+        /// hierarchy is refitted around the objects, and built again if the refit made it too expensive to traverse.
+        void time(double time);
+
+        /// Get the time of the animations (in seconds)
+        double time(void) const noexcept;
+
+        /// Get the time of the last key of the animations (0 if nothing is animated)
+        double animationEndTime(void) const noexcept;
+
+        /// Convert the lists of the scene into the data used by the renderer (flat arrays and hierarchies) and wait for the images of its cube
+        /// maps still loading (see AssetLoader), nothing is done if the scene is already committed. Throws if an image cannot be read.
+        void commit(void);
+
+        /// Allow editing a committed scene again, it must be committed again before being rendered
+        void reopen(void);
+
+        /// Check if the scene is committed
+        bool isCommitted(void) const noexcept;
+
+        /// Check if a ray intersect one of the object of the scene, the scene must be committed
         bool intersect(Ray& ray) const;
 
         /// Create a scene from a .obj file
         void createFromFile(const std::string& objFilePath);
 
+        /// Create the objects of a .obj file already read in the scene and get them (in the order of the file)
+        std::vector<std::shared_ptr<Renderable>> createFromFile(const OBJFile& objFile);
+
         /// Set the color of the background in the scene
         void setBackgroundColor(const Color& color);
 
@@ -101,12 +157,35 @@ namespace LCNS
         Color meanAmbiantLight(void) const;
 
     private:
-        /// Utility function to count the number of vertices and faces in a .obj file
-        void _countVerticesAndFaces(const std::string& objFilePath, OBJParameters& parameters) const;
+        /// Throw an exception if the scene is committed
+        void _checkEditable(void) const;
 
     private:
+        /// Object or light moved by an animation, with the transform of the animation it has been moved by
+        template<typename T>
+        struct Animated
+        {
+            std::shared_ptr<T> object;
+            Animation          animation;
+            Transform          transform;
+        };
+
+        /// Move an animated object or light by the transform of its animation at a time
+        template<typename T>
+        static void _moveTo(Animated<T>& animated, double time);
+
+    private:
+        /// The hierarchy over the objects is built again when refitting it made its cost higher than its cost when it was built times this
+        /// ratio
+        static constexpr double _bvhRebuildRatio = 1.5;
+
+    private:
+        // The arena is destroyed after all the lists of shared pointers to the objects created in it
+        SceneArena _arena;
+
         std::list<std::unique_ptr<Camera>>             _cameraList;
         std::list<std::shared_ptr<Light>>              _lightList;
+        LightTree                                      _lightTree;
         std::list<std::shared_ptr<Renderable>>         _renderableList;
         std::list<std::shared_ptr<CubeMap>>            _cubeMapList;
         std::map<std::string, std::shared_ptr<Shader>> _shaderMap;
@@ -114,7 +193,32 @@ namespace LCNS
         std::shared_ptr<CubeMap>                       _backgroundCubeMap;
         BackgroundType                                 _backgroundType = BackgroundType::UNDEFINED;
         Color                                          _backgroundColor;
+        std::vector<Animated<Renderable>>              _animatedRenderables;
+        std::vector<Animated<Light>>                   _animatedLights;
+        double                                         _time = 0.0;
+
+        // Render time data, only valid while the scene is committed. The renderables that are not spheres, triangles or meshes have no
+        // bounding box, they are tested after the hierarchy.
+        bool                     _committed = false;
+        BVH                      _bvh;
+        std::vector<Renderable*> _otherRenderables;
+        std::vector<Light*>      _lights;
 
     };  // class Scene
 
+    template<typename T, typename... Arguments>
+    std::shared_ptr<T> Scene::create(Arguments&&... arguments)
+    {
+        return _arena.create<T>(std::forward<Arguments>(arguments)...);
+    }
+
+    template<typename T>
+    void Scene::_moveTo(Animated<T>& animated, double time)
+    {
+        // Only the difference with the transform the object has already been moved by is applied
+        const Transform transform = animated.animation.at(time);
+        animated.object->transform(transform * animated.transform.inverse());
+        animated.transform = transform;
+    }
+
 }  // namespace LCNS
@@ -0,0 +1,51 @@
+//===============================================================================================//
+/*!
+ *  \file      SceneArena.cpp
+ *  \author    Loïc Corenthy
+ *  \version   1.2
+ *  \date      19/10/2026
+ *  \copyright (c) 2026 Loïc Corenthy. All rights reserved.
+ */
+//===============================================================================================//
+
+#include "SceneArena.hpp"
+
+#include <algorithm>
+
+using std::byte;
+using std::make_unique;
+using std::max;
+using std::size_t;
+
+using LCNS::SceneArena;
+
+void* SceneArena::Pool::allocate(size_t size, size_t alignment)
+{
+    void* address = current;
+    if (current == nullptr || std::align(alignment, size, address, remaining) == nullptr)
+    {
+        // The rest of the current block is lost, the new block is large enough for the object even if it is aligned at its end
+        const size_t blockSize = max(_blockSize, size + alignment);
+        blocks.push_back(make_unique<byte[]>(blockSize));
+        reservedBytes += blockSize;
+
+        address   = blocks.back().get();
+        remaining = blockSize;
+        std::align(alignment, size, address, remaining);
+    }
+
+    current = static_cast<byte*>(address) + size;
+    remaining -= size;
+
+    return address;
+}
+
+size_t SceneArena::reservedBytes(void) const noexcept
+{
+    size_t bytes = 0u;
+
+    for ([[maybe_unused]] const auto& [type, pool] : _pools)
+        bytes += pool->reservedBytes;
+
+    return bytes;
+}
@@ -0,0 +1,155 @@
+//===============================================================================================//
+/*!
+ *  \file      SceneArena.hpp
+ *  \author    Loïc Corenthy
+ *  \version   1.2
+ *  \date      19/10/2026
+ *  \copyright (c) 2026 Loïc Corenthy. All rights reserved.
+ */
+//===============================================================================================//
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace LCNS
+{
+    /// Monotonic memory of the objects of a scene, with one pool per type so that the objects of a type (the spheres, the triangles, the
+    /// shaders...) are next to each other. An object is created with its shared pointer control block in the pool of its type, destroying the
+    /// object does not free its memory: the memory of a pool is released at once when the arena and all the objects of the pool are destroyed
+    /// (the allocator in the control block of each object keeps its pool alive). The arena is not thread safe, the scenes are built by a single
+    /// thread.
+    class SceneArena
+    {
+    private:
+        struct Pool
+        {
+            /// Reserve memory in the current block of the pool, or in a new block if it is full
+            void* allocate(std::size_t size, std::size_t alignment);
+
+            std::vector<std::unique_ptr<std::byte[]>> blocks;
+            std::byte*                                current       = nullptr;
+            std::size_t                               remaining     = 0u;
+            std::size_t                               reservedBytes = 0u;
+        };
+
+    public:
+        /// Allocator placing the objects (and the control blocks of their shared pointers) in a pool of the arena
+        template<typename T>
+        class Allocator
+        {
+        public:
+            using value_type = T;
+
+            /// Constructor with the pool the memory comes from, it is kept alive by the allocator
+            explicit Allocator(std::shared_ptr<Pool> pool) noexcept;
+
+            /// Conversion from the allocator of another type, the memory comes from the same pool
+            template<typename U>
+            Allocator(const Allocator<U>& allocator) noexcept;
+
+            /// Reserve the memory of count objects
+            T* allocate(std::size_t count);
+
+            /// Memory is only released with the arena
+            void deallocate(T* pointer, std::size_t count) noexcept;
+
+            /// Check if two allocators use the same pool
+            template<typename U>
+            bool operator==(const Allocator<U>& allocator) const noexcept;
+
+            /// Check if two allocators use different pools
+            template<typename U>
+            bool operator!=(const Allocator<U>& allocator) const noexcept;
+
+        private:
+            template<typename U>
+            friend class Allocator;
+
+            std::shared_ptr<Pool> _pool;
+        };
+
+    public:
+        /// Default constructor
+        SceneArena(void) = default;
+
+        /// Copy constructor (copy not allowed)
+        SceneArena(const SceneArena& sceneArena) = delete;
+
+        /// Copy operator (copy not allowed)
+        SceneArena& operator=(const SceneArena& sceneArena) = delete;
+
+        /// Destructor, releases the memory of the pools whose objects are all destroyed
+        ~SceneArena(void) = default;
+
+        /// Create an object in the pool of its type
+        template<typename T, typename... Arguments>
+        std::shared_ptr<T> create(Arguments&&... arguments);
+
+        /// Get the number of bytes reserved by all the pools
+        std::size_t reservedBytes(void) const noexcept;
+
+    private:
+        /// Size of the blocks of the pools, an object larger than that gets its own block
+        static constexpr std::size_t _blockSize = 64u * 1024u;
+
+    private:
+        std::unordered_map<std::type_index, std::shared_ptr<Pool>> _pools;
+
+    };  // class SceneArena
+
+    template<typename T>
+    SceneArena::Allocator<T>::Allocator(std::shared_ptr<Pool> pool) noexcept
+    : _pool(std::move(pool))
+    {
+    }
+
+    template<typename T>
+    template<typename U>
+    SceneArena::Allocator<T>::Allocator(const Allocator<U>& allocator) noexcept
+    : _pool(allocator._pool)
+    {
+    }
+
+    template<typename T>
+    T* SceneArena::Allocator<T>::allocate(std::size_t count)
+    {
+        return static_cast<T*>(_pool->allocate(count * sizeof(T), alignof(T)));
+    }
+
+    template<typename T>
+    void SceneArena::Allocator<T>::deallocate([[maybe_unused]] T* pointer, [[maybe_unused]] std::size_t count) noexcept
+    {
+    }
+
+    template<typename T>
+    template<typename U>
+    bool SceneArena::Allocator<T>::operator==(const Allocator<U>& allocator) const noexcept
+    {
+        return _pool == allocator._pool;
+    }
+
+    template<typename T>
+    template<typename U>
+    bool SceneArena::Allocator<T>::operator!=(const Allocator<U>& allocator) const noexcept
+    {
+        return _pool != allocator._pool;
+    }
+
+    template<typename T, typename... Arguments>
+    std::shared_ptr<T> SceneArena::create(Arguments&&... arguments)
+    {
+        auto& pool = _pools[std::type_index(typeid(T))];
+        if (!pool)
+            pool = std::make_shared<Pool>();
+
+        return std::allocate_shared<T>(Allocator<T>(pool), std::forward<Arguments>(arguments)...);
+    }
+
+}  // namespace LCNS
@@ -0,0 +1,575 @@
+//===============================================================================================//
+/*!
+ *  \file      SceneFile.cpp
+ *  \author    Loïc Corenthy
+ *  \version   1.2
+ *  \date      19/10/2026
+ *  \copyright (c) 2026 Loïc Corenthy. All rights reserved.
+ */
+//===============================================================================================//
+
+#include "SceneFile.hpp"
+
+#include <array>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "Animation.hpp"
+#include "AssetLoader.hpp"
+#include "Camera.hpp"
+#include "CreateScenes.hpp"
+#include "CubeMap.hpp"
+#include "DirectionalLight.hpp"
+#include "Lambert.hpp"
+#include "OBJFile.hpp"
+#include "Phong.hpp"
+#include "PunctualLight.hpp"
+#include "Scene.hpp"
+#include "Shader.hpp"
+#include "Sphere.hpp"
+#include "Trace.hpp"
+#include "Triangle.hpp"
+
+using std::array;
+using std::ifstream;
+using std::make_unique;
+using std::map;
+using std::pair;
+using std::runtime_error;
+using std::shared_future;
+using std::shared_ptr;
+using std::string;
+using std::stringstream;
+using std::strtoul;
+using std::vector;
+
+using LCNS::Animation;
+using LCNS::AssetLoader;
+using LCNS::BRDF;
+using LCNS::Camera;
+using LCNS::Color;
+using LCNS::CubeMap;
+using LCNS::DirectionalLight;
+using LCNS::Image;
+using LCNS::JsonValue;
+using LCNS::Lambert;
+using LCNS::Light;
+using LCNS::OBJFile;
+using LCNS::Phong;
+using LCNS::Point;
+using LCNS::PunctualLight;
+using LCNS::Renderable;
+using LCNS::Scene;
+using LCNS::SceneFile;
+using LCNS::Shader;
+using LCNS::Sphere;
+using LCNS::toReal;
+using LCNS::TraceScope;
+using LCNS::Triangle;
+using LCNS::Vector;
+
+namespace
+{
+    /// Value of pi used by the scenes of CreateScenes.cpp, the angles of the files are converted with it so that a scene written in a file
+    /// renders the same image as the same scene written in C++
+    constexpr double pi = 3.141592;
+
+    /// Convert an angle of the file (in degrees) to radians
+    double radians(const JsonValue& degrees)
+    {
+        return degrees.number() * pi / 180.0;
+    }
+
+    /// Get an optional number of an object
+    double number(const JsonValue& object, const string& name, double defaultValue)
+    {
+        return object.has(name) ? object[name].number() : defaultValue;
+    }
+
+    /// Get a positive integer (a count or an exponent)
+    unsigned int positiveInteger(const JsonValue& value)
+    {
+        const auto number = value.number();
+        if (number < 0.0 || number != static_cast<double>(static_cast<unsigned int>(number)))
+            throw runtime_error(value.path() + " should be a positive integer");
+
+        return static_cast<unsigned int>(number);
+    }
+
+    /// Get the 3 numbers of an array
+    array<double, 3> triple(const JsonValue& value)
+    {
+        const auto& values = value.array();
+        if (values.size() != 3u)
+            throw runtime_error(value.path() + " should be an array of 3 numbers");
+
+        return { values[0].number(), values[1].number(), values[2].number() };
+    }
+
+    Point pointFrom(const JsonValue& value)
+    {
+        const auto [x, y, z] = triple(value);
+        return Point(toReal(x), toReal(y), toReal(z));
+    }
+
+    Vector vectorFrom(const JsonValue& value)
+    {
+        const auto [x, y, z] = triple(value);
+        return Vector(toReal(x), toReal(y), toReal(z));
+    }
+
+    /// Get a color: a number for a grey, 3 numbers, or a string "#rrggbb" with the components between 0 and 255
+    Color colorFrom(const JsonValue& value)
+    {
+        if (value.type() == JsonValue::Type::NUMBER)
+            return Color(value.number());
+
+        if (value.type() == JsonValue::Type::STRING)
+        {
+            const auto& text = value.string();
+            if (text.size() != 7u || text[0] != '#' || text.find_first_not_of("0123456789abcdefABCDEF", 1u) != string::npos)
+                throw runtime_error(value.path() + " should be a color written #rrggbb");
+
+            const auto component = [&text](std::size_t index) { return static_cast<int>(strtoul(text.substr(index, 2u).c_str(), nullptr, 16)); };
+            return Color(component(1u), component(3u), component(5u));
+        }
+
+        const auto [red, green, blue] = triple(value);
+        return Color(red, green, blue);
+    }
+
+    /// Get an optional color of an object, scaled by its optional intensity
+    Color colorFrom(const JsonValue& object, const string& name, const Color& defaultColor)
+    {
+        auto result = object.has(name) ? colorFrom(object[name]) : defaultColor;
+
+        if (object.has("intensity"))
+            result *= object["intensity"].number();
+
+        return result;
+    }
+
+    /// Get the value of an enumeration from its name, where is the value of the file the name comes from
+    template<typename T>
+    T enumeration(const string& text, const string& where, const vector<pair<string, T>>& names)
+    {
+        string expected;
+
+        for (const auto& [name, enumerator] : names)
+        {
+            if (text == name)
+                return enumerator;
+
+            expected += (expected.empty() ? "" : ", ") + name;
+        }
+
+        throw runtime_error(where + " should be one of " + expected);
+    }
+
+    template<typename T>
+    T enumeration(const JsonValue& value, const vector<pair<string, T>>& names)
+    {
+        return enumeration<T>(value.string(), value.path(), names);
+    }
+
+    /// Get a face of a cube map from its name
+    CubeMap::Faces face(const string& name, const string& where)
+    {
+        return enumeration<CubeMap::Faces>(name,
+                                           where,
+                                           { { "up", CubeMap::Faces::UP },
+                                             { "down", CubeMap::Faces::DOWN },
+                                             { "left", CubeMap::Faces::LEFT },
+                                             { "right", CubeMap::Faces::RIGHT },
+                                             { "back", CubeMap::Faces::BACK },
+                                             { "front", CubeMap::Faces::FRONT } });
+    }
+
+    /// Get the animation of an object or a light: the keys (time in seconds, translation and angle in degrees around the axis going through
+    /// the pivot)
+    Animation animation(const JsonValue& value)
+    {
+        Animation result = value.has("axis") ? Animation(pointFrom(value["pivot"]), vectorFrom(value["axis"])) : Animation();
+
+        for (const auto& key : value["keys"].array())
+            result.key(key["time"].number(), key.has("translation") ? vectorFrom(key["translation"]) : Vector(0.0, 0.0, 0.0),
+                       key.has("angle") ? radians(key["angle"]) : 0.0);
+
+        return result;
+    }
+}  // namespace
+
+SceneFile::SceneFile(const string& path)
+: _path(path)
+{
+    TraceScope traceScope("SceneFile::read", "scene");
+
+    ifstream file(_path);
+    if (!file)
+    {
+        throw runtime_error("Unable to open the scene file " + _path);
+    }
+
+    stringstream text;
+    text << file.rdbuf();
+
+    try
+    {
+        _document = JsonValue::parse(text.str());
+    }
+    catch (const runtime_error& error)
+    {
+        throw runtime_error(_path + ": " + error.what());
+    }
+}
+
+void SceneFile::create(shared_ptr<Scene> scene)
+{
+    TraceScope traceScope("SceneFile::create", "scene");
+
+    try
+    {
+        const auto& document = _document.object();
+        const auto  section  = [&document](const string& name) -> const JsonValue* {
+            const auto member = document.find(name);
+            return member != document.end() ? &member->second : nullptr;
+        };
+
+        // The .obj files are read in parallel while the rest of the scene is created
+        vector<shared_future<OBJFile>> objFiles;
+
+        if (const auto* objects = section("objects"))
+        {
+            for (const auto& object : objects->array())
+            {
+                if (object["type"].string() == "obj")
+                    objFiles.push_back(AssetLoader::loadOBJ(_resolve(object["file"])));
+            }
+        }
+
+        _createCubeMaps(*scene);
+        _createBRDFs(*scene);
+        _createShaders(scene);
+        _createLights(*scene);
+        _createCameras(*scene);
+        _createBackground(*scene);
+
+        if (const auto* objects = section("objects"))
+        {
+            auto nextOBJFile = objFiles.begin();
+
+            for (const auto& object : objects->array())
+            {
+                const auto& type = object["type"].string();
+
+                vector<shared_ptr<Renderable>> renderables;
+
+                if (type == "sphere")
+                {
+                    renderables.push_back(scene->create<Sphere>(pointFrom(object["center"]), toReal(object["radius"].number())));
+                }
+                else if (type == "triangle")
+                {
+                    const auto& vertices = object["vertices"];
+                    if (vertices.array().size() != 3u)
+                        throw runtime_error(vertices.path() + " should be an array of 3 points");
+
+                    auto triangle
+                    = scene->create<Triangle>(pointFrom(vertices.array()[0]), pointFrom(vertices.array()[1]), pointFrom(vertices.array()[2]));
+
+                    // The normal is the same at the 3 vertices, the normal of the triangle if there is none in the file
+                    const auto normal = object.has("normal") ? vectorFrom(object["normal"]) : triangle->normal(triangle->vertexPositions()[0]);
+                    triangle->vertexNormals().fill(normal);
+
+                    renderables.push_back(triangle);
+                }
+                else if (type == "obj")
+                {
+                    const auto& objFile = (nextOBJFile++)->get();
+                    if (!objFile.isLoaded())
+                        throw runtime_error(object["file"].path() + ": unable to read " + objFile.path());
+
+                    renderables = scene->createFromFile(objFile);
+
+                    // The meshes get the shader of their group, or the shader of the file
+                    for (auto& renderable : renderables)
+                    {
+                        if (object.has("groups") && object["groups"].has(renderable->name()))
+                            renderable->shader(_named(_shaders, object["groups"][renderable->name()]));
+                        else if (object.has("shader"))
+                            renderable->shader(_named(_shaders, object["shader"]));
+                    }
+                }
+                else if (type == "floor" || type == "room")
+                {
+                    // The paths of the textures, "no_texture" for the faces without texture
+                    const auto texture = [this, &object](const string& name) {
+                        return object.has(name) ? _resolve(object[name]) : string("no_texture");
+                    };
+
+                    if (type == "floor")
+                    {
+                        const FloorParameters parameters = { colorFrom(object["diffusion"]),
+                                                             colorFrom(object["specular"]),
+                                                             number(object, "reflection", 1.0),
+                                                             number(object, "refraction", 1.0),
+                                                             static_cast<unsigned short>(positiveInteger(object["reflectionCountMax"])),
+                                                             object["size"].number(),
+                                                             object["depth"].number(),
+                                                             texture("texture") };
+                        createFloor(scene, parameters);
+                    }
+                    else
+                    {
+                        const RoomParameters parameters = { colorFrom(object["diffusion"]),
+                                                            colorFrom(object["specular"]),
+                                                            number(object, "reflection", 1.0),
+                                                            number(object, "refraction", 1.0),
+                                                            static_cast<unsigned short>(positiveInteger(object["reflectionCountMax"])),
+                                                            pointFrom(object["lowCorner"]),
+                                                            vectorFrom(object["dimensions"]),
+                                                            texture("floorTexture"),
+                                                            texture("leftWallTexture"),
+                                                            texture("rightWallTexture"),
+                                                            texture("backWallTexture"),
+                                                            texture("ceilingTexture") };
+                        createRoom(scene, parameters);
+                    }
+                }
+                else
+                {
+                    throw runtime_error(object["type"].path() + " should be sphere, triangle, obj, floor or room");
+                }
+
+                // The objects of a .obj file are already in the scene, the floor and the room create their own shaders
+                if (type == "sphere" || type == "triangle")
+                {
+                    renderables.back()->shader(_named(_shaders, object["shader"]));
+
+                    if (object.has("name"))
+                        renderables.back()->name(object["name"].string());
+
+                    scene->add(renderables.back());
+                }
+
+                if (object.has("animation"))
+                {
+                    const auto objectAnimation = animation(object["animation"]);
+                    for (auto& renderable : renderables)
+                        scene->animate(renderable, objectAnimation);
+                }
+            }
+        }
+    }
+    catch (const runtime_error& error)
+    {
+        throw runtime_error(_path + ": " + error.what());
+    }
+}
+
+const string& SceneFile::path(void) const noexcept
+{
+    return _path;
+}
+
+void SceneFile::_createCubeMaps(Scene& scene)
+{
+    if (!_document.has("cubeMaps"))
+        return;
+
+    for (const auto& [cubeMapName, value] : _document["cubeMaps"].object())
+    {
+        auto cubeMap = scene.create<CubeMap>(pointFrom(value["center"]), value["size"].number());
+
+        // A face is either the path of an image, or the name of the face whose image it shows
+        const auto&                       faces = value["faces"];
+        map<CubeMap::Faces, unsigned int> imageIndices;
+
+        for (const auto& [name, image] : faces.object())
+        {
+            if (faces.object().count(image.string()) == 0u)
+            {
+                imageIndices.emplace(face(name, faces.path()), static_cast<unsigned int>(imageIndices.size()));
+                cubeMap->addImage(face(name, faces.path()), _resolve(image));
+            }
+        }
+
+        for (const auto& [name, image] : faces.object())
+        {
+            if (faces.object().count(image.string()) != 0u)
+            {
+                const auto linked = imageIndices.find(face(image.string(), image.path()));
+                if (linked == imageIndices.end())
+                    throw runtime_error(image.path() + " should be the path of an image or a face with an image");
+
+                cubeMap->setLink(face(name, faces.path()), linked->second);
+            }
+        }
+
+        if (value.has("interpolation"))
+            cubeMap->interpolationMethod(enumeration<Image::InterpolationMethod>(
+            value["interpolation"], { { "nearest", Image::InterpolationMethod::NEAREST }, { "linear", Image::InterpolationMethod::LINEAR } }));
+
+        scene.add(cubeMap);
+        _cubeMaps.emplace(cubeMapName, cubeMap);
+    }
+}
+
+void SceneFile::_createBRDFs(Scene& scene)
+{
+    if (!_document.has("brdfs"))
+        return;
+
+    for (const auto& [name, value] : _document["brdfs"].object())
+    {
+        const auto&      type = value["type"].string();
+        shared_ptr<BRDF> bRDF;
+
+        if (type == "phong")
+        {
+            const auto exponent = static_cast<int>(positiveInteger(value["exponent"]));
+            bRDF                = scene.create<Phong>(colorFrom(value["diffusion"]), colorFrom(value["specular"]), exponent);
+        }
+        else if (type == "lambert")
+        {
+            bRDF = scene.create<Lambert>(colorFrom(value["diffusion"]));
+        }
+        else
+        {
+            throw runtime_error(value["type"].path() + " should be phong or lambert");
+        }
+
+        if (value.has("ambient"))
+            bRDF->ambient(colorFrom(value["ambient"]));
+
+        if (value.has("cubeMap"))
+            bRDF->cubeMap(_named(_cubeMaps, value["cubeMap"]));
+
+        scene.add(bRDF, name);
+        _bRDFs.emplace(name, bRDF);
+    }
+}
+
+void SceneFile::_createShaders(shared_ptr<Scene> scene)
+{
+    if (!_document.has("shaders"))
+        return;
+
+    for (const auto& [name, value] : _document["shaders"].object())
+    {
+        const auto material = value.has("material") ? enumeration<unsigned short>(value["material"],
+                                                                                   { { "none", Shader::Material::NONE },
+                                                                                     { "marble", Shader::Material::MARBLE },
+                                                                                     { "turbulance", Shader::Material::TURBULANCE },
+                                                                                     { "bump", Shader::Material::BUMP } })
+                                                    : static_cast<unsigned short>(Shader::Material::NONE);
+
+        auto shader = scene->create<Shader>(
+        _named(_bRDFs, value["brdf"]), number(value, "reflection", 1.0), number(value, "refraction", 1.0), scene, material);
+
+        if (value.has("reflectionCountMax"))
+            shader->setReflectionCountMax(static_cast<unsigned short>(positiveInteger(value["reflectionCountMax"])));
+
+        scene->add(shader, name);
+        _shaders.emplace(name, shader);
+    }
+}
+
+void SceneFile::_createLights(Scene& scene) const
+{
+    if (!_document.has("lights"))
+        return;
+
+    for (const auto& value : _document["lights"].array())
+    {
+        const auto&       type = value["type"].string();
+        shared_ptr<Light> light;
+
+        if (type == "punctual")
+            light = scene.create<PunctualLight>(pointFrom(value["position"]), colorFrom(value, "color", Color(1.0)));
+        else if (type == "directional")
+            light = scene.create<DirectionalLight>(vectorFrom(value["direction"]), colorFrom(value, "color", Color(1.0)));
+        else
+            throw runtime_error(value["type"].path() + " should be punctual or directional");
+
+        scene.add(light);
+
+        if (value.has("animation"))
+            scene.animate(light, animation(value["animation"]));
+    }
+}
+
+void SceneFile::_createCameras(Scene& scene) const
+{
+    if (!_document.has("cameras"))
+        return;
+
+    for (const auto& value : _document["cameras"].array())
+    {
+        auto camera
+        = make_unique<Camera>(pointFrom(value["position"]), vectorFrom(value["direction"]), vectorFrom(value["up"]), radians(value["fov"]));
+
+        if (value.has("focalPoint"))
+            camera->focalPoint(pointFrom(value["focalPoint"]));
+
+        if (value.has("aperture"))
+        {
+            const auto aperture = enumeration<Camera::Aperture>(value["aperture"],
+                                                                { { "all_sharp", Camera::Aperture::ALL_SHARP },
+                                                                  { "f_small", Camera::Aperture::F_SMALL },
+                                                                  { "f_medium", Camera::Aperture::F_MEDIUM },
+                                                                  { "f_big", Camera::Aperture::F_BIG } });
+
+            const auto precision = value.has("precision") ? enumeration<Camera::Precision>(value["precision"],
+                                                                                           { { "low", Camera::Precision::LOW },
+                                                                                             { "medium", Camera::Precision::MEDIUM },
+                                                                                             { "high", Camera::Precision::HIGH },
+                                                                                             { "excellent", Camera::Precision::EXCELLENT },
+                                                                                             { "super_awesome", Camera::Precision::SUPER_AWESOME } })
+                                                          : Camera::Precision::LOW;
+
+            camera->aperture(aperture, precision, number(value, "focalLength", 0.0));
+        }
+
+        scene.add(std::move(camera));
+    }
+}
+
+void SceneFile::_createBackground(Scene& scene) const
+{
+    if (!_document.has("background"))
+        return;
+
+    const auto& background = _document["background"];
+
+    if (background.type() == JsonValue::Type::STRING && background.string().empty())
+        throw runtime_error(background.path() + " should be a color or the name of a cube map");
+
+    // The name of a cube map, or a color
+    if (background.type() == JsonValue::Type::STRING && background.string().front() != '#')
+        scene.backgroundCubeMap(_named(_cubeMaps, background));
+    else
+        scene.setBackgroundColor(colorFrom(background));
+}
+
+string SceneFile::_resolve(const JsonValue& value) const
+{
+    const std::filesystem::path filePath(value.string());
+    return filePath.is_absolute() ? filePath.string() : (std::filesystem::path(_path).parent_path() / filePath).string();
+}
+
+template<typename T>
+shared_ptr<T> SceneFile::_named(const map<string, shared_ptr<T>>& values, const JsonValue& name)
+{
+    const auto value = values.find(name.string());
+    if (value == values.end())
+        throw runtime_error(name.path() + ": there is nothing named " + name.string());
+
+    return value->second;
+}
@@ -0,0 +1,88 @@
+//===============================================================================================//
+/*!
+ *  \file      SceneFile.hpp
+ *  \author    Loïc Corenthy
+ *  \version   1.2
+ *  \date      19/10/2026
+ *  \copyright (c) 2026 Loïc Corenthy. All rights reserved.
+ */
+//===============================================================================================//
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+
+#include "JsonValue.hpp"
+
+namespace LCNS
+{
+    // Forward declaration
+    class BRDF;
+    class CubeMap;
+    class Scene;
+    class Shader;
+
+    /// Scene described in a JSON file, so that a scene can be changed without building the executable again. The file is an object with the
+    /// sections "background", "cubeMaps", "brdfs", "shaders", "lights", "cameras" and "objects" (all optional). The cube maps, the BRDFs and
+    /// the shaders are objects of named values, referenced by their name in the other sections. The relative paths of the images and of the
+    /// .obj files are relative to the directory of the scene file. See resources/scenes for examples.
+    class SceneFile
+    {
+    public:
+        /// Constructor with the path of the file, which is read. Throws a runtime error if it can not be read or is not a valid JSON document.
+        explicit SceneFile(const std::string& path);
+
+        /// Copy constructor (copy not allowed)
+        SceneFile(const SceneFile& sceneFile) = delete;
+
+        /// Copy operator (copy not allowed)
+        SceneFile& operator=(const SceneFile& sceneFile) = delete;
+
+        /// Destructor
+        ~SceneFile(void) = default;
+
+        /// Create the content of the file in a scene. The .obj files are independent from each other and from the rest of the scene, they are
+        /// read in parallel while the other objects are created. Throws a runtime error naming the value of the file that is not valid.
+        void create(std::shared_ptr<Scene> scene);
+
+        /// Get the path of the file
+        const std::string& path(void) const noexcept;
+
+    private:
+        /// Create the cube maps of the file
+        void _createCubeMaps(Scene& scene);
+
+        /// Create the BRDFs of the file
+        void _createBRDFs(Scene& scene);
+
+        /// Create the shaders of the file
+        void _createShaders(std::shared_ptr<Scene> scene);
+
+        /// Create the lights of the file
+        void _createLights(Scene& scene) const;
+
+        /// Create the cameras of the file
+        void _createCameras(Scene& scene) const;
+
+        /// Set the background of the scene
+        void _createBackground(Scene& scene) const;
+
+        /// Get a path of the file, relative to the directory of the file if it is not absolute
+        std::string _resolve(const JsonValue& path) const;
+
+        /// Get a cube map, a BRDF or a shader of the file with its name
+        template<typename T>
+        static std::shared_ptr<T> _named(const std::map<std::string, std::shared_ptr<T>>& values, const JsonValue& name);
+
+    private:
+        std::string                                     _path;
+        JsonValue                                       _document;
+        std::map<std::string, std::shared_ptr<CubeMap>> _cubeMaps;
+        std::map<std::string, std::shared_ptr<BRDF>>    _bRDFs;
+        std::map<std::string, std::shared_ptr<Shader>>  _shaders;
+
+    };  // class SceneFile
+
+}  // namespace LCNS
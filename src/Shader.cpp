@@ -14,6 +14,8 @@
 #include <iostream>
 #include <cmath>
 #include <memory>
+#include <optional>
+#include <vector>
 
 #include "Color.hpp"
 #include "Scene.hpp"
@@ -23,12 +25,15 @@
 #include "Noise.hpp"
 #include "CubeMap.hpp"
 
+using std::optional;
 using std::shared_ptr;
+using std::vector;
 
 using LCNS::BRDF;
 using LCNS::Color;
 using LCNS::Scene;
 using LCNS::Shader;
+using LCNS::toReal;
 
 
 Shader::Shader(shared_ptr<BRDF> bRDF, double reflectionCoeff, double refractionCoeff, shared_ptr<Scene> scene, unsigned short material)
@@ -113,6 +118,39 @@ void Shader::setRefractionCoeff(double coeff)
 }
 
 Color Shader::color(const Vector& vecToViewer, const Vector& normal, const Point& point, Renderable* thisShader, unsigned int reflectionCount)
+{
+    const auto& lightTree = _scene->lightTree();
+
+    if (lightTree.selectsAll())
+        return _color(vecToViewer,
+                      normal,
+                      point,
+                      reflectionCount,
+                      [&](unsigned int, const Light& light) { return light.intensityAt(point, *_scene, thisShader); });
+
+    assert(lightTree.lightCount() == _scene->lights().size() && "The light tree must be built after the lights are added to the scene");
+
+    // Only the lights selected by the light tree are traced, their intensity is scaled by their weight
+    thread_local vector<double> weights;
+    lightTree.select(point, weights);
+
+    return _color(vecToViewer, normal, point, reflectionCount, [&](unsigned int index, const Light& light) {
+        if (weights[index] == 0.0)
+            return Color(0.0);
+
+        return light.intensityAt(point, *_scene, thisShader) * weights[index];
+    });
+}
+
+Color Shader::color(const Vector& vecToViewer, const Vector& normal, const Point& point, const Color* lightIntensities, unsigned int reflectionCount)
+{
+    assert((lightIntensities != nullptr || _scene->lights().empty()) && "The intensities of the lights must be provided");
+
+    return _color(vecToViewer, normal, point, reflectionCount, [lightIntensities](unsigned int index, const Light&) { return lightIntensities[index]; });
+}
+
+template <typename T>
+Color Shader::_color(const Vector& vecToViewer, const Vector& normal, const Point& point, unsigned int reflectionCount, T intensityOfLight)
 {
     Color myColor(0.0);
 
@@ -123,15 +161,22 @@ Color Shader::color(const Vector& vecToViewer, const Vector& normal, const Point
         currentReflectionCoeff = _reflectionCoeff / static_cast<double>(reflectionCount * reflectionCount);
     }
 
-    double noiseCoeff = 0.0;
-    Noise  noise;
+    double      noiseCoeff = 0.0;
+    const Noise noise;
+
+    // The noise only depends on the point, it is evaluated at most once and only if a light reaches the point
+    optional<double> turbulence;
+    optional<Vector> bumpNormal;
+
+    // Index of the current light in the light list of the scene
+    unsigned int lightIndex = 0u;
 
     switch (_material)
     {
         case MARBLE:
-            for (const auto& light : _scene->lightList())
+            for (const auto& light : _scene->lights())
             {
-                Color lightIntensity = light->intensityAt(point, *_scene, thisShader);
+                Color lightIntensity = intensityOfLight(lightIndex++, *light);
 
                 if (!(lightIntensity == Color(0.0)))
                 {
@@ -139,8 +184,10 @@ Color Shader::color(const Vector& vecToViewer, const Vector& normal, const Point
                     myColor += lightIntensity * _bRDF->diffuse(light->directionFrom(point), normal, point);  //*_currentReflectionCoeff;
 
                     // Add turbulance noise to diffuse component
-                    for (double level = 1.0; level < 10.0; level += 1.0)
-                        noiseCoeff += (1.0 / level) * fabs(noise.perlinNoise(level * point.x(), level * point.y(), level * point.z()));
+                    if (!turbulence)
+                        turbulence = noise.turbulence(point.x(), point.y(), point.z(), 9);
+
+                    noiseCoeff += *turbulence;
 
                     myColor *= noiseCoeff;
 
@@ -151,9 +198,9 @@ Color Shader::color(const Vector& vecToViewer, const Vector& normal, const Point
             break;
 
         case TURBULANCE:
-            for (const auto& light : _scene->lightList())
+            for (const auto& light : _scene->lights())
             {
-                Color lightIntensity = light->intensityAt(point, *_scene, thisShader);
+                Color lightIntensity = intensityOfLight(lightIndex++, *light);
 
                 if (!(lightIntensity == Color(0.0)))
                 {
@@ -161,10 +208,12 @@ Color Shader::color(const Vector& vecToViewer, const Vector& normal, const Point
                     myColor += lightIntensity * _bRDF->diffuse(light->directionFrom(point), normal, point);  //*_currentReflectionCoeff;
 
                     // Add turbulance noise to diffuse component
-                    for (double level = 1.0; level < 10.0; level += 1.0)
-                        noiseCoeff += (1.0 / level) * fabs(noise.perlinNoise(level * point.x(), level * point.y(), level * point.z()));
+                    if (!turbulence)
+                        turbulence = noise.turbulence(point.x(), point.y(), point.z(), 9);
+
+                    noiseCoeff += *turbulence;
 
-                    noiseCoeff = 0.5 * sin((point.x() + point.y()) + noiseCoeff) + 0.5;
+                    noiseCoeff = 0.5 * sin(double{ point.x() + point.y() } + noiseCoeff) + 0.5;
 
                     myColor *= noiseCoeff;
 
@@ -175,22 +224,27 @@ Color Shader::color(const Vector& vecToViewer, const Vector& normal, const Point
             break;
 
         case BUMP:
-            for (const auto& light : _scene->lightList())
+            for (const auto& light : _scene->lights())
             {
-                Color lightIntensity = light->intensityAt(point, *_scene, thisShader);
+                Color lightIntensity = intensityOfLight(lightIndex++, *light);
 
                 if (!(lightIntensity == Color(0.0)))
                 {
-                    const double noiseX = noise.perlinNoise(point.x(), point.y(), point.z());
-                    const double noiseY = noise.perlinNoise(point.y(), point.z(), point.x());
-                    const double noiseZ = noise.perlinNoise(point.z(), point.x(), point.y());
+                    if (!bumpNormal)
+                    {
+                        const double xs[3] = { point.x(), point.y(), point.z() };
+                        const double ys[3] = { point.y(), point.z(), point.x() };
+                        const double zs[3] = { point.z(), point.x(), point.y() };
+                        double       noises[3];
 
-                    Vector bumpNormal(normal.x() * noiseX, normal.y() * noiseY, normal.z() * noiseZ);
+                        noise.perlinNoise(xs, ys, zs, noises, 3);
 
-                    bumpNormal.normalize();
+                        bumpNormal = Vector(normal.x() * toReal(noises[0]), normal.y() * toReal(noises[1]), normal.z() * toReal(noises[2]));
+                        bumpNormal->normalize();
+                    }
 
                     // Calculate diffuse component
-                    myColor += lightIntensity * _bRDF->diffuse(light->directionFrom(point), bumpNormal, point);  //*_currentReflectionCoeff;
+                    myColor += lightIntensity * _bRDF->diffuse(light->directionFrom(point), *bumpNormal, point);  //*_currentReflectionCoeff;
 
                     // Add turbulance noise to diffuse component
                     //                     for (double level = 1.0f; level < 10.0f; level += 1.0f)
@@ -199,16 +253,16 @@ Color Shader::color(const Vector& vecToViewer, const Vector& normal, const Point
 
                     // Add specular compoment
                     myColor
-                    += lightIntensity * _bRDF->specular(light->directionFrom(point), vecToViewer, bumpNormal, point);  //*_currentReflectionCoeff;
+                    += lightIntensity * _bRDF->specular(light->directionFrom(point), vecToViewer, *bumpNormal, point);  //*_currentReflectionCoeff;
                 }
             }
             break;
 
         case NONE:
         default:
-            for (const auto& light : _scene->lightList())
+            for (const auto& light : _scene->lights())
             {
-                Color lightIntensity = light->intensityAt(point, *_scene, thisShader);
+                Color lightIntensity = intensityOfLight(lightIndex++, *light);
 
                 if (!(lightIntensity == Color(0.0)))
                     myColor
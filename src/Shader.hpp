@@ -59,6 +59,10 @@ namespace LCNS
         /// Get the color at a point in function of the BRDF model
         Color color(const Vector& vecToViewer, const Vector& normal, const Point& point, Renderable* thisShader, unsigned int reflectionCount);
 
+        /// Get the color at a point in function of the BRDF model, the intensity of each light of the scene at this point has already been
+        /// calculated (same order as the light list of the scene)
+        Color color(const Vector& vecToViewer, const Vector& normal, const Point& point, const Color* lightIntensities, unsigned int reflectionCount);
+
         /// Get a pointer on the scene
         std::shared_ptr<Scene> ptrOnScene(void);
 
@@ -86,6 +90,11 @@ namespace LCNS
         /// Set the refraction coefficient, must be bigger than 1 to enable refraction
         void setRefractionCoeff(double coeff);
 
+    private:
+        /// Internal method to get the color at a point, intensityOfLight(index, light) gives the intensity of a light of the scene at the point
+        template <typename T>
+        Color _color(const Vector& vecToViewer, const Vector& normal, const Point& point, unsigned int reflectionCount, T intensityOfLight);
+
     private:
         std::shared_ptr<BRDF>  _bRDF;
         std::shared_ptr<Scene> _scene;
@@ -0,0 +1,76 @@
+//===============================================================================================//
+/*!
+ *  \file      ShadowCache.cpp
+ *  \author    Loïc Corenthy
+ *  \version   1.2
+ *  \date      19/10/2026
+ *  \copyright (c) 2026 Loïc Corenthy. All rights reserved.
+ */
+//===============================================================================================//
+
+#include "ShadowCache.hpp"
+
+#include <atomic>
+#include <vector>
+
+using std::atomic;
+using std::memory_order_relaxed;
+using std::vector;
+
+using LCNS::Renderable;
+using LCNS::ShadowCache;
+
+namespace
+{
+    atomic<unsigned int> slotCount   = 0u;
+    atomic<unsigned int> globalEpoch = 0u;
+
+    /// Cache of a thread
+    struct ThreadCache
+    {
+        /// Get the occluders of the thread, cleared if the cache has been invalidated since the last access
+        vector<Renderable*>& currentOccluders(void)
+        {
+            if (const auto epochNow = globalEpoch.load(memory_order_relaxed); epoch != epochNow)
+            {
+                occluders.clear();
+                epoch = epochNow;
+            }
+
+            return occluders;
+        }
+
+        vector<Renderable*> occluders;
+        unsigned int        epoch = 0u;
+    };
+
+    thread_local ThreadCache threadCache;
+
+}  // namespace
+
+unsigned int ShadowCache::newSlot(void)
+{
+    return slotCount.fetch_add(1u, memory_order_relaxed);
+}
+
+Renderable* ShadowCache::occluder(unsigned int slot)
+{
+    const auto& occluders = threadCache.currentOccluders();
+
+    return slot < occluders.size() ? occluders[slot] : nullptr;
+}
+
+void ShadowCache::occluder(unsigned int slot, Renderable* renderable)
+{
+    auto& occluders = threadCache.currentOccluders();
+
+    if (occluders.size() <= slot)
+        occluders.resize(slot + 1u, nullptr);
+
+    occluders[slot] = renderable;
+}
+
+void ShadowCache::invalidate(void) noexcept
+{
+    globalEpoch.fetch_add(1u, memory_order_relaxed);
+}
@@ -0,0 +1,40 @@
+//===============================================================================================//
+/*!
+ *  \file      ShadowCache.hpp
+ *  \author    Loïc Corenthy
+ *  \version   1.2
+ *  \date      19/10/2026
+ *  \copyright (c) 2026 Loïc Corenthy. All rights reserved.
+ */
+//===============================================================================================//
+
+#pragma once
+
+namespace LCNS
+{
+    // Forward declaration
+    class Renderable;
+
+    /// Cache of the last object found between a point and a light. Neighbouring points are usually hidden from a light by the same object, so
+    /// this object is tested first and the full intersection with the scene is only needed when it does not block the shadow ray. Each thread
+    /// has its own cache, with one entry per light (lights get their slot in the cache when they are created). The cache only holds hints, an
+    /// occluder found in the cache is always checked against the shadow ray. Its hits and misses are counted by the Statistics.
+    class ShadowCache
+    {
+    public:
+        /// Get a new slot for a light
+        static unsigned int newSlot(void);
+
+        /// Get the last occluder stored in the calling thread's cache for a light slot (nullptr if there is none)
+        static Renderable* occluder(unsigned int slot);
+
+        /// Store the last occluder of a light slot in the calling thread's cache
+        static void occluder(unsigned int slot, Renderable* renderable);
+
+        /// Clear the caches of all the threads (they are cleared the next time they are used), must be called when objects of the scene are
+        /// modified or destroyed
+        static void invalidate(void) noexcept;
+
+    };  // class ShadowCache
+
+}  // namespace LCNS
@@ -0,0 +1,363 @@
+//===============================================================================================//
+/*!
+ *  \file      Socket.cpp
+ *  \author    Loïc Corenthy
+ *  \version   1.2
+ *  \date      19/10/2026
+ *  \copyright (c) 2026 Loïc Corenthy. All rights reserved.
+ */
+//===============================================================================================//
+
+#include "Socket.hpp"
+
+#ifdef _WIN32
+    #include <winsock2.h>
+    #include <ws2tcpip.h>
+#else
+    #include <arpa/inet.h>
+    #include <cerrno>
+    #include <netdb.h>
+    #include <netinet/in.h>
+    #include <netinet/tcp.h>
+    #include <poll.h>
+    #include <sys/socket.h>
+    #include <sys/time.h>
+    #include <unistd.h>
+#endif
+
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+using std::runtime_error;
+using std::size_t;
+using std::string;
+using std::to_string;
+using std::uint32_t;
+using std::vector;
+
+using LCNS::Socket;
+
+namespace
+{
+#ifdef _WIN32
+    using PollDescriptor = WSAPOLLFD;
+
+    /// Close a socket of the system
+    void closeHandle(SOCKET handle)
+    {
+        closesocket(handle);
+    }
+
+    /// Wait for events on sockets of the system
+    int pollHandles(PollDescriptor* descriptors, unsigned int count)
+    {
+        return WSAPoll(descriptors, count, -1);
+    }
+
+    /// Check if a call failed because it was interrupted by a signal (never on Windows)
+    bool interrupted(void)
+    {
+        return false;
+    }
+
+    /// Flags of the sends
+    constexpr int sendFlags = 0;
+#else
+    using PollDescriptor = pollfd;
+
+    /// Close a socket of the system
+    void closeHandle(int handle)
+    {
+        ::close(handle);
+    }
+
+    /// Wait for events on sockets of the system
+    int pollHandles(PollDescriptor* descriptors, unsigned int count)
+    {
+        return poll(descriptors, count, -1);
+    }
+
+    /// Check if a call failed because it was interrupted by a signal, it can then be called again
+    bool interrupted(void)
+    {
+        return errno == EINTR;
+    }
+
+    /// Flags of the sends, a connection closed by the other end must not raise SIGPIPE (macOS sets SO_NOSIGPIPE on the socket instead)
+    #ifdef MSG_NOSIGNAL
+    constexpr int sendFlags = MSG_NOSIGNAL;
+    #else
+    constexpr int sendFlags = 0;
+    #endif
+#endif
+
+    /// Set an integer option of a socket
+    template<typename Handle>
+    void setOption(Handle handle, int level, int option, int value)
+    {
+        setsockopt(handle, level, option, reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+
+    /// Options of the connections between the coordinator and the workers: the messages are small and sent at once, and a machine that
+    /// disappeared is detected by the keep alive probes
+    template<typename Handle>
+    void setConnectionOptions(Handle handle)
+    {
+        setOption(handle, IPPROTO_TCP, TCP_NODELAY, 1);
+        setOption(handle, SOL_SOCKET, SO_KEEPALIVE, 1);
+#ifdef SO_NOSIGPIPE
+        setOption(handle, SOL_SOCKET, SO_NOSIGPIPE, 1);
+#endif
+    }
+}  // namespace
+
+Socket::Socket(Handle handle, const string& peer)
+: _handle(handle)
+, _peer(peer)
+{
+}
+
+Socket::Socket(Socket&& socket) noexcept
+: _handle(socket._handle)
+, _peer(std::move(socket._peer))
+{
+    socket._handle = _invalidHandle;
+}
+
+Socket& Socket::operator=(Socket&& socket) noexcept
+{
+    if (this != &socket)
+    {
+        close();
+
+        _handle        = socket._handle;
+        _peer          = std::move(socket._peer);
+        socket._handle = _invalidHandle;
+    }
+
+    return *this;
+}
+
+Socket::~Socket(void)
+{
+    close();
+}
+
+Socket Socket::listen(unsigned short port)
+{
+    _startup();
+
+    Socket listener(::socket(AF_INET, SOCK_STREAM, IPPROTO_TCP), "port " + to_string(port));
+    if (!listener.isValid())
+        throw runtime_error("Unable to create a socket to listen to port " + to_string(port));
+
+    // A coordinator started again right after the previous one can use the same port
+    setOption(listener._handle, SOL_SOCKET, SO_REUSEADDR, 1);
+
+    sockaddr_in address;
+    memset(&address, 0, sizeof(address));
+    address.sin_family      = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_ANY);
+    address.sin_port        = htons(port);
+
+    if (bind(listener._handle, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0 || ::listen(listener._handle, SOMAXCONN) != 0)
+        throw runtime_error("Unable to listen to port " + to_string(port));
+
+    return listener;
+}
+
+Socket Socket::connect(const string& host, unsigned short port)
+{
+    _startup();
+
+    addrinfo hints;
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family   = AF_INET;
+    hints.ai_socktype = SOCK_STREAM;
+    hints.ai_protocol = IPPROTO_TCP;
+
+    addrinfo* addresses = nullptr;
+    if (getaddrinfo(host.c_str(), to_string(port).c_str(), &hints, &addresses) != 0)
+        throw runtime_error("Unable to find the address of " + host);
+
+    // Try the addresses of the host one after the other
+    Socket connection;
+    for (const addrinfo* address = addresses; address != nullptr && !connection.isValid(); address = address->ai_next)
+    {
+        Socket candidate(::socket(address->ai_family, address->ai_socktype, address->ai_protocol), host + ":" + to_string(port));
+        if (candidate.isValid() && ::connect(candidate._handle, address->ai_addr, static_cast<socklen_t>(address->ai_addrlen)) == 0)
+            connection = std::move(candidate);
+    }
+
+    freeaddrinfo(addresses);
+
+    if (!connection.isValid())
+        throw runtime_error("Unable to connect to " + host + ":" + to_string(port));
+
+    setConnectionOptions(connection._handle);
+
+    return connection;
+}
+
+vector<size_t> Socket::waitReadable(const vector<const Socket*>& sockets)
+{
+    vector<PollDescriptor> descriptors(sockets.size());
+    for (size_t i = 0u; i < sockets.size(); ++i)
+    {
+        descriptors[i].fd     = sockets[i]->_handle;
+        descriptors[i].events = POLLIN;
+    }
+
+    const auto descriptorCount = static_cast<unsigned int>(descriptors.size());
+
+    int eventCount = pollHandles(descriptors.data(), descriptorCount);
+    while (eventCount < 0 && interrupted())
+        eventCount = pollHandles(descriptors.data(), descriptorCount);
+
+    if (eventCount < 0)
+        throw runtime_error("Unable to wait for the connections");
+
+    // A closed connection or an error is reported as readable, the receive that follows fails
+    vector<size_t> readable;
+    for (size_t i = 0u; i < descriptors.size(); ++i)
+    {
+        if ((descriptors[i].revents & (POLLIN | POLLHUP | POLLERR)) != 0)
+            readable.push_back(i);
+    }
+
+    return readable;
+}
+
+Socket Socket::accept(void) const
+{
+    sockaddr_in address;
+    socklen_t   addressSize = sizeof(address);
+    memset(&address, 0, sizeof(address));
+
+    const auto handle = ::accept(_handle, reinterpret_cast<sockaddr*>(&address), &addressSize);
+    if (handle == _invalidHandle)
+        return Socket();
+
+    char name[INET_ADDRSTRLEN] = { 0 };
+    inet_ntop(AF_INET, &address.sin_addr, name, sizeof(name));
+
+    Socket connection(handle, string(name) + ":" + to_string(ntohs(address.sin_port)));
+    setConnectionOptions(connection._handle);
+
+    return connection;
+}
+
+void Socket::receiveTimeout(unsigned int seconds)
+{
+#ifdef _WIN32
+    const DWORD timeout = seconds * 1000u;
+#else
+    timeval timeout;
+    timeout.tv_sec  = static_cast<time_t>(seconds);
+    timeout.tv_usec = 0;
+#endif
+
+    setsockopt(_handle, SOL_SOCKET, SO_RCVTIMEO, reinterpret_cast<const char*>(&timeout), sizeof(timeout));
+}
+
+bool Socket::send(const void* data, size_t size) const
+{
+    const char* bytes = static_cast<const char*>(data);
+
+    while (size != 0u)
+    {
+#ifdef _WIN32
+        const auto sent = ::send(_handle, bytes, static_cast<int>(size), sendFlags);
+#else
+        const auto sent = ::send(_handle, bytes, size, sendFlags);
+#endif
+        if (sent < 0 && interrupted())
+            continue;
+
+        if (sent <= 0)
+            return false;
+
+        bytes += sent;
+        size -= static_cast<size_t>(sent);
+    }
+
+    return true;
+}
+
+bool Socket::send(uint32_t value) const
+{
+    const uint32_t networkValue = htonl(value);
+    return send(&networkValue, sizeof(networkValue));
+}
+
+bool Socket::receive(void* data, size_t size) const
+{
+    char* bytes = static_cast<char*>(data);
+
+    while (size != 0u)
+    {
+#ifdef _WIN32
+        const auto received = ::recv(_handle, bytes, static_cast<int>(size), 0);
+#else
+        const auto received = ::recv(_handle, bytes, size, 0);
+#endif
+        if (received < 0 && interrupted())
+            continue;
+
+        // 0 byte received means the other end closed the connection
+        if (received <= 0)
+            return false;
+
+        bytes += received;
+        size -= static_cast<size_t>(received);
+    }
+
+    return true;
+}
+
+bool Socket::receive(uint32_t& value) const
+{
+    uint32_t networkValue = 0u;
+    if (!receive(&networkValue, sizeof(networkValue)))
+        return false;
+
+    value = ntohl(networkValue);
+    return true;
+}
+
+bool Socket::isValid(void) const noexcept
+{
+    return _handle != _invalidHandle;
+}
+
+const string& Socket::peer(void) const noexcept
+{
+    return _peer;
+}
+
+void Socket::close(void) noexcept
+{
+    if (_handle == _invalidHandle)
+        return;
+
+    closeHandle(_handle);
+    _handle = _invalidHandle;
+}
+
+void Socket::_startup(void)
+{
+#ifdef _WIN32
+    static const bool started = []() {
+        WSADATA data;
+        if (WSAStartup(MAKEWORD(2, 2), &data) != 0)
+            throw runtime_error("Unable to use the sockets of the system");
+
+        return true;
+    }();
+
+    (void)started;
+#endif
+}
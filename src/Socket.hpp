@@ -0,0 +1,103 @@
+//===============================================================================================//
+/*!
+ *  \file      Socket.hpp
+ *  \author    Loïc Corenthy
+ *  \version   1.2
+ *  \date      19/10/2026
+ *  \copyright (c) 2026 Loïc Corenthy. All rights reserved.
+ */
+//===============================================================================================//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace LCNS
+{
+    /// TCP connection (or listening socket) between the coordinator and the workers of a distributed render. The socket is closed when it is
+    /// destroyed. The integers are sent in network byte order, a failed send or receive means the connection is lost.
+    class Socket
+    {
+    public:
+        /// Default constructor, the socket is not connected
+        Socket(void) = default;
+
+        /// Copy constructor (copy not allowed)
+        Socket(const Socket& socket) = delete;
+
+        /// Move constructor, the other socket is not connected anymore
+        Socket(Socket&& socket) noexcept;
+
+        /// Copy operator (copy not allowed)
+        Socket& operator=(const Socket& socket) = delete;
+
+        /// Move operator, closes the current connection and takes the one of the other socket
+        Socket& operator=(Socket&& socket) noexcept;
+
+        /// Destructor, closes the connection
+        ~Socket(void);
+
+        /// Listen to the connections on a port of all the network interfaces, throws a runtime error if the port can not be used
+        static Socket listen(unsigned short port);
+
+        /// Connect to a port of a host (name or address), throws a runtime error if the connection fails
+        static Socket connect(const std::string& host, unsigned short port);
+
+        /// Wait until at least one of the sockets has data to receive, a new connection to accept or has been closed, and get their indices
+        static std::vector<std::size_t> waitReadable(const std::vector<const Socket*>& sockets);
+
+        /// Accept a connection on a listening socket (the socket is not valid if it failed)
+        Socket accept(void) const;
+
+        /// Fail the receives that wait for more than a number of seconds (0 to wait forever)
+        void receiveTimeout(unsigned int seconds);
+
+        /// Send bytes, return false if the connection is lost
+        bool send(const void* data, std::size_t size) const;
+
+        /// Send an integer, return false if the connection is lost
+        bool send(std::uint32_t value) const;
+
+        /// Receive bytes (wait until all of them arrived), return false if the connection is lost or closed
+        bool receive(void* data, std::size_t size) const;
+
+        /// Receive an integer, return false if the connection is lost or closed
+        bool receive(std::uint32_t& value) const;
+
+        /// Check if the socket is connected (or listening)
+        bool isValid(void) const noexcept;
+
+        /// Get the address of the other end of the connection
+        const std::string& peer(void) const noexcept;
+
+        /// Close the connection
+        void close(void) noexcept;
+
+    private:
+#ifdef _WIN32
+        using Handle = std::uintptr_t;
+
+        static constexpr Handle _invalidHandle = ~Handle{ 0u };
+#else
+        using Handle = int;
+
+        static constexpr Handle _invalidHandle = -1;
+#endif
+
+    private:
+        /// Constructor with the handle of a connection
+        Socket(Handle handle, const std::string& peer);
+
+        /// Use the sockets of the system (only needed on Windows)
+        static void _startup(void);
+
+    private:
+        Handle      _handle = _invalidHandle;
+        std::string _peer;
+
+    };  // class Socket
+
+}  // namespace LCNS
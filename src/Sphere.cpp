@@ -18,23 +18,28 @@
 #include "Ray.hpp"
 #include "Renderable.hpp"
 #include "Shader.hpp"
+#include "Statistics.hpp"
+#include "Transform.hpp"
 
 using std::get;
 using std::make_shared;
 using std::make_tuple;
-using std::mutex;
 using std::nullopt;
 using std::optional;
-using std::scoped_lock;
 using std::tuple;
 
 using LCNS::Color;
+using LCNS::intersectionEpsilon;
 using LCNS::Ray;
+using LCNS::Real;
 using LCNS::Renderable;
 using LCNS::Sphere;
+using LCNS::Statistics;
+using LCNS::toReal;
+using LCNS::Transform;
 using LCNS::Vector;
 
-Sphere::Sphere(const Point& point, double radius)
+Sphere::Sphere(const Point& point, Real radius)
 : _center(point)
 , _radius(radius)
 {
@@ -48,12 +53,14 @@ Sphere::Sphere(const Sphere& sphere)
 
 bool Sphere::intersect(Ray& ray)
 {
-    const double a = ray.direction()[0] * ray.direction()[0] + ray.direction()[1] * ray.direction()[1] + ray.direction()[2] * ray.direction()[2];
-    const double b = 2.0
-                     * (ray.direction()[0] * (ray.origin()[0] - _center[0]) + ray.direction()[1] * (ray.origin()[1] - _center[1])
-                        + ray.direction()[2] * (ray.origin()[2] - _center[2]));
-    const double c = (ray.origin()[0] - _center[0]) * (ray.origin()[0] - _center[0]) + (ray.origin()[1] - _center[1]) * (ray.origin()[1] - _center[1])
-                     + (ray.origin()[2] - _center[2]) * (ray.origin()[2] - _center[2]) - _radius * _radius;
+    Statistics::count(Statistics::Counter::SPHERE_TESTS);
+
+    const Real a = ray.direction()[0] * ray.direction()[0] + ray.direction()[1] * ray.direction()[1] + ray.direction()[2] * ray.direction()[2];
+    const Real b = Real{ 2.0 }
+                   * (ray.direction()[0] * (ray.origin()[0] - _center[0]) + ray.direction()[1] * (ray.origin()[1] - _center[1])
+                      + ray.direction()[2] * (ray.origin()[2] - _center[2]));
+    const Real c = (ray.origin()[0] - _center[0]) * (ray.origin()[0] - _center[0]) + (ray.origin()[1] - _center[1]) * (ray.origin()[1] - _center[1])
+                   + (ray.origin()[2] - _center[2]) * (ray.origin()[2] - _center[2]) - _radius * _radius;
 
     const auto roots = _solveSecDeg(a, b, c);
 
@@ -62,13 +69,14 @@ bool Sphere::intersect(Ray& ray)
 
     auto [root1, root2] = roots.value();
 
-    if (root1 > 0.0 && root2 > 0.0)
+    // Hits closer than the epsilon are rounding errors of a ray leaving the sphere
+    if (root1 > intersectionEpsilon && root2 > intersectionEpsilon)
     {
         ray.length((root1 < root2) ? root1 : root2);
         ray.intersected(this);
         return true;
     }
-    else if ((root1 > 0.0 && root2 <= 0.0) || (root2 > 0.0 && root1 <= 0.0))
+    else if ((root1 > intersectionEpsilon && root2 <= intersectionEpsilon) || (root2 > intersectionEpsilon && root1 <= intersectionEpsilon))
     {
         ray.length((root1 > root2) ? root1 : root2);
         ray.intersected(this);
@@ -87,6 +95,14 @@ Color Sphere::color(const Ray& ray, unsigned int reflectionCount)
     return _shader->color(ray.direction() * (-1), normalAtPt, ray.intersection(), this, reflectionCount);
 }
 
+Color Sphere::color(const Ray& ray, const Color* lightIntensities, unsigned int reflectionCount)
+{
+    Vector normalAtPt = (ray.intersection() - _center);
+    normalAtPt.normalize();
+
+    return _shader->color(ray.direction() * (-1), normalAtPt, ray.intersection(), lightIntensities, reflectionCount);
+}
+
 optional<Ray> Sphere::refractedRay(const Ray& incomingRay)
 {
     Vector incomingDirection = incomingRay.direction();
@@ -101,7 +117,7 @@ optional<Ray> Sphere::refractedRay(const Ray& incomingRay)
 
     if (firstRefraction)
     {
-        Ray insideSphere(incomingRay.intersection() + refractedDirection * 0.1, refractedDirection);
+        Ray insideSphere(incomingRay.intersection().offset(refractedDirection, toReal(0.1)), refractedDirection);
 
         bool getOut = this->intersect(insideSphere);
         assert(getOut && "Intersection not found inside the sphere");
@@ -137,25 +153,24 @@ Vector Sphere::interpolatedNormal(const Point& position) const
     return ((position - _center).normalize());
 }
 
-optional<tuple<double, double>> Sphere::_solveSecDeg(double a, double b, double c) const
+optional<tuple<Real, Real>> Sphere::_solveSecDeg(Real a, Real b, Real c) const
 {
-    if (a == 0.0)
+    if (a == Real{ 0.0 })
         return nullopt;
 
-    auto delta = b * b - 4.0 * a * c;
+    const Real delta = b * b - Real{ 4.0 } * a * c;
 
-    if (delta < 0.0)
-    {
+    if (delta < Real{ 0.0 })
         return nullopt;
-    }
-    else if (delta == 0.0)
-    {
-        return make_tuple(-b / (2.0 * a), -b / (2.0 * a));
-    }
-    else
-    {
-        return make_tuple((-b - sqrt(delta)) / (2.0 * a), (-b + sqrt(delta)) / (2.0 * a));
-    }
+
+    // The root where -b and the square root of delta have the same sign is computed first, the other one comes from the product of the roots
+    // (c / a). This avoids subtracting two close values, which loses most of the digits of a float when the ray is far from the sphere.
+    const Real q = Real{ -0.5 } * (b + std::copysign(std::sqrt(delta), b));
+
+    if (q == Real{ 0.0 })
+        return make_tuple(q, q);
+
+    return make_tuple(q / a, c / q);
 }
 
 const LCNS::Point& Sphere::center(void) const noexcept
@@ -168,12 +183,17 @@ void Sphere::center(const LCNS::Point& point) noexcept
     _center = point;
 }
 
-double Sphere::radius(void) const noexcept
+Real Sphere::radius(void) const noexcept
 {
     return _radius;
 }
 
-void Sphere::radius(double value) noexcept
+void Sphere::radius(Real value) noexcept
 {
     _radius = value;
 }
+
+void Sphere::transform(const Transform& transform)
+{
+    _center = transform.apply(_center);
+}
@@ -23,14 +23,14 @@
 
 namespace LCNS
 {
-    class Sphere : public Renderable
+    class Sphere final : public Renderable
     {
     public:
         /// Default Constructor
         Sphere(void) = default;
 
         /// Constructor with parameters
-        Sphere(const Point& point, double radius);
+        Sphere(const Point& point, Real radius);
 
         /// Copy constructor
         Sphere(const Sphere& sphere);
@@ -47,6 +47,9 @@ namespace LCNS
         /// Virtual function, get the color at the intersection point
         Color color(const Ray& ray, unsigned int type = 0) override;
 
+        /// Virtual function, get the color at the intersection point from the intensities of the lights
+        Color color(const Ray& ray, const Color* lightIntensities, unsigned int reflectionCount) override;
+
         /// Virtual function, get the normal at the intersection point
         Vector normal(const Point& position) const override;
 
@@ -56,6 +59,9 @@ namespace LCNS
         /// Virtual function from Renderable
         std::optional<Ray> refractedRay(const Ray& incomingRay) override;
 
+        /// Virtual function from Renderable, the radius does not change
+        void transform(const Transform& transform) override;
+
         /// Get the center of the sphere (read only)
         const LCNS::Point& center(void) const noexcept;
 
@@ -63,18 +69,18 @@ namespace LCNS
         void center(const LCNS::Point& point) noexcept;
 
         /// Get the radius of the sphere (read only)
-        double radius(void) const noexcept;
+        Real radius(void) const noexcept;
 
         /// Set the radius of the sphere
-        void radius(double value) noexcept;
+        void radius(Real value) noexcept;
 
     private:
         /// Calculate roots of a second order polynomial.
-        std::optional<std::tuple<double, double>> _solveSecDeg(double a, double b, double c) const;
+        std::optional<std::tuple<Real, Real>> _solveSecDeg(Real a, Real b, Real c) const;
 
     private:
         Point  _center;
-        double _radius = 0.0f;
+        Real _radius = 0.0f;
 
     };  // class Sphere
 
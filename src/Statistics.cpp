@@ -0,0 +1,86 @@
+//===============================================================================================//
+/*!
+ *  \file      Statistics.cpp
+ *  \author    Loïc Corenthy
+ *  \version   1.2
+ *  \date      19/10/2026
+ *  \copyright (c) 2026 Loïc Corenthy. All rights reserved.
+ */
+//===============================================================================================//
+
+#include "Statistics.hpp"
+
+#include <atomic>
+
+using std::atomic;
+using std::memory_order_relaxed;
+using std::size_t;
+using std::uint64_t;
+
+using LCNS::Statistics;
+
+namespace
+{
+    constexpr size_t counterCount = static_cast<size_t>(Statistics::Counter::COUNT);
+
+    atomic<uint64_t> globalCounts[counterCount] = {};
+
+    /// Counters of a thread, added to the global ones when the thread ends
+    struct ThreadCounts
+    {
+        ~ThreadCounts(void)
+        {
+            for (size_t i = 0; i < counterCount; ++i)
+                globalCounts[i].fetch_add(counts[i], memory_order_relaxed);
+        }
+
+        std::array<uint64_t, counterCount> counts = {};
+    };
+
+    thread_local ThreadCounts threadCounts;
+
+}  // namespace
+
+Statistics Statistics::merged(void) noexcept
+{
+    Statistics result;
+
+    for (size_t i = 0; i < counterCount; ++i)
+        result._counts[i] = globalCounts[i].load(memory_order_relaxed) + threadCounts.counts[i];
+
+    return result;
+}
+
+uint64_t Statistics::threadCount(Counter counter) noexcept
+{
+    return threadCounts.counts[static_cast<size_t>(counter)];
+}
+
+void Statistics::reset(void) noexcept
+{
+    for (size_t i = 0; i < counterCount; ++i)
+    {
+        globalCounts[i].store(0u, memory_order_relaxed);
+        threadCounts.counts[i] = 0u;
+    }
+}
+
+uint64_t Statistics::operator[](Counter counter) const noexcept
+{
+    return _counts[static_cast<size_t>(counter)];
+}
+
+double Statistics::averageReflectionDepth(void) const noexcept
+{
+    const auto reflectionRays = (*this)[Counter::REFLECTION_RAYS];
+
+    if (reflectionRays == 0u)
+        return 0.0;
+
+    return static_cast<double>((*this)[Counter::REFLECTION_DEPTH]) / static_cast<double>(reflectionRays);
+}
+
+Statistics::Counts& Statistics::_threadCounts(void) noexcept
+{
+    return threadCounts.counts;
+}
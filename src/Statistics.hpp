@@ -0,0 +1,88 @@
+//===============================================================================================//
+/*!
+ *  \file      Statistics.hpp
+ *  \author    Loïc Corenthy
+ *  \version   1.2
+ *  \date      19/10/2026
+ *  \copyright (c) 2026 Loïc Corenthy. All rights reserved.
+ */
+//===============================================================================================//
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace LCNS
+{
+    /// Counters of the rays, of the shadow cache and of the intersection tests of a render. Each thread increments its own counters, they are added to the global
+    /// ones when the thread ends. The counters are only compiled when RAY_TRACING_STATISTICS is defined (ENABLE_STATISTICS option of CMake),
+    /// otherwise count() does nothing and costs nothing.
+    class Statistics
+    {
+    public:
+        enum class Counter : unsigned int
+        {
+            PRIMARY_RAYS,
+            SCENE_RAYS,
+            SHADOW_RAYS,
+            SHADOW_CACHE_HITS,
+            SHADOW_CACHE_MISSES,
+            REFLECTION_RAYS,
+            REFRACTION_RAYS,
+            BOX_TESTS,
+            TRIANGLE_TESTS,
+            SPHERE_TESTS,
+            HITS,
+            REFLECTION_DEPTH,
+            STOPPED_REFLECTIONS,
+            COUNT
+        };
+
+#ifdef RAY_TRACING_STATISTICS
+        static constexpr bool enabled = true;
+#else
+        static constexpr bool enabled = false;
+#endif
+
+    public:
+        /// Default constructor, all the counters are 0
+        Statistics(void) = default;
+
+        /// Add a value to a counter of the calling thread
+        static void count(Counter counter, std::uint64_t value = 1u) noexcept;
+
+        /// Get the counters of the threads that ended and of the calling thread
+        static Statistics merged(void) noexcept;
+
+        /// Get the value of a counter of the calling thread only
+        static std::uint64_t threadCount(Counter counter) noexcept;
+
+        /// Set the counters of the threads that ended and of the calling thread to 0
+        static void reset(void) noexcept;
+
+        /// Get the value of a counter
+        std::uint64_t operator[](Counter counter) const noexcept;
+
+        /// Get the average depth of the reflection rays (the first reflection has a depth of 1)
+        double averageReflectionDepth(void) const noexcept;
+
+    private:
+        using Counts = std::array<std::uint64_t, static_cast<std::size_t>(Counter::COUNT)>;
+
+        /// Get the counters of the calling thread
+        static Counts& _threadCounts(void) noexcept;
+
+    private:
+        Counts _counts = {};
+
+    };  // class Statistics
+
+    inline void Statistics::count([[maybe_unused]] Counter counter, [[maybe_unused]] std::uint64_t value) noexcept
+    {
+        if constexpr (enabled)
+            _threadCounts()[static_cast<std::size_t>(counter)] += value;
+    }
+
+}  // namespace LCNS
@@ -0,0 +1,386 @@
+//===============================================================================================//
+/*!
+ *  \file      TextureCache.cpp
+ *  \author    Loïc Corenthy
+ *  \version   1.2
+ *  \date      19/10/2026
+ *  \copyright (c) 2026 Loïc Corenthy. All rights reserved.
+ */
+//===============================================================================================//
+
+#include "TextureCache.hpp"
+#include "Trace.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <stdexcept>
+#include <utility>
+
+#include <OpenImageIO/imageio.h>
+#include <OpenImageIO/typedesc.h>
+
+using std::array;
+using std::make_shared;
+using std::make_unique;
+using std::min;
+using std::move;
+using std::mutex;
+using std::nullopt;
+using std::optional;
+using std::runtime_error;
+using std::scoped_lock;
+using std::shared_ptr;
+using std::size_t;
+using std::string;
+using std::to_string;
+using std::uint64_t;
+using std::unique_ptr;
+
+using LCNS::TextureCache;
+using LCNS::TraceScope;
+
+using OIIO::ImageInput;
+using OIIO::ImageSpec;
+using OIIO::TypeDesc;
+
+struct TextureCache::Decoder
+{
+    mutex                  access;  ///< Only one thread at a time reads the file
+    unique_ptr<ImageInput> input;
+    unsigned int           nextRow = 0u;
+};
+
+namespace
+{
+    /// Small per thread cache in front of the shared one, it avoids locking the mutex for consecutive lookups in the same tiles. A tile referenced
+    /// here stays alive even if it has been evicted from the shared cache.
+    struct RecentTiles
+    {
+        struct Entry
+        {
+            unsigned int                         textureId = 0u;
+            shared_ptr<const TextureCache::Tile> tile;
+        };
+
+        array<Entry, 4> entries;
+        unsigned int    next = 0u;
+    };
+
+    thread_local RecentTiles recentTiles;
+}  // namespace
+
+optional<TextureCache::TextureInfo> TextureCache::open(const string& path)
+{
+    return _instance()._open(path);
+}
+
+const TextureCache::Tile& TextureCache::tile(unsigned int textureId, unsigned int row)
+{
+    for (const auto& entry : recentTiles.entries)
+    {
+        if (entry.tile && entry.textureId == textureId && entry.tile->firstRow <= row && row < entry.tile->firstRow + entry.tile->rowCount)
+            return *entry.tile;
+    }
+
+    auto& slot     = recentTiles.entries[recentTiles.next];
+    slot.textureId = textureId;
+    slot.tile      = _instance()._tile(textureId, row);
+
+    recentTiles.next = (recentTiles.next + 1u) % static_cast<unsigned int>(recentTiles.entries.size());
+
+    return *slot.tile;
+}
+
+void TextureCache::unregister(unsigned int textureId)
+{
+    _instance()._unregister(textureId);
+}
+
+void TextureCache::prefetch(unsigned int textureId)
+{
+    _instance()._prefetch(textureId);
+}
+
+void TextureCache::memoryBudget(size_t bytes)
+{
+    auto& cache = _instance();
+
+    scoped_lock lock(cache._mutex);
+    cache._memoryBudget = bytes;
+    cache._evict();
+}
+
+size_t TextureCache::memoryBudget(void)
+{
+    auto& cache = _instance();
+
+    scoped_lock lock(cache._mutex);
+    return cache._memoryBudget;
+}
+
+size_t TextureCache::memoryUsage(void)
+{
+    auto& cache = _instance();
+
+    scoped_lock lock(cache._mutex);
+    return cache._memoryUsage;
+}
+
+void TextureCache::rowsPerTile(unsigned int rowCount)
+{
+    assert(rowCount > 0 && "A tile must contain at least one row");
+
+    auto& cache = _instance();
+
+    scoped_lock lock(cache._mutex);
+    cache._rowsPerTile = rowCount;
+}
+
+void TextureCache::clear(void)
+{
+    auto& cache = _instance();
+
+    scoped_lock lock(cache._mutex);
+    cache._tiles.clear();
+    cache._lruKeys.clear();
+    cache._memoryUsage = 0u;
+}
+
+TextureCache& TextureCache::_instance(void)
+{
+    static TextureCache instance;
+    return instance;
+}
+
+optional<TextureCache::TextureInfo> TextureCache::_open(const string& path)
+{
+    auto image = ImageInput::open(path);
+
+    if (!image)
+        return nullopt;
+
+    const ImageSpec& spec = image->spec();
+
+    TextureEntry entry;
+    entry.path          = path;
+    entry.width         = static_cast<unsigned int>(spec.width);
+    entry.height        = static_cast<unsigned int>(spec.height);
+    entry.bytesPerPixel = static_cast<unsigned int>(spec.nchannels);
+
+    // The file stays open for the first tiles to be decoded
+    entry.decoder        = make_shared<Decoder>();
+    entry.decoder->input = move(image);
+
+    scoped_lock lock(_mutex);
+
+    entry.rowsPerTile = _rowsPerTile;
+
+    // The ids are not reused, the tiles kept by the threads (see RecentTiles) are found by id
+    TextureInfo info;
+    info.id            = _nextTextureId++;
+    info.width         = entry.width;
+    info.height        = entry.height;
+    info.bytesPerPixel = entry.bytesPerPixel;
+
+    _textures.emplace(info.id, move(entry));
+
+    return info;
+}
+
+void TextureCache::_unregister(unsigned int textureId)
+{
+    scoped_lock lock(_mutex);
+
+    const auto texture = _textures.find(textureId);
+    if (texture == _textures.end())
+        return;
+
+    const auto& entry     = texture->second;
+    const auto  tileCount = (entry.height + entry.rowsPerTile - 1u) / entry.rowsPerTile;
+
+    for (unsigned int tileIndex = 0u; tileIndex < tileCount; ++tileIndex)
+    {
+        if (const auto it = _tiles.find(_key(textureId, tileIndex)); it != _tiles.end())
+        {
+            _memoryUsage -= static_cast<size_t>(it->second.tile->bytesPerRow) * it->second.tile->rowCount;
+            _lruKeys.erase(it->second.lruPosition);
+            _tiles.erase(it);
+        }
+    }
+
+    // The decoder closes the file once no thread decodes the image anymore
+    _textures.erase(texture);
+}
+
+shared_ptr<const TextureCache::Tile> TextureCache::_tile(unsigned int textureId, unsigned int row)
+{
+    TextureEntry texture;
+    unsigned int tileIndex = 0u;
+
+    {
+        scoped_lock lock(_mutex);
+
+        const auto entry = _textures.find(textureId);
+        assert(entry != _textures.end() && "Unknown texture");
+        texture   = entry->second;
+        tileIndex = row / texture.rowsPerTile;
+
+        if (auto tile = _find(_key(textureId, tileIndex)))
+            return tile;
+    }
+
+    // Decode without holding the lock so that the other threads can keep on reading the tiles already in the cache
+    return _decodeTile(textureId, texture, tileIndex);
+}
+
+void TextureCache::_prefetch(unsigned int textureId)
+{
+    TextureEntry texture;
+
+    {
+        scoped_lock lock(_mutex);
+
+        const auto entry = _textures.find(textureId);
+        assert(entry != _textures.end() && "Unknown texture");
+        texture = entry->second;
+    }
+
+    const size_t tileBytes = static_cast<size_t>(texture.width) * texture.bytesPerPixel * texture.rowsPerTile;
+
+    for (unsigned int row = 0u; row < texture.height; row += texture.rowsPerTile)
+    {
+        // Do not push out of the cache tiles that have been loaded before
+        if (memoryUsage() + tileBytes > memoryBudget())
+            break;
+
+        _tile(textureId, row);
+    }
+}
+
+shared_ptr<const TextureCache::Tile> TextureCache::_decodeTile(unsigned int textureId, const TextureEntry& texture, unsigned int tileIndex)
+{
+    auto&       decoder = *texture.decoder;
+    scoped_lock decoderLock(decoder.access);
+
+    const auto key = _key(textureId, tileIndex);
+
+    // Another thread may have decoded the tile while this one was waiting for the file
+    {
+        scoped_lock lock(_mutex);
+
+        if (auto tile = _find(key))
+            return tile;
+    }
+
+    TraceScope traceScope("TextureCache::decodeTile", "texture", "tile", tileIndex);
+
+    // The files are decoded from the top, the rows above the next one can only be decoded again from the beginning of the file
+    const unsigned int firstRow = tileIndex * texture.rowsPerTile;
+    if (!decoder.input || firstRow < decoder.nextRow)
+    {
+        decoder.input   = ImageInput::open(texture.path);
+        decoder.nextRow = 0u;
+
+        if (!decoder.input)
+            throw runtime_error("Cannot open the image " + texture.path);
+    }
+
+    const size_t tileBytes = static_cast<size_t>(texture.width) * texture.bytesPerPixel * texture.rowsPerTile;
+
+    shared_ptr<const Tile> requestedTile;
+    while (!requestedTile)
+    {
+        auto tile = make_shared<Tile>();
+
+        tile->firstRow    = decoder.nextRow;
+        tile->rowCount    = min(texture.rowsPerTile, texture.height - tile->firstRow);
+        tile->bytesPerRow = texture.width * texture.bytesPerPixel;
+        tile->pixels      = make_unique<unsigned char[]>(static_cast<size_t>(tile->bytesPerRow) * tile->rowCount);
+
+        // Subimage 0, MIP level 0, depth 0 and all the channels of the rows of the tile, one byte per channel
+        const bool decoded = decoder.input->read_scanlines(0,
+                                                           0,
+                                                           static_cast<int>(tile->firstRow),
+                                                           static_cast<int>(tile->firstRow + tile->rowCount),
+                                                           0,
+                                                           0,
+                                                           static_cast<int>(texture.bytesPerPixel),
+                                                           TypeDesc::UINT8,
+                                                           tile->pixels.get());
+        if (!decoded)
+        {
+            const string error = decoder.input->geterror();
+            decoder.input.reset();
+
+            throw runtime_error("Cannot decode the rows " + to_string(tile->firstRow) + " to " + to_string(tile->firstRow + tile->rowCount - 1u)
+                                + " of the image " + texture.path + ": " + error);
+        }
+
+        decoder.nextRow += tile->rowCount;
+
+        // The file is closed once all its rows are decoded
+        if (decoder.nextRow == texture.height)
+        {
+            decoder.input->close();
+            decoder.input.reset();
+        }
+
+        const auto tileKey = _key(textureId, tile->firstRow / texture.rowsPerTile);
+
+        scoped_lock lock(_mutex);
+
+        if (tileKey == key)
+            requestedTile = _insert(key, move(tile));
+        else if (_memoryUsage + tileBytes <= _memoryBudget)
+            _insert(tileKey, move(tile));
+    }
+
+    return requestedTile;
+}
+
+shared_ptr<const TextureCache::Tile> TextureCache::_find(uint64_t key)
+{
+    auto it = _tiles.find(key);
+    if (it == _tiles.end())
+        return nullptr;
+
+    // Move the tile at the front of the least recently used list
+    _lruKeys.splice(_lruKeys.begin(), _lruKeys, it->second.lruPosition);
+    return it->second.tile;
+}
+
+shared_ptr<const TextureCache::Tile> TextureCache::_insert(uint64_t key, shared_ptr<const Tile> tile)
+{
+    if (auto it = _tiles.find(key); it != _tiles.end())
+        return it->second.tile;
+
+    _lruKeys.push_front(key);
+    _tiles.emplace(key, CachedTile{ tile, _lruKeys.begin() });
+    _memoryUsage += static_cast<size_t>(tile->bytesPerRow) * tile->rowCount;
+
+    _evict();
+
+    return tile;
+}
+
+void TextureCache::_evict(void)
+{
+    // Always keep the most recently used tile, it is the one that has just been requested
+    while (_memoryUsage > _memoryBudget && _lruKeys.size() > 1)
+    {
+        const auto key = _lruKeys.back();
+        _lruKeys.pop_back();
+
+        auto it = _tiles.find(key);
+        assert(it != _tiles.end() && "Tile in the least recently used list but not in the cache");
+
+        _memoryUsage -= static_cast<size_t>(it->second.tile->bytesPerRow) * it->second.tile->rowCount;
+        _tiles.erase(it);
+    }
+}
+
+uint64_t TextureCache::_key(unsigned int textureId, unsigned int tileIndex) noexcept
+{
+    return (static_cast<uint64_t>(textureId) << 32u) | static_cast<uint64_t>(tileIndex);
+}
@@ -0,0 +1,155 @@
+//===============================================================================================//
+/*!
+ *  \file      TextureCache.hpp
+ *  \author    Loïc Corenthy
+ *  \version   1.2
+ *  \date      19/10/2026
+ *  \copyright (c) 2026 Loïc Corenthy. All rights reserved.
+ */
+//===============================================================================================//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+namespace LCNS
+{
+    /// Texture cache shared by all the images. The pixels of an image are split in tiles of consecutive rows which are only decoded the first time
+    /// they are accessed. When the memory used by the decoded tiles exceeds the budget, the least recently used tiles are evicted. Each image
+    /// keeps its file open and decodes its rows from the top, the tiles decoded on the way to the one requested are kept in the cache as long
+    /// as they fit in the budget, so that an image is decoded once unless its tiles are evicted.
+    class TextureCache
+    {
+    public:
+        /// Description of an image registered in the cache
+        struct TextureInfo
+        {
+            unsigned int id            = 0u;
+            unsigned int width         = 0u;
+            unsigned int height        = 0u;
+            unsigned int bytesPerPixel = 0u;
+        };
+
+        /// Block of decoded rows of an image, in the RGBA8888 (or less channels) pixel format
+        struct Tile
+        {
+            std::unique_ptr<unsigned char[]> pixels;
+            unsigned int                     firstRow    = 0u;
+            unsigned int                     rowCount    = 0u;
+            unsigned int                     bytesPerRow = 0u;
+        };
+
+    public:
+        /// Copy constructor (copy not allowed)
+        TextureCache(const TextureCache& textureCache) = delete;
+
+        /// Copy operator (copy not allowed)
+        TextureCache operator=(const TextureCache& textureCache) = delete;
+
+        /// Destructor
+        ~TextureCache(void) = default;
+
+        /// Register an image file in the cache, only the header of the file is read. The ids are never reused.
+        static std::optional<TextureInfo> open(const std::string& path);
+
+        /// Remove an image from the cache, its tiles are discarded and its file is closed. Its tiles must not be requested afterwards.
+        static void unregister(unsigned int textureId);
+
+        /// Get the tile containing a row of a registered image, decode it if it is not in the cache (thread safe). The reference stays valid
+        /// until the next call to this function from the same thread. Throws if the image cannot be decoded.
+        static const Tile& tile(unsigned int textureId, unsigned int row);
+
+        /// Load all the tiles of an image that are not in the cache yet (within the memory budget), throws if the image cannot be decoded
+        static void prefetch(unsigned int textureId);
+
+        /// Set the maximum amount of memory used by the decoded tiles (in bytes)
+        static void memoryBudget(std::size_t bytes);
+
+        /// Get the maximum amount of memory used by the decoded tiles (in bytes)
+        static std::size_t memoryBudget(void);
+
+        /// Get the amount of memory currently used by the decoded tiles (in bytes)
+        static std::size_t memoryUsage(void);
+
+        /// Set the number of image rows in a tile (only affects the images registered afterwards)
+        static void rowsPerTile(unsigned int rowCount);
+
+        /// Remove all the tiles from the cache
+        static void clear(void);
+
+    private:
+        /// Open file of an image with the next row it decodes (defined with the image reader)
+        struct Decoder;
+
+        /// Internal data kept for each registered image
+        struct TextureEntry
+        {
+            std::string              path;
+            std::shared_ptr<Decoder> decoder;
+            unsigned int             width         = 0u;
+            unsigned int             height        = 0u;
+            unsigned int             bytesPerPixel = 0u;
+            unsigned int             rowsPerTile   = 0u;
+        };
+
+        /// Internal data kept for each decoded tile
+        struct CachedTile
+        {
+            std::shared_ptr<const Tile>        tile;
+            std::list<std::uint64_t>::iterator lruPosition;
+        };
+
+    private:
+        /// Default constructor
+        TextureCache(void) = default;
+
+        /// Get a reference on the instance
+        static TextureCache& _instance(void);
+
+        /// Internal method to register an image file
+        std::optional<TextureInfo> _open(const std::string& path);
+
+        /// Internal method to remove an image from the cache
+        void _unregister(unsigned int textureId);
+
+        /// Internal method to get the tile containing a row of an image
+        std::shared_ptr<const Tile> _tile(unsigned int textureId, unsigned int row);
+
+        /// Internal method to load all the tiles of an image
+        void _prefetch(unsigned int textureId);
+
+        /// Decode the rows of the image file up to a tile, the tiles decoded before it are added to the cache if they fit in the budget
+        std::shared_ptr<const Tile> _decodeTile(unsigned int textureId, const TextureEntry& texture, unsigned int tileIndex);
+
+        /// Find a tile in the cache and mark it as the most recently used one (the mutex must be locked)
+        std::shared_ptr<const Tile> _find(std::uint64_t key);
+
+        /// Add a decoded tile to the cache, or get the one already in it (the mutex must be locked)
+        std::shared_ptr<const Tile> _insert(std::uint64_t key, std::shared_ptr<const Tile> tile);
+
+        /// Evict least recently used tiles until the memory used is below the budget (the mutex must be locked)
+        void _evict(void);
+
+        /// Build the key used to identify a tile in the cache
+        static std::uint64_t _key(unsigned int textureId, unsigned int tileIndex) noexcept;
+
+    private:
+        mutable std::mutex                            _mutex;
+        std::unordered_map<unsigned int, TextureEntry> _textures;
+        unsigned int                                   _nextTextureId = 0u;
+        std::unordered_map<std::uint64_t, CachedTile>  _tiles;
+        std::list<std::uint64_t>                       _lruKeys;
+        std::size_t                                    _memoryBudget  = 256u * 1024u * 1024u;
+        std::size_t                                    _memoryUsage   = 0u;
+        unsigned int                                   _rowsPerTile   = 64u;
+
+    };  // class TextureCache
+
+}  // namespace LCNS
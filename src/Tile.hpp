@@ -0,0 +1,43 @@
+//===============================================================================================//
+/*!
+ *  \file      Tile.hpp
+ *  \author    Loïc Corenthy
+ *  \version   1.2
+ *  \date      19/10/2026
+ *  \copyright (c) 2026 Loïc Corenthy. All rights reserved.
+ */
+//===============================================================================================//
+
+#pragma once
+
+namespace LCNS
+{
+    /// Rectangle of pixels of an image, x and y are the column and the row of its first pixel (the first row of a buffer is the bottom of the
+    /// image)
+    struct Tile
+    {
+        unsigned int x      = 0u;
+        unsigned int y      = 0u;
+        unsigned int width  = 0u;
+        unsigned int height = 0u;
+
+        /// Get the number of pixels of the tile
+        unsigned int pixelCount(void) const noexcept
+        {
+            return width * height;
+        }
+
+        /// Check if two tiles are the same rectangle
+        bool operator==(const Tile& tile) const noexcept
+        {
+            return x == tile.x && y == tile.y && width == tile.width && height == tile.height;
+        }
+
+        /// Check if two tiles are different rectangles
+        bool operator!=(const Tile& tile) const noexcept
+        {
+            return !(*this == tile);
+        }
+    };
+
+}  // namespace LCNS
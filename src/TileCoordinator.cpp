@@ -0,0 +1,288 @@
+//===============================================================================================//
+/*!
+ *  \file      TileCoordinator.cpp
+ *  \author    Loïc Corenthy
+ *  \version   1.2
+ *  \date      19/10/2026
+ *  \copyright (c) 2026 Loïc Corenthy. All rights reserved.
+ */
+//===============================================================================================//
+
+#include "TileCoordinator.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Checkpoint.hpp"
+#include "Trace.hpp"
+
+using std::cout;
+using std::deque;
+using std::endl;
+using std::flush;
+using std::make_unique;
+using std::min;
+using std::remove_if;
+using std::runtime_error;
+using std::size_t;
+using std::string;
+using std::uint32_t;
+using std::unique_ptr;
+using std::vector;
+using std::chrono::duration;
+using std::chrono::steady_clock;
+
+using LCNS::Buffer;
+using LCNS::Checkpoint;
+using LCNS::Socket;
+using LCNS::Tile;
+using LCNS::TileCoordinator;
+using LCNS::TraceScope;
+
+namespace
+{
+    /// Time (in seconds) a worker has to send the rest of a message once it started to send it
+    constexpr unsigned int messageTimeout = 60u;
+}  // namespace
+
+TileCoordinator::TileCoordinator(unsigned int width, unsigned int height, const Tile& window, unsigned int tileSize, const string& frame)
+: _buffer(height, width)
+, _frame(frame)
+{
+    if (window.pixelCount() == 0u || tileSize == 0u)
+    {
+        throw runtime_error("The image and its tiles cannot be empty");
+    }
+
+    if (window.x + window.width > width || window.y + window.height > height)
+    {
+        throw runtime_error("The window to render is not inside the image");
+    }
+
+    // The tiles on the right and at the top of the window are smaller if its dimensions are not multiples of the size of the tiles
+    const auto lastX = window.x + window.width;
+    const auto lastY = window.y + window.height;
+
+    for (unsigned int y = window.y; y < lastY; y += tileSize)
+    {
+        for (unsigned int x = window.x; x < lastX; x += tileSize)
+            _tiles.push_back(Tile{ x, y, min(tileSize, lastX - x), min(tileSize, lastY - y) });
+    }
+}
+
+void TileCoordinator::render(unsigned short port)
+{
+    TraceScope traceScope("TileCoordinator::render", "render", "tiles", _tiles.size());
+
+    deque<Tile>    pendingTiles;
+    vector<Worker> workers;
+    size_t         renderedCount = 0u;
+
+    // A resumed render only hands over the tiles that are not in the checkpoint
+    unique_ptr<Checkpoint> checkpoint;
+    auto                   lastCheckpoint = steady_clock::now();
+
+    if (!_checkpointFile.empty())
+    {
+        checkpoint = make_unique<Checkpoint>(_checkpointFile, _frame, _buffer.width(), _buffer.height());
+
+        if (_resumeCheckpoint && checkpoint->read(_buffer))
+        {
+            for (const auto& tile : _tiles)
+            {
+                if (checkpoint->isRendered(tile))
+                    ++renderedCount;
+            }
+
+            cout << "Resuming from " << _checkpointFile << ", " << renderedCount << " tiles out of " << _tiles.size() << " already rendered" << endl;
+        }
+    }
+
+    for (const auto& tile : _tiles)
+    {
+        if (!checkpoint || !checkpoint->isRendered(tile))
+            pendingTiles.push_back(tile);
+    }
+
+    const Socket listener = Socket::listen(port);
+    cout << "Waiting for workers on port " << port << " to render " << pendingTiles.size() << " tiles" << endl;
+
+    while (renderedCount < _tiles.size())
+    {
+        vector<const Socket*> sockets = { &listener };
+        for (const auto& worker : workers)
+            sockets.push_back(&worker.socket);
+
+        bool newConnection = false;
+
+        for (const auto index : Socket::waitReadable(sockets))
+        {
+            if (index == 0u)
+            {
+                newConnection = true;
+                continue;
+            }
+
+            auto& worker = workers[index - 1u];
+
+            if (!worker.accepted)
+            {
+                worker.accepted = _accept(worker);
+                if (!worker.accepted)
+                    worker.socket.close();
+            }
+            else if (_receive(worker))
+            {
+                ++renderedCount;
+                cout << "Tiles rendered " << renderedCount << " / " << _tiles.size() << '\r' << flush;
+
+                if (checkpoint)
+                {
+                    checkpoint->add(_buffer, worker.tile);
+
+                    if (steady_clock::now() - lastCheckpoint >= duration<double>(_checkpointPeriod))
+                    {
+                        if (!checkpoint->write())
+                            cout << "\nUnable to write the checkpoint " << _checkpointFile << endl;
+
+                        lastCheckpoint = steady_clock::now();
+                    }
+                }
+            }
+            else
+            {
+                // The tile of a worker that died is rendered again by another one
+                cout << "\nWorker " << worker.socket.peer() << " lost" << endl;
+
+                if (worker.busy)
+                    pendingTiles.push_front(worker.tile);
+
+                worker.socket.close();
+            }
+        }
+
+        if (newConnection)
+        {
+            Socket socket = listener.accept();
+            if (socket.isValid())
+            {
+                socket.receiveTimeout(messageTimeout);
+                workers.emplace_back().socket = std::move(socket);
+            }
+        }
+
+        // Each worker available gets the next tile
+        for (auto& worker : workers)
+        {
+            if (!worker.accepted || worker.busy || pendingTiles.empty())
+                continue;
+
+            if (_send(worker, Message::TILE, pendingTiles.front()))
+            {
+                worker.tile = pendingTiles.front();
+                worker.busy = true;
+                pendingTiles.pop_front();
+            }
+            else
+            {
+                cout << "\nWorker " << worker.socket.peer() << " lost" << endl;
+                worker.socket.close();
+            }
+        }
+
+        workers.erase(remove_if(workers.begin(), workers.end(), [](const Worker& worker) { return !worker.socket.isValid(); }), workers.end());
+    }
+
+    cout << "\nAll the tiles are rendered" << endl;
+
+    if (checkpoint && !checkpoint->write())
+        cout << "Unable to write the checkpoint " << _checkpointFile << endl;
+
+    for (const auto& worker : workers)
+    {
+        if (worker.accepted)
+            _send(worker, Message::DONE, Tile());
+    }
+}
+
+void TileCoordinator::checkpoint(const string& path, double period, bool resume)
+{
+    if (period <= 0.0)
+    {
+        throw runtime_error("The period of the checkpoints must be positive");
+    }
+
+    _checkpointFile   = path;
+    _checkpointPeriod = period;
+    _resumeCheckpoint = resume;
+}
+
+const Buffer& TileCoordinator::buffer(void) const noexcept
+{
+    return _buffer;
+}
+
+size_t TileCoordinator::tileCount(void) const noexcept
+{
+    return _tiles.size();
+}
+
+bool TileCoordinator::_accept(Worker& worker) const
+{
+    uint32_t magic       = 0u;
+    uint32_t version     = 0u;
+    uint32_t frameLength = 0u;
+
+    if (!worker.socket.receive(magic) || magic != magicNumber || !worker.socket.receive(version) || version != protocolVersion
+        || !worker.socket.receive(frameLength) || frameLength > maxFrameLength)
+    {
+        cout << "\nConnection from " << worker.socket.peer() << " ignored, it is not a worker of this version" << endl;
+        return false;
+    }
+
+    string frame(frameLength, '\0');
+    if (!worker.socket.receive(frame.data(), frame.size()))
+        return false;
+
+    if (frame != _frame)
+    {
+        cout << "\nWorker " << worker.socket.peer() << " rejected, it renders " << frame << " instead of " << _frame << endl;
+        _send(worker, Message::REJECTED, Tile());
+        return false;
+    }
+
+    cout << "\nWorker " << worker.socket.peer() << " joined" << endl;
+    return true;
+}
+
+bool TileCoordinator::_send(const Worker& worker, Message message, const Tile& tile) const
+{
+    return worker.socket.send(static_cast<uint32_t>(message)) && worker.socket.send(tile.x) && worker.socket.send(tile.y)
+           && worker.socket.send(tile.width) && worker.socket.send(tile.height);
+}
+
+bool TileCoordinator::_receive(Worker& worker)
+{
+    Tile tile;
+    if (!worker.socket.receive(tile.x) || !worker.socket.receive(tile.y) || !worker.socket.receive(tile.width)
+        || !worker.socket.receive(tile.height))
+        return false;
+
+    if (!worker.busy || tile != worker.tile)
+        return false;
+
+    _pixels.resize(3u * static_cast<size_t>(tile.pixelCount()));
+    if (!worker.socket.receive(_pixels.data(), _pixels.size()))
+        return false;
+
+    _buffer.writeTile(tile, _pixels.data());
+    worker.busy = false;
+
+    return true;
+}
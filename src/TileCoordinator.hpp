@@ -0,0 +1,112 @@
+//===============================================================================================//
+/*!
+ *  \file      TileCoordinator.hpp
+ *  \author    Loïc Corenthy
+ *  \version   1.2
+ *  \date      19/10/2026
+ *  \copyright (c) 2026 Loïc Corenthy. All rights reserved.
+ */
+//===============================================================================================//
+
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <vector>
+
+#include "Buffer.hpp"
+#include "Socket.hpp"
+#include "Tile.hpp"
+
+namespace LCNS
+{
+    /// Coordinator of a render distributed over worker processes (TileWorker), on this machine or on others. It owns the buffer of the image,
+    /// splits it in tiles and hands them over TCP connections to the workers, one tile at a time, as they connect and send back the pixels of
+    /// their previous tile. The tiles of a worker whose connection is lost are given to the next worker available.
+    ///
+    /// A worker starts by sending the magic number, the version of the protocol and the description of the frame it renders (the scene, the
+    /// dimensions and the options changing the pixels), the coordinator rejects the workers rendering another frame. Each message sent to a
+    /// worker is its type followed by a tile (x, y, width and height), the worker answers a TILE message with the tile and its pixels (3 bytes
+    /// per pixel, row by row from the first row of the tile).
+    class TileCoordinator
+    {
+    public:
+        /// Messages sent to the workers
+        enum class Message : std::uint32_t
+        {
+            TILE     = 1u,  // render the tile
+            DONE     = 2u,  // all the tiles are rendered, the worker can stop
+            REJECTED = 3u   // the worker renders another frame
+        };
+
+        /// First value sent by a worker
+        static constexpr std::uint32_t magicNumber = 0x52545448u;
+
+        /// Version of the messages between the coordinator and the workers
+        static constexpr std::uint32_t protocolVersion = 1u;
+
+        /// Longest description of a frame accepted from a worker
+        static constexpr std::uint32_t maxFrameLength = 4096u;
+
+    public:
+        /// Constructor with the dimensions of the image, the window of the image to render (split in tiles, the other pixels stay black), the
+        /// size of the (square) tiles and the description of the frame (workers must send the same one)
+        TileCoordinator(unsigned int width, unsigned int height, const Tile& window, unsigned int tileSize, const std::string& frame);
+
+        /// Copy constructor (copy not allowed)
+        TileCoordinator(const TileCoordinator& tileCoordinator) = delete;
+
+        /// Copy operator (copy not allowed)
+        TileCoordinator& operator=(const TileCoordinator& tileCoordinator) = delete;
+
+        /// Destructor
+        ~TileCoordinator(void) = default;
+
+        /// Write the tiles rendered so far in a checkpoint file during the render, every period (in seconds) and once all the tiles are
+        /// rendered. With resume, the tiles of the file (if it exists) are not rendered again.
+        void checkpoint(const std::string& path, double period, bool resume);
+
+        /// Listen to the workers on a port and hand them the tiles until all of them are rendered, throws a runtime error if the port can
+        /// not be used
+        void render(unsigned short port);
+
+        /// Get the buffer with the pixels of the rendered tiles (read only)
+        const Buffer& buffer(void) const noexcept;
+
+        /// Get the number of tiles of the image
+        std::size_t tileCount(void) const noexcept;
+
+    private:
+        /// Connection to a worker
+        struct Worker
+        {
+            Socket socket;
+            bool   accepted = false;  ///< The worker renders the same frame
+            bool   busy     = false;  ///< The worker renders a tile
+            Tile   tile;
+        };
+
+    private:
+        /// Check the first message of a worker, a worker rendering another frame is told so
+        bool _accept(Worker& worker) const;
+
+        /// Send a message with a tile to a worker, return false if the connection is lost
+        bool _send(const Worker& worker, Message message, const Tile& tile) const;
+
+        /// Receive the pixels of the tile of a worker and copy them in the buffer, return false if the connection is lost or if it is not
+        /// the tile given to the worker
+        bool _receive(Worker& worker);
+
+    private:
+        Buffer                     _buffer;
+        std::string                _frame;
+        std::vector<Tile>          _tiles;
+        std::vector<unsigned char> _pixels;
+        std::string                _checkpointFile;
+        double                     _checkpointPeriod = 60.0;
+        bool                       _resumeCheckpoint = false;
+
+    };  // class TileCoordinator
+
+}  // namespace LCNS
@@ -0,0 +1,86 @@
+//===============================================================================================//
+/*!
+ *  \file      TileWorker.cpp
+ *  \author    Loïc Corenthy
+ *  \version   1.2
+ *  \date      19/10/2026
+ *  \copyright (c) 2026 Loïc Corenthy. All rights reserved.
+ */
+//===============================================================================================//
+
+#include "TileWorker.hpp"
+
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+#include "Renderer.hpp"
+#include "Socket.hpp"
+#include "Tile.hpp"
+#include "TileCoordinator.hpp"
+
+using std::cout;
+using std::endl;
+using std::runtime_error;
+using std::size_t;
+using std::string;
+using std::to_string;
+using std::uint32_t;
+
+using LCNS::Renderer;
+using LCNS::Socket;
+using LCNS::Tile;
+using LCNS::TileCoordinator;
+using LCNS::TileWorker;
+
+TileWorker::TileWorker(const string& frame)
+: _frame(frame)
+{
+    if (_frame.size() > TileCoordinator::maxFrameLength)
+    {
+        throw runtime_error("The description of the frame is too long");
+    }
+}
+
+unsigned int TileWorker::render(const string& host, unsigned short port)
+{
+    const Socket coordinator = Socket::connect(host, port);
+    cout << "Connected to the coordinator " << coordinator.peer() << endl;
+
+    if (!coordinator.send(TileCoordinator::magicNumber) || !coordinator.send(TileCoordinator::protocolVersion)
+        || !coordinator.send(static_cast<uint32_t>(_frame.size())) || !coordinator.send(_frame.data(), _frame.size()))
+        throw runtime_error("The connection to the coordinator is lost");
+
+    unsigned int renderedCount = 0u;
+
+    while (true)
+    {
+        uint32_t message = 0u;
+        Tile     tile;
+
+        if (!coordinator.receive(message) || !coordinator.receive(tile.x) || !coordinator.receive(tile.y) || !coordinator.receive(tile.width)
+            || !coordinator.receive(tile.height))
+            throw runtime_error("The connection to the coordinator is lost after " + to_string(renderedCount) + " tiles");
+
+        if (message == static_cast<uint32_t>(TileCoordinator::Message::DONE))
+            return renderedCount;
+
+        if (message == static_cast<uint32_t>(TileCoordinator::Message::REJECTED))
+            throw runtime_error("The coordinator renders another frame than " + _frame);
+
+        if (message != static_cast<uint32_t>(TileCoordinator::Message::TILE))
+            throw runtime_error("Unknown message " + to_string(message) + " from the coordinator");
+
+        Renderer::renderTile(tile);
+
+        _pixels.resize(3u * static_cast<size_t>(tile.pixelCount()));
+        Renderer::getBuffer().readTile(tile, _pixels.data());
+
+        if (!coordinator.send(tile.x) || !coordinator.send(tile.y) || !coordinator.send(tile.width) || !coordinator.send(tile.height)
+            || !coordinator.send(_pixels.data(), _pixels.size()))
+            throw runtime_error("The connection to the coordinator is lost after " + to_string(renderedCount) + " tiles");
+
+        ++renderedCount;
+    }
+}
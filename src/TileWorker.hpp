@@ -0,0 +1,45 @@
+//===============================================================================================//
+/*!
+ *  \file      TileWorker.hpp
+ *  \author    Loïc Corenthy
+ *  \version   1.2
+ *  \date      19/10/2026
+ *  \copyright (c) 2026 Loïc Corenthy. All rights reserved.
+ */
+//===============================================================================================//
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+namespace LCNS
+{
+    /// Worker of a render distributed by a TileCoordinator. It renders the tiles the coordinator hands over with the Renderer, whose scene and
+    /// image dimensions must have been set, and sends their pixels back.
+    class TileWorker
+    {
+    public:
+        /// Constructor with the description of the frame, it must be the same as the one of the coordinator
+        explicit TileWorker(const std::string& frame);
+
+        /// Copy constructor (copy not allowed)
+        TileWorker(const TileWorker& tileWorker) = delete;
+
+        /// Copy operator (copy not allowed)
+        TileWorker& operator=(const TileWorker& tileWorker) = delete;
+
+        /// Destructor
+        ~TileWorker(void) = default;
+
+        /// Connect to the coordinator and render its tiles until all of them are rendered, return the number of tiles rendered by this worker.
+        /// Throws a runtime error if the connection fails or is lost, or if the coordinator renders another frame.
+        unsigned int render(const std::string& host, unsigned short port);
+
+    private:
+        std::string                _frame;
+        std::vector<unsigned char> _pixels;
+
+    };  // class TileWorker
+
+}  // namespace LCNS
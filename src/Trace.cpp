@@ -0,0 +1,225 @@
+//===============================================================================================//
+/*!
+ *  \file      Trace.cpp
+ *  \author    Loïc Corenthy
+ *  \version   1.2
+ *  \date      19/10/2026
+ *  \copyright (c) 2026 Loïc Corenthy. All rights reserved.
+ */
+//===============================================================================================//
+
+#include "Trace.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+using std::atomic;
+using std::make_unique;
+using std::memory_order_acquire;
+using std::memory_order_relaxed;
+using std::memory_order_release;
+using std::min;
+using std::mutex;
+using std::ofstream;
+using std::scoped_lock;
+using std::setfill;
+using std::setw;
+using std::size_t;
+using std::string;
+using std::unique_ptr;
+using std::uint64_t;
+using std::vector;
+using std::chrono::duration_cast;
+using std::chrono::nanoseconds;
+using std::chrono::steady_clock;
+
+using LCNS::Trace;
+using LCNS::TraceScope;
+
+namespace
+{
+    /// Ring buffer of the events of a thread
+    struct ThreadEvents
+    {
+        explicit ThreadEvents(unsigned int id)
+        : threadId(id)
+        , events(Trace::eventCapacity)
+        {
+        }
+
+        unsigned int         threadId;
+        vector<Trace::Event> events;
+        uint64_t             recordedCount = 0u;
+    };
+
+    atomic<bool>     enabled = false;
+    atomic<uint64_t> origin  = 0u;
+
+    /// Buffers of all the threads that recorded events, they are kept after their thread ends to be written. The buffers of the threads that
+    /// ended are reused by the next threads (a render starts new threads), which continue their events under the same thread id.
+    mutex                            registryMutex;
+    vector<unique_ptr<ThreadEvents>> registry;
+    vector<ThreadEvents*>            freeBuffers;
+
+    /// Buffer of the calling thread, given back to the free buffers when the thread ends
+    struct ThreadBuffer
+    {
+        ~ThreadBuffer(void)
+        {
+            if (events != nullptr)
+            {
+                scoped_lock lock(registryMutex);
+                freeBuffers.push_back(events);
+            }
+        }
+
+        ThreadEvents* events = nullptr;
+    };
+
+    thread_local ThreadBuffer threadBuffer;
+
+    uint64_t steadyNanoseconds(void) noexcept
+    {
+        return static_cast<uint64_t>(duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count());
+    }
+
+    /// Write a time in nanoseconds as microseconds, the unit of the trace event format
+    void writeMicroseconds(ofstream& file, uint64_t time)
+    {
+        file << time / 1000u << '.' << setw(3) << setfill('0') << time % 1000u;
+    }
+
+}  // namespace
+
+void Trace::enable(bool activate)
+{
+    if (activate)
+    {
+        scoped_lock lock(registryMutex);
+        for (auto& buffer : registry)
+            buffer->recordedCount = 0u;
+
+        origin.store(steadyNanoseconds(), memory_order_relaxed);
+    }
+
+    enabled.store(activate, memory_order_release);
+}
+
+bool Trace::isEnabled(void) noexcept
+{
+    return enabled.load(memory_order_acquire);
+}
+
+uint64_t Trace::now(void) noexcept
+{
+    return steadyNanoseconds() - origin.load(memory_order_relaxed);
+}
+
+void Trace::record(const Event& event)
+{
+    if (threadBuffer.events == nullptr)
+    {
+        scoped_lock lock(registryMutex);
+
+        if (freeBuffers.empty())
+        {
+            registry.push_back(make_unique<ThreadEvents>(static_cast<unsigned int>(registry.size())));
+            threadBuffer.events = registry.back().get();
+        }
+        else
+        {
+            threadBuffer.events = freeBuffers.back();
+            freeBuffers.pop_back();
+        }
+    }
+
+    auto& buffer = *threadBuffer.events;
+    buffer.events[buffer.recordedCount % eventCapacity] = event;
+    ++buffer.recordedCount;
+}
+
+bool Trace::write(const string& path)
+{
+    ofstream file(path);
+    if (!file)
+        return false;
+
+    scoped_lock lock(registryMutex);
+
+    file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+
+    bool first = true;
+    for (const auto& buffer : registry)
+    {
+        file << (first ? "" : ",\n") << R"({"name":"thread_name","ph":"M","pid":1,"tid":)" << buffer->threadId << R"(,"args":{"name":"thread )"
+             << buffer->threadId << "\"}}";
+        first = false;
+
+        // Only the last events fit in the ring buffer
+        const uint64_t keptCount = min<uint64_t>(buffer->recordedCount, eventCapacity);
+
+        for (uint64_t i = buffer->recordedCount - keptCount; i < buffer->recordedCount; ++i)
+        {
+            const auto& event = buffer->events[i % eventCapacity];
+
+            file << ",\n{\"name\":\"" << event.name << "\",\"cat\":\"" << event.category << R"(","ph":"X","pid":1,"tid":)" << buffer->threadId
+                 << ",\"ts\":";
+            writeMicroseconds(file, event.start);
+            file << ",\"dur\":";
+            writeMicroseconds(file, event.duration);
+
+            if (event.argumentNames[0] != nullptr)
+            {
+                file << ",\"args\":{\"" << event.argumentNames[0] << "\":" << event.argumentValues[0];
+                if (event.argumentNames[1] != nullptr)
+                    file << ",\"" << event.argumentNames[1] << "\":" << event.argumentValues[1];
+                file << '}';
+            }
+
+            file << '}';
+        }
+    }
+
+    file << "\n]}\n";
+
+    return static_cast<bool>(file);
+}
+
+TraceScope::TraceScope(const char* name, const char* category)
+: _active(Trace::isEnabled())
+{
+    if (_active)
+    {
+        _event.name     = name;
+        _event.category = category;
+        _event.start    = Trace::now();
+    }
+}
+
+TraceScope::TraceScope(
+const char* name, const char* category, const char* argumentName0, uint64_t argumentValue0, const char* argumentName1, uint64_t argumentValue1)
+: TraceScope(name, category)
+{
+    if (_active)
+    {
+        _event.argumentNames[0]  = argumentName0;
+        _event.argumentValues[0] = argumentValue0;
+        _event.argumentNames[1]  = argumentName1;
+        _event.argumentValues[1] = argumentValue1;
+    }
+}
+
+TraceScope::~TraceScope(void)
+{
+    if (_active)
+    {
+        _event.duration = Trace::now() - _event.start;
+        Trace::record(_event);
+    }
+}
@@ -0,0 +1,88 @@
+//===============================================================================================//
+/*!
+ *  \file      Trace.hpp
+ *  \author    Loïc Corenthy
+ *  \version   1.2
+ *  \date      19/10/2026
+ *  \copyright (c) 2026 Loïc Corenthy. All rights reserved.
+ */
+//===============================================================================================//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace LCNS
+{
+    /// Timeline of the scene construction and of the render, written in the trace event format of Chrome (chrome://tracing) and Perfetto.
+    /// Each thread records its events in its own ring buffer, without any lock, the oldest events of a thread are overwritten when its buffer is
+    /// full. The buffer of a thread that ended is reused by the next thread recording events, so that the renders starting new threads do not
+    /// add buffers. Nothing is recorded until the trace is enabled.
+    class Trace
+    {
+    public:
+        /// Timed section of code, the names must be string literals (only the pointers are stored)
+        struct Event
+        {
+            const char*   name              = nullptr;
+            const char*   category          = nullptr;
+            std::uint64_t start             = 0u;
+            std::uint64_t duration          = 0u;
+            const char*   argumentNames[2]  = { nullptr, nullptr };
+            std::uint64_t argumentValues[2] = { 0u, 0u };
+        };
+
+        /// Number of events kept by each thread
+        static constexpr std::size_t eventCapacity = 1u << 16;
+
+    public:
+        /// Start or stop recording events, the events already recorded are discarded when the recording starts
+        static void enable(bool activate);
+
+        /// Check if the events are recorded
+        static bool isEnabled(void) noexcept;
+
+        /// Get the time elapsed since the recording started in nanoseconds
+        static std::uint64_t now(void) noexcept;
+
+        /// Add an event to the ring buffer of the calling thread
+        static void record(const Event& event);
+
+        /// Write the events of all the threads to a JSON file, must not be called while events are recorded by other threads
+        static bool write(const std::string& path);
+
+    };  // class Trace
+
+    /// Record the time spent in a scope as a trace event (nothing is done if the trace is not enabled)
+    class TraceScope
+    {
+    public:
+        /// Constructor with the name and the category of the event
+        TraceScope(const char* name, const char* category);
+
+        /// Constructor with the name and the category of the event and up to two named values shown with it
+        TraceScope(const char*   name,
+                   const char*   category,
+                   const char*   argumentName0,
+                   std::uint64_t argumentValue0,
+                   const char*   argumentName1  = nullptr,
+                   std::uint64_t argumentValue1 = 0u);
+
+        /// Copy constructor (copy not allowed)
+        TraceScope(const TraceScope& traceScope) = delete;
+
+        /// Copy operator (copy not allowed)
+        TraceScope& operator=(const TraceScope& traceScope) = delete;
+
+        /// Destructor, records the event
+        ~TraceScope(void);
+
+    private:
+        Trace::Event _event;
+        bool         _active = false;
+
+    };  // class TraceScope
+
+}  // namespace LCNS
@@ -0,0 +1,94 @@
+//===============================================================================================//
+/*!
+ *  \file      Transform.cpp
+ *  \author    Loïc Corenthy
+ *  \version   1.2
+ *  \date      19/10/2026
+ *  \copyright (c) 2026 Loïc Corenthy. All rights reserved.
+ */
+//===============================================================================================//
+
+#include "Transform.hpp"
+
+#include <cmath>
+
+using std::cos;
+using std::sin;
+
+using LCNS::Point;
+using LCNS::Real;
+using LCNS::toReal;
+using LCNS::Transform;
+using LCNS::Vector;
+
+Transform::Transform(void)
+: _translation(Real{ 0.0 })
+{
+    _rotation[0] = Vector(Real{ 1.0 }, Real{ 0.0 }, Real{ 0.0 });
+    _rotation[1] = Vector(Real{ 0.0 }, Real{ 1.0 }, Real{ 0.0 });
+    _rotation[2] = Vector(Real{ 0.0 }, Real{ 0.0 }, Real{ 1.0 });
+}
+
+Transform::Transform(const Vector& translation, const Vector& axis, double angle, const Point& pivot)
+: Transform()
+{
+    if (angle != 0.0 && axis.lengthSqr() > Real{ 0.0 })
+    {
+        // Rotation matrix of an angle around a unit axis (Rodrigues' formula)
+        const Vector unitAxis = Vector(axis).normalize();
+        const Real   x        = unitAxis.x();
+        const Real   y        = unitAxis.y();
+        const Real   z        = unitAxis.z();
+        const Real   c        = toReal(cos(angle));
+        const Real   s        = toReal(sin(angle));
+        const Real   t        = Real{ 1.0 } - c;
+
+        _rotation[0] = Vector(c + x * x * t, x * y * t - z * s, x * z * t + y * s);
+        _rotation[1] = Vector(x * y * t + z * s, c + y * y * t, y * z * t - x * s);
+        _rotation[2] = Vector(x * z * t - y * s, y * z * t + x * s, c + z * z * t);
+    }
+
+    // The pivot does not move during the rotation
+    const Vector pivotPosition(pivot.x(), pivot.y(), pivot.z());
+    _translation = pivotPosition - apply(pivotPosition) + translation;
+}
+
+Transform Transform::operator*(const Transform& transform) const
+{
+    Transform composition;
+
+    for (unsigned int i = 0; i < 3; ++i)
+    {
+        composition._rotation[i] = transform._rotation[0] * _rotation[i].x() + transform._rotation[1] * _rotation[i].y()
+                                   + transform._rotation[2] * _rotation[i].z();
+    }
+
+    composition._translation = apply(transform._translation) + _translation;
+
+    return composition;
+}
+
+Transform Transform::inverse(void) const
+{
+    // The inverse of a rotation is its transpose
+    Transform inverseTransform;
+
+    for (unsigned int i = 0; i < 3; ++i)
+        inverseTransform._rotation[i] = Vector(_rotation[0][i], _rotation[1][i], _rotation[2][i]);
+
+    inverseTransform._translation = inverseTransform.apply(_translation) * Real{ -1.0 };
+
+    return inverseTransform;
+}
+
+Point Transform::apply(const Point& point) const
+{
+    const Vector position(point.x(), point.y(), point.z());
+
+    return Point(_rotation[0] * position + _translation.x(), _rotation[1] * position + _translation.y(), _rotation[2] * position + _translation.z());
+}
+
+Vector Transform::apply(const Vector& vector) const
+{
+    return Vector(_rotation[0] * vector, _rotation[1] * vector, _rotation[2] * vector);
+}
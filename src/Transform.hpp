@@ -0,0 +1,59 @@
+//===============================================================================================//
+/*!
+ *  \file      Transform.hpp
+ *  \author    Loïc Corenthy
+ *  \version   1.2
+ *  \date      19/10/2026
+ *  \copyright (c) 2026 Loïc Corenthy. All rights reserved.
+ */
+//===============================================================================================//
+
+#pragma once
+
+#include <array>
+
+#include "Point.hpp"
+#include "Real.hpp"
+#include "Vector.hpp"
+
+namespace LCNS
+{
+    /// Rigid transform of the objects and lights of an animated scene: a rotation followed by a translation (a point p is moved to
+    /// rotation * p + translation)
+    class Transform
+    {
+    public:
+        /// Default constructor, identity transform
+        Transform(void);
+
+        /// Constructor with a rotation by an angle (in radians) around an axis going through a pivot point, followed by a translation
+        Transform(const Vector& translation, const Vector& axis, double angle, const Point& pivot);
+
+        /// Copy constructor
+        Transform(const Transform& transform) = default;
+
+        /// Copy operator
+        Transform& operator=(const Transform& transform) = default;
+
+        /// Destructor
+        ~Transform(void) = default;
+
+        /// Composition of two transforms, the other transform is applied first
+        Transform operator*(const Transform& transform) const;
+
+        /// Get the inverse transform
+        Transform inverse(void) const;
+
+        /// Move a point
+        Point apply(const Point& point) const;
+
+        /// Rotate a vector (a direction or a normal is not translated)
+        Vector apply(const Vector& vector) const;
+
+    private:
+        std::array<Vector, 3> _rotation;  ///< Rows of the rotation matrix
+        Vector                _translation;
+
+    };  // class Transform
+
+}  // namespace LCNS
@@ -16,19 +16,24 @@
 #include "Scene.hpp"
 #include "Shader.hpp"
 #include "Vector.hpp"
+#include "Statistics.hpp"
+#include "Transform.hpp"
 #include <memory>
 #include <optional>
 
 using std::array;
 using std::make_shared;
-using std::mutex;
 using std::nullopt;
 using std::optional;
-using std::scoped_lock;
 
 using LCNS::Color;
+using LCNS::intersectionEpsilon;
 using LCNS::Point;
 using LCNS::Ray;
+using LCNS::Real;
+using LCNS::Statistics;
+using LCNS::toReal;
+using LCNS::Transform;
 using LCNS::Triangle;
 using LCNS::Vector;
 
@@ -104,22 +109,24 @@ void Triangle::updateNormal(void)
 
 bool Triangle::intersect(Ray& ray)
 {
-    const double scalarProd = ray.direction() * _normal;
+    Statistics::count(Statistics::Counter::TRIANGLE_TESTS);
+
+    const Real scalarProd = ray.direction() * _normal;
 
     // Check if ray is not parallel to triangle
-    if (scalarProd != 0.0)
+    if (scalarProd != Real{ 0.0 })
     {
         const auto pointInTriangle = Vector{ _vertexPosition[0][0], _vertexPosition[0][1], _vertexPosition[0][2] };
         const auto origin          = Vector{ ray.origin().x(), ray.origin().y(), ray.origin().z() };
 
         // Calculate coeffient in the equation of the plane containing the triangle
-        const double d = (_normal * pointInTriangle) * (-1.0);
+        const Real d = -(_normal * pointInTriangle);
 
         // Calculate the lenght the ray when intersecting the plane
-        const double length = (-1.0) * (origin * _normal + d) / (scalarProd);
+        const Real length = -(origin * _normal + d) / scalarProd;
 
         // Calculate the coordinates of the intersection point
-        const auto p = Point{ ray.origin() + ray.direction() * length };
+        const auto p = ray.origin().offset(ray.direction(), length);
 
         // Check if the point in the plane is really inside the triangle
         const auto aB = Vector{ _vertexPosition[1] - _vertexPosition[0] };
@@ -130,7 +137,17 @@ bool Triangle::intersect(Ray& ray)
         const auto bP = Vector{ p - _vertexPosition[1] };
         const auto cP = Vector{ p - _vertexPosition[2] };
 
-        if ((aB ^ aP) * _normal >= 0.0 && (bC ^ bP) * _normal >= 0.0 && (cA ^ cP) * _normal >= 0.0 && length > 0.0)
+        // The edges are widened by the epsilon (scaled by their length, like the cross products) so that a ray cannot go through the shared
+        // edge of two triangles because of rounding errors, the square roots are skipped when there is no epsilon
+        const auto tolerance = [](const Vector& edge) {
+            if constexpr (intersectionEpsilon > Real{ 0.0 })
+                return -intersectionEpsilon * edge.length();
+            else
+                return Real{ 0.0 };
+        };
+
+        if ((aB ^ aP) * _normal >= tolerance(aB) && (bC ^ bP) * _normal >= tolerance(bC) && (cA ^ cP) * _normal >= tolerance(cA)
+            && length > intersectionEpsilon)
         {
             ray.length(length);
             ray.intersected(this);
@@ -151,6 +168,13 @@ Color Triangle::color(const Ray& ray, unsigned int reflectionCount)
     return _shader->color(ray.direction() * (-1), normalAtPt, ray.intersection(), this, reflectionCount);
 }
 
+Color Triangle::color(const Ray& ray, const Color* lightIntensities, unsigned int reflectionCount)
+{
+    Vector normalAtPt = _barycentricNormal(ray.intersection());
+
+    return _shader->color(ray.direction() * (-1), normalAtPt, ray.intersection(), lightIntensities, reflectionCount);
+}
+
 Vector Triangle::normal(const Point& position) const
 {
     return _barycentricNormal(position);
@@ -173,14 +197,25 @@ Vector Triangle::_barycentricNormal(const LCNS::Point& positionInTriangle) const
     const Vector AC = _vertexPosition[2] - _vertexPosition[0];
 
     const Vector normal          = AB ^ AC;
-    const double normalLengthSqr = normal * normal;
+    const Real   normalLengthSqr = normal * normal;
 
-    const double alpha = (normal * ((_vertexPosition[2] - _vertexPosition[1]) ^ (positionInTriangle - _vertexPosition[1]))) / normalLengthSqr;
-    const double beta  = (normal * ((_vertexPosition[0] - _vertexPosition[2]) ^ (positionInTriangle - _vertexPosition[2]))) / normalLengthSqr;
+    const Real alpha = (normal * ((_vertexPosition[2] - _vertexPosition[1]) ^ (positionInTriangle - _vertexPosition[1]))) / normalLengthSqr;
+    const Real beta  = (normal * ((_vertexPosition[0] - _vertexPosition[2]) ^ (positionInTriangle - _vertexPosition[2]))) / normalLengthSqr;
 
-    const double gamma = 1.0 - alpha - beta;
+    const Real gamma = Real{ 1.0 } - alpha - beta;
+
+    assert(alpha + beta + gamma > toReal(0.999) && alpha + beta + gamma < toReal(1.001));
+
+    return _vertexNormal[2].multiplyAdd(gamma, _vertexNormal[1].multiplyAdd(beta, _vertexNormal[0] * alpha));
+}
+
+void Triangle::transform(const Transform& transform)
+{
+    for (auto& position : _vertexPosition)
+        position = transform.apply(position);
 
-    assert(alpha + beta + gamma > 0.999 && alpha + beta + gamma < 1.001);
+    for (auto& normal : _vertexNormal)
+        normal = transform.apply(normal);
 
-    return (_vertexNormal[0] * alpha + _vertexNormal[1] * beta + _vertexNormal[2] * gamma);
+    _normal = transform.apply(_normal);
 }
@@ -26,7 +26,7 @@ namespace LCNS
     // Forward declaration
     class Ray;
 
-    class Triangle : public Renderable
+    class Triangle final : public Renderable
     {
     public:
         /// Default constructor
@@ -68,6 +68,9 @@ namespace LCNS
         /// Virtual function from Renderable
         Color color(const Ray& ray, unsigned int reflectionCount = 0) override;
 
+        /// Virtual function from Renderable
+        Color color(const Ray& ray, const Color* lightIntensities, unsigned int reflectionCount) override;
+
         /// Virtual function, get the normal at the intersection point
         Vector normal(const Point& position) const override;
 
@@ -77,6 +80,9 @@ namespace LCNS
         /// Virtual function from Renderable
         std::optional<Ray> refractedRay(const Ray& incomingRay) override;
 
+        /// Virtual function from Renderable, the vertex normals and the normal are rotated
+        void transform(const Transform& transform) override;
+
     private:
         /// Calculate determinant of a 2x2 matrix
         float _det(float a1, float a2, float b1, float b2);
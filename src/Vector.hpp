@@ -10,99 +10,236 @@
 
 #pragma once
 
-#include <cmath>
 #include <array>
 #include <cassert>
+#include <cmath>
+
+#include "Real.hpp"
 
 namespace LCNS
 {
+    /// Vector in 3D. All the operations are defined in this header so that they can be inlined in the intersection tests and the shading,
+    /// which use vectors in all their inner loops.
     class Vector
     {
     public:
         /// Default constructor
-        Vector(void) = default;
+        constexpr Vector(void) = default;
 
         /// Constructor with coordinates parameters
-        Vector(double x, double y, double z);
+        constexpr Vector(Real x, Real y, Real z) noexcept;
 
         /// Constructor with same value for all coordinates
-        explicit Vector(double commonValue);
+        constexpr explicit Vector(Real commonValue) noexcept;
 
         /// Copy constructor
-        Vector(const Vector& vector) = default;
+        constexpr Vector(const Vector& vector) = default;
 
         /// Move constructor
-        Vector(Vector&& vector) = default;
+        constexpr Vector(Vector&& vector) = default;
 
         /// Copy the coordinates of a vector to another one
-        Vector& operator=(const Vector& vector) = default;
+        constexpr Vector& operator=(const Vector& vector) = default;
 
         /// Move assignment operator
-        Vector& operator=(Vector&& vector) = default;
+        constexpr Vector& operator=(Vector&& vector) = default;
 
         /// Destructor
         ~Vector(void) = default;
 
         /// Coordinate operator (read only)
-        double operator[](unsigned int index) const;
+        constexpr Real operator[](unsigned int index) const;
 
         /// Coordinate operator (read, write)
-        double& operator[](unsigned int index);
+        constexpr Real& operator[](unsigned int index);
 
         /// Set all coordinates at once
-        void setVector(double x, double y, double z) noexcept;
+        constexpr void setVector(Real x, Real y, Real z) noexcept;
 
         /// Set X coordinate
-        void setX(double x) noexcept;
+        constexpr void setX(Real x) noexcept;
 
         /// Set Y coordinate
-        void setY(double y) noexcept;
+        constexpr void setY(Real y) noexcept;
 
         /// Set Z coordinate
-        void setZ(double z) noexcept;
+        constexpr void setZ(Real z) noexcept;
 
         /// Get X coordinate
-        double x(void) const noexcept;
+        constexpr Real x(void) const noexcept;
 
         /// Get X coordinate
-        double y(void) const noexcept;
+        constexpr Real y(void) const noexcept;
 
         /// Get X coordinate
-        double z(void) const noexcept;
+        constexpr Real z(void) const noexcept;
 
         /// Return the vector sum of 2 vectors
-        Vector operator+(const Vector& vector) const;
+        constexpr Vector operator+(const Vector& vector) const noexcept;
 
         /// Return the vector difference of 2 vectors
-        Vector operator-(const Vector& vector) const;
+        constexpr Vector operator-(const Vector& vector) const noexcept;
 
         /// Add a vector to the current one
-        Vector operator+=(const Vector& vector);
+        constexpr Vector& operator+=(const Vector& vector) noexcept;
 
         /// Substract a vector to the current one
-        Vector operator-=(const Vector& vector);
+        constexpr Vector& operator-=(const Vector& vector) noexcept;
 
         /// Multiply a vector by a scalar
-        Vector operator*(double scalar) const;
+        constexpr Vector operator*(Real scalar) const noexcept;
 
         /// Scalar product of 2 vectors
-        double operator*(const Vector& vector) const;
+        constexpr Real operator*(const Vector& vector) const noexcept;
 
         /// Dot product of 2 vectors
-        Vector operator^(const Vector& vector) const;
+        constexpr Vector operator^(const Vector& vector) const noexcept;
+
+        /// Multiply the vector by a scalar and add another vector to the result (this * scalar + vector) without any temporary vector
+        constexpr Vector multiplyAdd(Real scalar, const Vector& vector) const noexcept;
 
         /// Return the length of the vector
-        double length(void) const;
+        Real length(void) const;
 
         /// Return the square length of a the vector
-        double lengthSqr(void) const;
+        constexpr Real lengthSqr(void) const noexcept;
 
         /// Divide a vector by it's length and return it.
         Vector normalize(void);
 
     private:
-        std::array<double, 3> _coords = { 0.0, 0.0, 0.0 };
+        std::array<Real, 3> _coords = { 0.0, 0.0, 0.0 };
 
     };  // class Vector
 
+    constexpr Vector::Vector(Real x, Real y, Real z) noexcept
+    : _coords{ x, y, z }
+    {
+    }
+
+    constexpr Vector::Vector(Real commonValue) noexcept
+    : _coords{ commonValue, commonValue, commonValue }
+    {
+    }
+
+    constexpr Real Vector::operator[](unsigned int index) const
+    {
+        assert(index <= 2 && "Vector: index out of bounds");
+        return _coords[index];
+    }
+
+    constexpr Real& Vector::operator[](unsigned int index)
+    {
+        assert(index <= 2 && "Vector: index out of bounds");
+        return _coords[index];
+    }
+
+    constexpr void Vector::setVector(Real x, Real y, Real z) noexcept
+    {
+        _coords[0] = x;
+        _coords[1] = y;
+        _coords[2] = z;
+    }
+
+    constexpr void Vector::setX(Real x) noexcept
+    {
+        _coords[0] = x;
+    }
+
+    constexpr void Vector::setY(Real y) noexcept
+    {
+        _coords[1] = y;
+    }
+
+    constexpr void Vector::setZ(Real z) noexcept
+    {
+        _coords[2] = z;
+    }
+
+    constexpr Real Vector::x(void) const noexcept
+    {
+        return _coords[0];
+    }
+
+    constexpr Real Vector::y(void) const noexcept
+    {
+        return _coords[1];
+    }
+
+    constexpr Real Vector::z(void) const noexcept
+    {
+        return _coords[2];
+    }
+
+    constexpr Vector Vector::operator+(const Vector& vector) const noexcept
+    {
+        return Vector{ _coords[0] + vector._coords[0], _coords[1] + vector._coords[1], _coords[2] + vector._coords[2] };
+    }
+
+    constexpr Vector Vector::operator-(const Vector& vector) const noexcept
+    {
+        return Vector{ _coords[0] - vector._coords[0], _coords[1] - vector._coords[1], _coords[2] - vector._coords[2] };
+    }
+
+    constexpr Vector& Vector::operator+=(const Vector& vector) noexcept
+    {
+        _coords[0] += vector._coords[0];
+        _coords[1] += vector._coords[1];
+        _coords[2] += vector._coords[2];
+
+        return *this;
+    }
+
+    constexpr Vector& Vector::operator-=(const Vector& vector) noexcept
+    {
+        _coords[0] -= vector._coords[0];
+        _coords[1] -= vector._coords[1];
+        _coords[2] -= vector._coords[2];
+
+        return *this;
+    }
+
+    constexpr Vector Vector::operator*(Real scalar) const noexcept
+    {
+        return Vector{ scalar * _coords[0], scalar * _coords[1], scalar * _coords[2] };
+    }
+
+    constexpr Real Vector::operator*(const Vector& vector) const noexcept
+    {
+        return _coords[0] * vector._coords[0] + _coords[1] * vector._coords[1] + _coords[2] * vector._coords[2];
+    }
+
+    constexpr Vector Vector::operator^(const Vector& vector) const noexcept
+    {
+        return Vector{ _coords[1] * vector._coords[2] - _coords[2] * vector._coords[1],
+                       _coords[2] * vector._coords[0] - _coords[0] * vector._coords[2],
+                       _coords[0] * vector._coords[1] - _coords[1] * vector._coords[0] };
+    }
+
+    constexpr Vector Vector::multiplyAdd(Real scalar, const Vector& vector) const noexcept
+    {
+        return Vector{ _coords[0] * scalar + vector._coords[0], _coords[1] * scalar + vector._coords[1], _coords[2] * scalar + vector._coords[2] };
+    }
+
+    inline Real Vector::length(void) const
+    {
+        return std::sqrt(lengthSqr());
+    }
+
+    constexpr Real Vector::lengthSqr(void) const noexcept
+    {
+        return _coords[0] * _coords[0] + _coords[1] * _coords[1] + _coords[2] * _coords[2];
+    }
+
+    inline Vector Vector::normalize(void)
+    {
+        const auto lengthVector = length();
+
+        _coords[0] /= lengthVector;
+        _coords[1] /= lengthVector;
+        _coords[2] /= lengthVector;
+
+        return *this;
+    }
+
 }  // namespace LCNS
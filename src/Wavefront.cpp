@@ -0,0 +1,596 @@
+//===============================================================================================//
+/*!
+ *  \file      Wavefront.cpp
+ *  \author    Loïc Corenthy
+ *  \version   1.2
+ *  \date      19/10/2026
+ *  \copyright (c) 2026 Loïc Corenthy. All rights reserved.
+ */
+//===============================================================================================//
+
+#include "Wavefront.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "AOVBuffer.hpp"
+#include "Buffer.hpp"
+#include "Camera.hpp"
+#include "Light.hpp"
+#include "Renderable.hpp"
+#include "Scene.hpp"
+#include "Shader.hpp"
+#include "Statistics.hpp"
+
+using std::copy;
+using std::exp2;
+using std::min;
+using std::minmax_element;
+using std::ptrdiff_t;
+using std::size_t;
+using std::sort;
+using std::uint64_t;
+
+using LCNS::AOVBuffer;
+using LCNS::Buffer;
+using LCNS::Color;
+using LCNS::Point;
+using LCNS::Ray;
+using LCNS::RayStream;
+using LCNS::Real;
+using LCNS::Renderable;
+using LCNS::Scene;
+using LCNS::Statistics;
+using LCNS::toReal;
+using LCNS::Vector;
+using LCNS::Wavefront;
+
+namespace
+{
+    /// Same tone mapping as the depth first rendering
+    Color toneMapping(const Color& color)
+    {
+        Color colorAfterToneMapping;
+        colorAfterToneMapping.red(1.0 - exp2(color.red() * (-1.0)));
+        colorAfterToneMapping.green(1.0 - exp2(color.green() * (-1.0)));
+        colorAfterToneMapping.blue(1.0 - exp2(color.blue() * (-1.0)));
+
+        return colorAfterToneMapping;
+    }
+
+    /// Position of the components of a sample in the array of sample colors, red, green and blue are consecutive
+    constexpr size_t ambientOffset    = 0u;
+    constexpr size_t diffusionOffset  = 3u;
+    constexpr size_t reflectionOffset = 6u;
+    constexpr size_t refractionOffset = 9u;
+    constexpr size_t sampleColorSize  = 12u;
+
+    /// Copy a color in an array of doubles
+    void store(double* destination, const Color& color) noexcept
+    {
+        destination[0] = color.red();
+        destination[1] = color.green();
+        destination[2] = color.blue();
+    }
+
+    /// Insert two 0 bits between each of the 10 lowest bits of a value
+    uint64_t spreadBits(uint64_t value) noexcept
+    {
+        value &= 0x3FFu;
+        value = (value | (value << 16u)) & 0x030000FFu;
+        value = (value | (value << 8u)) & 0x0300F00Fu;
+        value = (value | (value << 4u)) & 0x030C30C3u;
+        value = (value | (value << 2u)) & 0x09249249u;
+
+        return value;
+    }
+
+    /// Position of a coordinate in a grid of 1024 cells covering [minimum, minimum + 1 / scale]
+    uint64_t cell(double coordinate, double minimum, double scale) noexcept
+    {
+        return static_cast<uint64_t>(min((coordinate - minimum) * scale, 1023.0));
+    }
+
+    /// Add a color to the one stored in an array of doubles
+    void accumulate(double* destination, const Color& color) noexcept
+    {
+        destination[0] += color.red();
+        destination[1] += color.green();
+        destination[2] += color.blue();
+    }
+}  // namespace
+
+Wavefront::Wavefront(Scene& scene, Buffer& buffer, const Color& meanLight, bool superSampling)
+: _scene(scene)
+, _buffer(buffer)
+, _meanLight(meanLight)
+, _sampling(Sampling::SINGLE)
+{
+    assert(!_scene.cameraList().empty() && "The scene must have a camera");
+
+    if (const auto& camera = _scene.cameraList().front(); camera->aperture() == Camera::Aperture::F_SMALL
+                                                          || camera->aperture() == Camera::Aperture::F_MEDIUM
+                                                          || camera->aperture() == Camera::Aperture::F_BIG)
+        _sampling = Sampling::APERTURE;
+    else if (superSampling)
+        _sampling = Sampling::SUPER_SAMPLING;
+}
+
+void Wavefront::render(unsigned int startIndex, unsigned int endIndex)
+{
+    // Large ranges are split in several passes so that the streams stay in the cache
+    for (unsigned int passStart = startIndex; passStart < endIndex; passStart += _maxPixelsPerPass)
+    {
+        _renderPass(passStart, min(passStart + _maxPixelsPerPass, endIndex));
+    }
+}
+
+void Wavefront::sortSecondaryRays(bool activate) noexcept
+{
+    _sortSecondaryRays = activate;
+}
+
+void Wavefront::terminateReflections(double threshold, bool russianRoulette) noexcept
+{
+    _reflectionThreshold = threshold;
+    _russianRoulette     = russianRoulette;
+}
+
+void Wavefront::recordAOVs(AOVBuffer& aovBuffer) noexcept
+{
+    _aovBuffer = &aovBuffer;
+}
+
+void Wavefront::_renderPass(unsigned int startIndex, unsigned int endIndex)
+{
+    _generate(startIndex, endIndex);
+
+    // Primary rays
+    _extend(_rays);
+    _shadow(_rays);
+    _shadePrimary(_rays);
+
+    _spawnedRays.clear();
+    _spawnRefractions(_rays, _spawnedRays);
+    _spawnReflections(_rays, true, _spawnedRays);
+
+    // Secondary rays, each iteration goes one level deeper in the reflections
+    while (!_spawnedRays.empty())
+    {
+        _rays.swap(_spawnedRays);
+        _spawnedRays.clear();
+
+        if (_sortSecondaryRays)
+            _sort(_rays);
+
+        _extend(_rays);
+        _shadow(_rays);
+        _shadeSecondary(_rays);
+        _spawnReflections(_rays, false, _spawnedRays);
+    }
+
+    _resolve();
+}
+
+void Wavefront::_addSample(unsigned int pixel, double weight, const Ray& primaryRay)
+{
+    const auto sample = static_cast<unsigned int>(_samplePixel.size());
+
+    _samplePixel.push_back(pixel);
+    _sampleWeight.push_back(weight);
+    _sampleHit.push_back(0u);
+    _sampleMaxReflection.push_back(0u);
+    _sampleReflections.emplace_back(_reflectionThreshold, _russianRoulette);
+    _sampleColors.resize(_sampleColors.size() + sampleColorSize, 0.0);
+
+    _rays.push(primaryRay, sample, 0u);
+
+    Statistics::count(Statistics::Counter::PRIMARY_RAYS);
+}
+
+void Wavefront::_generate(unsigned int startIndex, unsigned int endIndex)
+{
+    _samplePixel.clear();
+    _sampleWeight.clear();
+    _sampleHit.clear();
+    _sampleMaxReflection.clear();
+    _sampleReflections.clear();
+    _sampleColors.clear();
+    _rays.clear();
+
+    const auto& camera = _scene.cameraList().front();
+    const auto  width  = _buffer.width();
+
+    for (unsigned int i = startIndex; i < endIndex; ++i)
+    {
+        const unsigned int bufferJ = i / width;
+        const unsigned int bufferI = i - bufferJ * width;
+
+        switch (_sampling)
+        {
+            case Sampling::APERTURE:
+            {
+                // Calculate current focal point
+                Ray firstRay(camera->position(), camera->pixelDirection(bufferI, bufferJ, _buffer));
+                camera->focalPlane().intersect(firstRay);
+                const Point focalPt = firstRay.intersection();
+
+                const double apertureRadius = camera->apertureRadius();
+                const double apertureStep   = camera->apertureStep();
+
+                for (double apertureI = apertureRadius * (-1.0); apertureI <= apertureRadius; apertureI += apertureStep)
+                {
+                    for (double apertureJ = apertureRadius * (-1.0); apertureJ <= apertureRadius; apertureJ += apertureStep)
+                    {
+                        Point apertureOrigin(firstRay.origin());
+                        apertureOrigin.x(apertureOrigin.x() + toReal(apertureI));
+                        apertureOrigin.y(apertureOrigin.y() + toReal(apertureJ));
+
+                        _addSample(i, camera->apertureColorCoeff(apertureI, apertureJ), Ray(apertureOrigin, (focalPt - apertureOrigin)));
+                    }
+                }
+                break;
+            }
+
+            case Sampling::SUPER_SAMPLING:
+            {
+                const auto ii = static_cast<float>(bufferI);
+                const auto jj = static_cast<float>(bufferJ);
+
+                for (float fragmentX = ii; fragmentX < ii + 1.0f; fragmentX += 0.5f)
+                {
+                    for (float fragmentY = jj; fragmentY < jj + 1.0f; fragmentY += 0.5f)
+                    {
+                        const Vector rayDirection
+                        = camera->pixelDirection(static_cast<double>(fragmentX), static_cast<double>(fragmentY), _buffer);
+
+                        _addSample(i, 0.25, Ray(camera->position(), rayDirection));
+                    }
+                }
+                break;
+            }
+
+            case Sampling::SINGLE:
+            default:
+                _addSample(i, 1.0, Ray(camera->position(), camera->pixelDirection(bufferI, bufferJ, _buffer)));
+                break;
+        }
+    }
+}
+
+void Wavefront::_extend(RayStream& rays)
+{
+    for (size_t i = 0; i < rays.size(); ++i)
+    {
+        Ray ray = rays.ray(i);
+        _scene.intersect(ray);
+        rays.intersection(i, ray);
+    }
+}
+
+void Wavefront::_shadow(RayStream& rays)
+{
+    const auto& lights     = _scene.lights();
+    const auto  lightCount = lights.size();
+
+    // The intensities of the rays that do not hit anything are never read, the array only needs to be large enough
+    if (_lightIntensities.size() < rays.size() * lightCount)
+        _lightIntensities.resize(rays.size() * lightCount);
+
+    // Weights of the lights selected by the light tree at each intersection, a light with a weight of 0 is not traced
+    const auto& lightTree = _scene.lightTree();
+    const bool  allLights = lightTree.selectsAll();
+
+    if (!allLights)
+    {
+        assert(lightTree.lightCount() == lightCount && "The light tree must be built after the lights are added to the scene");
+
+        if (_lightWeights.size() < rays.size() * lightCount)
+            _lightWeights.resize(rays.size() * lightCount);
+
+        for (size_t i = 0; i < rays.size(); ++i)
+        {
+            if (rays.intersected[i] != nullptr)
+            {
+                lightTree.select(rays.intersection(i), _selectedLights);
+                copy(_selectedLights.begin(), _selectedLights.end(), _lightWeights.begin() + static_cast<ptrdiff_t>(i * lightCount));
+            }
+        }
+    }
+
+    // All the intersections are tested against the same light before moving to the next one
+    size_t lightIndex = 0u;
+    for (const auto& light : lights)
+    {
+        for (size_t i = 0; i < rays.size(); ++i)
+        {
+            if (rays.intersected[i] != nullptr)
+            {
+                const auto index = i * lightCount + lightIndex;
+
+                if (allLights)
+                {
+                    const Color intensity = light->intensityAt(rays.intersection(i), _scene, rays.intersected[i]);
+                    _lightIntensities[index].set(intensity.red(), intensity.green(), intensity.blue());
+                }
+                else if (_lightWeights[index] != 0.0)
+                {
+                    const Color intensity = light->intensityAt(rays.intersection(i), _scene, rays.intersected[i]) * _lightWeights[index];
+                    _lightIntensities[index].set(intensity.red(), intensity.green(), intensity.blue());
+                }
+                else
+                {
+                    _lightIntensities[index].set(0.0, 0.0, 0.0);
+                }
+            }
+        }
+
+        ++lightIndex;
+    }
+}
+
+void Wavefront::_shadePrimary(RayStream& rays)
+{
+    const auto lightCount = _scene.lights().size();
+
+    for (size_t i = 0; i < rays.size(); ++i)
+    {
+        const auto sample = rays.sample[i];
+        const Ray  ray    = rays.ray(i);
+        double*    colors = _sampleColors.data() + sample * sampleColorSize;
+
+        if (_aovBuffer != nullptr)
+        {
+            const auto pixelJ = _samplePixel[sample] / _buffer.width();
+            _aovBuffer->add(_samplePixel[sample] - pixelJ * _buffer.width(), pixelJ, ray, rays.intersected[i], _sampleWeight[sample]);
+        }
+
+        if (auto* object = rays.intersected[i]; object != nullptr)
+        {
+            const Point intersection = rays.intersection(i);
+
+            _sampleHit[sample]           = 1u;
+            _sampleMaxReflection[sample] = object->shader()->reflectionCountMax();
+
+            // Ambient color
+            Ray ambiantRay(intersection, object->normal(intersection));
+            store(colors + ambientOffset, _meanLight * object->shader()->ambientColor(ambiantRay) * 0.1f);
+
+            // Diffusion color
+            store(colors + diffusionOffset, object->color(ray, _lightIntensities.data() + i * lightCount, 0));
+
+            // The color of the intersection is only needed to stop the reflections early
+            if (_reflectionThreshold > 0.0)
+                _sampleReflections[sample].start(Color(colors[ambientOffset] + colors[diffusionOffset],
+                                                       colors[ambientOffset + 1] + colors[diffusionOffset + 1],
+                                                       colors[ambientOffset + 2] + colors[diffusionOffset + 2]),
+                                                 object->shader()->reflectionCoeff());
+        }
+        else
+        {
+            store(colors + ambientOffset, _scene.backgroundColor(ray));
+        }
+    }
+}
+
+void Wavefront::_shadeSecondary(RayStream& rays)
+{
+    const auto lightCount = _scene.lights().size();
+
+    for (size_t i = 0; i < rays.size(); ++i)
+    {
+        const auto sample = rays.sample[i];
+        const auto depth  = rays.depth[i];
+        const Ray  ray    = rays.ray(i);
+        double*    colors = _sampleColors.data() + sample * sampleColorSize;
+
+        // The refraction rays have a depth of 0, the reflection rays start at 1
+        if (depth == 0u)
+        {
+            if (auto* object = rays.intersected[i]; object != nullptr)
+                store(colors + refractionOffset, object->color(ray, _lightIntensities.data() + i * lightCount, 0));
+            else
+                store(colors + refractionOffset, _scene.backgroundColor(ray));
+        }
+        else
+        {
+            auto& reflectionChain = _sampleReflections[sample];
+
+            if (auto* object = rays.intersected[i]; object != nullptr)
+                accumulate(colors + reflectionOffset,
+                           reflectionChain.contribution(object->color(ray, _lightIntensities.data() + i * lightCount, depth), depth));
+            else
+                accumulate(colors + reflectionOffset,
+                           reflectionChain.contribution(_scene.backgroundColor(ray) * (1.0 / static_cast<double>((depth + 1) * (depth + 1))), depth));
+        }
+    }
+}
+
+void Wavefront::_spawnRefractions(RayStream& rays, RayStream& spawned)
+{
+    for (size_t i = 0; i < rays.size(); ++i)
+    {
+        auto* object = rays.intersected[i];
+
+        if (object == nullptr || !(object->shader()->refractionCoeff() > 1.0))
+            continue;
+
+        if (auto refractionRay = object->refractedRay(rays.ray(i)); refractionRay)
+        {
+            spawned.push(refractionRay.value(), rays.sample[i], 0u);
+            Statistics::count(Statistics::Counter::REFRACTION_RAYS);
+        }
+    }
+}
+
+void Wavefront::_spawnReflections(RayStream& rays, bool primary, RayStream& spawned)
+{
+    // Select the rays that are reflected and get the normals at their intersections
+    _reflectedRays.clear();
+    _normalX.clear();
+    _normalY.clear();
+    _normalZ.clear();
+
+    for (size_t i = 0; i < rays.size(); ++i)
+    {
+        auto* object = rays.intersected[i];
+
+        // Refraction rays are not reflected, a ray that does not hit anything stops the reflections
+        if (object == nullptr || (!primary && rays.depth[i] == 0u))
+            continue;
+
+        const auto nextDepth = primary ? 1u : rays.depth[i] + 1u;
+
+        if (nextDepth >= _sampleMaxReflection[rays.sample[i]])
+            continue;
+
+        // The first reflection is always traced, the next ones only if the chain of the sample goes on
+        if (!primary && !_sampleReflections[rays.sample[i]].next(rays.intersection(i), rays.depth[i], _sampleMaxReflection[rays.sample[i]]))
+            continue;
+
+        const Vector normal(object->normal(rays.intersection(i)));
+
+        _reflectedRays.push_back(i);
+        _normalX.push_back(normal.x());
+        _normalY.push_back(normal.y());
+        _normalZ.push_back(normal.z());
+    }
+
+    if (_reflectedRays.empty())
+        return;
+
+    // Calculate the reflected rays
+    const auto first = spawned.size();
+    const auto count = _reflectedRays.size();
+
+    spawned.originX.resize(first + count);
+    spawned.originY.resize(first + count);
+    spawned.originZ.resize(first + count);
+    spawned.directionX.resize(first + count);
+    spawned.directionY.resize(first + count);
+    spawned.directionZ.resize(first + count);
+    spawned.length.resize(first + count, Ray().length());
+    spawned.intersected.resize(first + count);
+    spawned.sample.resize(first + count);
+    spawned.depth.resize(first + count);
+
+    for (size_t k = 0; k < count; ++k)
+    {
+        const auto i = _reflectedRays[k];
+
+        spawned.intersected[first + k] = rays.intersected[i];
+        spawned.sample[first + k]      = rays.sample[i];
+        spawned.depth[first + k]       = primary ? 1u : rays.depth[i] + 1u;
+
+        Statistics::count(Statistics::Counter::REFLECTION_DEPTH, spawned.depth[first + k]);
+    }
+
+    Statistics::count(Statistics::Counter::REFLECTION_RAYS, count);
+
+    // Only arithmetic on contiguous arrays from here
+    for (size_t k = 0; k < count; ++k)
+    {
+        const auto i = _reflectedRays[k];
+
+        const Real   length = rays.length[i];
+        const Real   dX     = rays.directionX[i];
+        const Real   dY     = rays.directionY[i];
+        const Real   dZ     = rays.directionZ[i];
+
+        spawned.originX[first + k] = rays.originX[i] + dX * length;
+        spawned.originY[first + k] = rays.originY[i] + dY * length;
+        spawned.originZ[first + k] = rays.originZ[i] + dZ * length;
+
+        const Real   reflet = (dX * _normalX[k] + dY * _normalY[k] + dZ * _normalZ[k]) * Real{ 2.0 };
+
+        spawned.directionX[first + k] = dX - _normalX[k] * reflet;
+        spawned.directionY[first + k] = dY - _normalY[k] * reflet;
+        spawned.directionZ[first + k] = dZ - _normalZ[k] * reflet;
+    }
+}
+
+void Wavefront::_sort(RayStream& rays)
+{
+    const auto count = rays.size();
+
+    // Not worth it for a few rays
+    if (count < _minRaysToSort)
+        return;
+
+    // Bounds of the origins of the rays
+    const auto [minX, maxX] = minmax_element(rays.originX.begin(), rays.originX.end());
+    const auto [minY, maxY] = minmax_element(rays.originY.begin(), rays.originY.end());
+    const auto [minZ, maxZ] = minmax_element(rays.originZ.begin(), rays.originZ.end());
+
+    const auto scale = [](double minimum, double maximum) { return (maximum > minimum) ? 1024.0 / (maximum - minimum) : 0.0; };
+
+    const double scaleX = scale(*minX, *maxX);
+    const double scaleY = scale(*minY, *maxY);
+    const double scaleZ = scale(*minZ, *maxZ);
+
+    // The direction octant is in the highest bits so that the rays going in the same direction are together, then the 30 bits Morton code of
+    // the origin keeps close origins together
+    _sortKeys.resize(count);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        const uint64_t octant = (rays.directionX[i] < Real{ 0.0 } ? 1u : 0u) | (rays.directionY[i] < Real{ 0.0 } ? 2u : 0u)
+                                | (rays.directionZ[i] < Real{ 0.0 } ? 4u : 0u);
+        const uint64_t morton = spreadBits(cell(rays.originX[i], *minX, scaleX)) | (spreadBits(cell(rays.originY[i], *minY, scaleY)) << 1u)
+                                     | (spreadBits(cell(rays.originZ[i], *minZ, scaleZ)) << 2u);
+
+        _sortKeys[i] = { (octant << 30u) | morton, i };
+    }
+
+    sort(_sortKeys.begin(), _sortKeys.end());
+
+    // Every ray keeps the index of its sample, the order of the stream does not change where its color goes
+    _sortedRays.clear();
+    _sortedRays.reserve(count);
+
+    for (const auto& [key, index] : _sortKeys)
+        _sortedRays.push(rays, index);
+
+    rays.swap(_sortedRays);
+}
+
+void Wavefront::_resolve(void)
+{
+    const auto toneMapSamples = (_sampling != Sampling::APERTURE);
+
+    size_t sample = 0u;
+    while (sample < _samplePixel.size())
+    {
+        const auto pixel = _samplePixel[sample];
+
+        Color pixelColor(0.0);
+
+        // The samples of a pixel are contiguous
+        for (; sample < _samplePixel.size() && _samplePixel[sample] == pixel; ++sample)
+        {
+            // Final color equals the sum of all the components
+            const double* colors = _sampleColors.data() + sample * sampleColorSize;
+
+            Color sampleColor(colors[ambientOffset] + colors[diffusionOffset] + colors[reflectionOffset] + colors[refractionOffset],
+                              colors[ambientOffset + 1] + colors[diffusionOffset + 1] + colors[reflectionOffset + 1] + colors[refractionOffset + 1],
+                              colors[ambientOffset + 2] + colors[diffusionOffset + 2] + colors[reflectionOffset + 2] + colors[refractionOffset + 2]);
+
+            if (toneMapSamples && _sampleHit[sample] != 0u)
+                sampleColor = toneMapping(sampleColor);
+
+            pixelColor += sampleColor * _sampleWeight[sample];
+        }
+
+        if (!toneMapSamples)
+            pixelColor = toneMapping(pixelColor);
+
+        const unsigned int bufferJ = pixel / _buffer.width();
+        const unsigned int bufferI = pixel - bufferJ * _buffer.width();
+
+        _buffer.pixel(bufferI, bufferJ, pixelColor);
+    }
+}
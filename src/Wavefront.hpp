@@ -0,0 +1,155 @@
+//===============================================================================================//
+/*!
+ *  \file      Wavefront.hpp
+ *  \author    Loïc Corenthy
+ *  \version   1.2
+ *  \date      19/10/2026
+ *  \copyright (c) 2026 Loïc Corenthy. All rights reserved.
+ */
+//===============================================================================================//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "Color.hpp"
+#include "RayStream.hpp"
+#include "ReflectionChain.hpp"
+
+namespace LCNS
+{
+    // Forward declaration
+    class AOVBuffer;
+    class Buffer;
+    class Scene;
+
+    /// Wavefront rendering pipeline. Instead of following the whole ray tree of a pixel before moving to the next one, all the rays of a range
+    /// of pixels go through the same stage before the next stage starts:
+    ///   - generate: create the samples of every pixel and their primary rays
+    ///   - extend: find the closest intersection of every ray of a stream
+    ///   - shadow: calculate the intensity of each light at every intersection, one light at a time
+    ///   - shade: calculate the color of the intersections and accumulate it in their sample
+    ///   - spawn: create the refraction and reflection rays of the intersections
+    ///   - sort: group the secondary rays with close origins and similar directions (optional)
+    ///   - resolve: combine the samples and write the pixels in the buffer
+    /// Extend, shadow, shade and spawn are repeated until there are no more secondary rays. The result is the same as the depth first rendering.
+    class Wavefront
+    {
+    public:
+        /// Constructor with parameters, the pipeline writes the pixels it renders in the buffer
+        Wavefront(Scene& scene, Buffer& buffer, const Color& meanLight, bool superSampling);
+
+        /// Copy constructor (copy not allowed)
+        Wavefront(const Wavefront& wavefront) = delete;
+
+        /// Copy operator (copy not allowed)
+        Wavefront operator=(const Wavefront& wavefront) = delete;
+
+        /// Destructor
+        ~Wavefront(void) = default;
+
+        /// Render the pixels in the range [startIndex, endIndex[ (pixels are numbered row by row)
+        void render(unsigned int startIndex, unsigned int endIndex);
+
+        /// Activate or not the sorting of the secondary rays before they are traced
+        void sortSecondaryRays(bool activate) noexcept;
+
+        /// Set the contribution under which the reflections of a sample stop and whether the Russian roulette is used (see ReflectionChain)
+        void terminateReflections(double threshold, bool russianRoulette) noexcept;
+
+        /// Add the first intersection of each sample to the AOVs of its pixel (the buffer must outlive the pipeline)
+        void recordAOVs(AOVBuffer& aovBuffer) noexcept;
+
+    private:
+        /// How the samples of a pixel are created and combined
+        enum class Sampling
+        {
+            APERTURE,
+            SUPER_SAMPLING,
+            SINGLE
+        };
+
+    private:
+        /// Render the pixels in the range [startIndex, endIndex[ in one pass through the stages
+        void _renderPass(unsigned int startIndex, unsigned int endIndex);
+
+        /// Add a sample to the current batch
+        void _addSample(unsigned int pixel, double weight, const Ray& primaryRay);
+
+        /// Create the samples of the pixels and their primary rays
+        void _generate(unsigned int startIndex, unsigned int endIndex);
+
+        /// Find the closest intersection of all the rays of a stream
+        void _extend(RayStream& rays);
+
+        /// Calculate the intensity of every light at the intersections of a stream
+        void _shadow(RayStream& rays);
+
+        /// Calculate the ambient and diffusion colors of the primary rays and the background of the ones that missed, and record their AOVs
+        void _shadePrimary(RayStream& rays);
+
+        /// Accumulate the refraction and reflection colors of secondary rays
+        void _shadeSecondary(RayStream& rays);
+
+        /// Create the refraction rays of the primary intersections
+        void _spawnRefractions(RayStream& rays, RayStream& spawned);
+
+        /// Create the next reflection rays from the intersections of a stream
+        void _spawnReflections(RayStream& rays, bool primary, RayStream& spawned);
+
+        /// Sort the rays of a stream by direction octant and by the Morton code of the cell containing their origin
+        void _sort(RayStream& rays);
+
+        /// Combine the samples of each pixel and write the pixels in the buffer
+        void _resolve(void);
+
+    private:
+        static constexpr unsigned int _maxPixelsPerPass = 1024u;
+        static constexpr std::size_t  _minRaysToSort    = 64u;
+
+    private:
+        Scene&     _scene;
+        Buffer&    _buffer;
+        Color      _meanLight;
+        Sampling   _sampling;
+        bool       _sortSecondaryRays   = false;
+        double     _reflectionThreshold = 0.0;
+        bool       _russianRoulette     = false;
+        AOVBuffer* _aovBuffer           = nullptr;
+
+        // Rays processed by the current stage and rays spawned for the next one
+        RayStream _rays;
+        RayStream _spawnedRays;
+
+        // Intensities of the lights at the intersections of the current stream, light intensities of ray i start at index i * light count
+        std::vector<Color> _lightIntensities;
+
+        // Weights of the lights selected by the light tree, same layout as the intensities, only used when the tree culls or samples lights
+        std::vector<double> _lightWeights;
+        std::vector<double> _selectedLights;
+
+        // Samples of the current batch. The ambient, diffusion, reflection and refraction colors of a sample are stored one after the other in
+        // _sampleColors, a sample that does not hit any object only stores the background color as its ambient color
+        std::vector<unsigned int>    _samplePixel;
+        std::vector<double>          _sampleWeight;
+        std::vector<unsigned char>   _sampleHit;
+        std::vector<unsigned short>  _sampleMaxReflection;
+        std::vector<ReflectionChain> _sampleReflections;
+        std::vector<double>          _sampleColors;
+
+        // Scratch memory of the reflection stage
+        std::vector<std::size_t> _reflectedRays;
+        std::vector<Real>        _normalX;
+        std::vector<Real>        _normalY;
+        std::vector<Real>        _normalZ;
+
+        // Scratch memory of the sorting stage
+        std::vector<std::pair<std::uint64_t, std::size_t>> _sortKeys;
+        RayStream                                          _sortedRays;
+
+    };  // class Wavefront
+
+}  // namespace LCNS
@@ -25,43 +25,207 @@
     #include <string>
 #endif
 
+#include <algorithm>
+#include <cstring>
 #include <memory>
 #include <limits>
+#include <stdexcept>
+#include <string>
 
+#include "Camera.hpp"
+#include "CostBuffer.hpp"
 #include "CreateScenes.hpp"
+#include "Denoiser.hpp"
 #include "Renderer.hpp"
 #include "Scene.hpp"
+#include "SceneFile.hpp"
+#include "TextureCache.hpp"
+#include "Tile.hpp"
+#include "TileCoordinator.hpp"
+#include "TileWorker.hpp"
+#include "Trace.hpp"
 
 using std::cerr;
+using std::clamp;
 using std::cout;
 using std::endl;
 using std::make_shared;
+using std::max;
 using std::numeric_limits;
+using std::runtime_error;
+using std::min;
 using std::shared_ptr;
+using std::size_t;
+using std::stoul;
+using std::string;
+using std::to_string;
 
 using LCNS::Buffer;
+using LCNS::Camera;
+using LCNS::CostBuffer;
+using LCNS::Denoiser;
 using LCNS::Renderer;
 using LCNS::Scene;
+using LCNS::SceneFile;
+using LCNS::TextureCache;
+using LCNS::Tile;
+using LCNS::TileCoordinator;
+using LCNS::TileWorker;
+using LCNS::toReal;
+using LCNS::Trace;
+using LCNS::TraceScope;
+using LCNS::Vector;
 
 struct SceneParameters
 {
-    unsigned int sceneIndex   = numeric_limits<unsigned int>::max();
-    unsigned int windowWidth  = 800u;
-    unsigned int windowHeight = 600u;
-    unsigned int windowXPos   = 0u;
-    unsigned int windowYPos   = 0u;
+    unsigned int sceneIndex       = numeric_limits<unsigned int>::max();
+    string       sceneFile;                 ///< Scene described in a JSON file, instead of a scene of CreateScenes.cpp
+    unsigned int windowWidth      = 800u;
+    unsigned int windowHeight     = 600u;
+    unsigned int windowXPos       = 0u;
+    unsigned int windowYPos       = 0u;
+    string       costFile         = "cost.png";
+    string       aovFile;                   ///< Path of the images of the AOVs (with the name of each AOV added), empty not to write them
+    int          denoiseCount     = 0;      ///< Iterations of the denoiser, checked before being given to the Renderer (may be negative)
+    string       traceFile;
+    bool         sequence         = false;
+    unsigned int firstFrame       = 0u;
+    unsigned int lastFrame        = 0u;
+    double       fps              = 24.0;
+    string       frameFile        = "frame.png";
+    unsigned int coordinatorPort  = 0u;
+    string       coordinator;
+    unsigned int tileSize         = 64u;
+    string       checkpointFile;
+    double       checkpointPeriod = 60.0;
+    bool         resume           = false;
+    Tile         cropWindow;                ///< From the top left corner of the image, empty to render the whole image
+    bool         cropFullFrame    = false;  ///< Write the crop window in the whole image instead of alone
 };
 
+namespace
+{
+    /// Distance the camera moves at each key press
+    constexpr double cameraMoveStep = 0.5;
+
+    /// Angle (in radians) the camera turns at each key press
+    constexpr double cameraTurnStep = 2.0 * 3.141592 / 180.0;
+
+    /// Angle (in radians) the camera turns for each pixel the mouse is dragged
+    constexpr double cameraDragStep = 0.2 * 3.141592 / 180.0;
+
+    /// Limits of the field of view (in radians) when zooming
+    constexpr double minimumFOV = 5.0 * 3.141592 / 180.0;
+    constexpr double maximumFOV = 150.0 * 3.141592 / 180.0;
+
+    /// Time (in milliseconds) between two refreshes of the window while the image is rendered
+    constexpr unsigned int refreshPeriod = 100u;
+
+    /// Last position of the mouse while it is dragged with the left button
+    struct MouseDrag
+    {
+        bool active = false;
+        int  x      = 0;
+        int  y      = 0;
+    };
+
+    MouseDrag mouseDrag;
+
+    /// Check if a refresh of the window is already planned, a single chain of refreshes follows the render
+    bool refreshPlanned = false;
+
+}  // namespace
+
 SceneParameters processArguments(int argc, char** argv);
 
+/// Get the metric of the cost of the pixels from its name on the command line
+CostBuffer::Metric costMetricFromName(const string& name);
+
+/// Get the first and last frames of a sequence from the range on the command line (e.g. 0-47)
+void framesFromRange(const string& range, SceneParameters& parameters);
+
+/// Get the crop window from the command line, its column, row (from the top left corner of the image), width and height (e.g. 200,100,64,48)
+void cropFromString(const string& crop, SceneParameters& parameters);
+
+/// Get the pixels of the buffer rendered with the parameters, the crop window (the first row of the buffer is the bottom of the image) or
+/// the whole image
+Tile renderWindow(const SceneParameters& parameters);
+
+/// Write a rendered frame in a file, only the crop window unless it is written in the whole image, return false if it can not be written
+bool writeFrame(const Buffer& buffer, const SceneParameters& parameters, const string& fileName);
+
+/// Get the file of a frame, its number is added before the extension of the file of the sequence (e.g. frame_0012.png)
+string frameFileName(const string& sequenceFile, unsigned int frame);
+
+/// Render the frames of a sequence one after the other and write them in files, the scene is only created once. Return false if one of the
+/// frames can not be written (the next frames are still rendered).
+bool renderSequence(Scene& scene, const SceneParameters& parameters);
+
+/// Get the description of the frame rendered with the parameters, the workers of a distributed render must render the same frame as the
+/// coordinator
+string frameDescription(const SceneParameters& parameters);
+
+/// Hand the tiles of the frame to the worker processes and write the frame in the frame file once all of them are rendered, return false if
+/// the frame could not be rendered or written
+bool coordinateTiles(const SceneParameters& parameters);
+
+/// Render the tiles handed over by the coordinator, return false if the connection failed or was lost
+bool renderTiles(const SceneParameters& parameters);
+
+/// Cancel the render in progress, change the camera, then render the image again from the new point of view (the scene stays in memory)
+template<typename CameraUpdate>
+void updateCamera(CameraUpdate cameraUpdate);
+
+/// Move the camera forward, to the right of the image and upward
+void moveCamera(double forward, double right, double upward);
+
+/// Keys W, S, A, D, Q and E move the camera, + and - zoom in and out
+void keyboard(unsigned char key, int x, int y);
+
+/// Arrow keys turn the camera
+void specialKeyboard(int key, int x, int y);
+
+/// Start or stop dragging the mouse with the left button
+void mouseButton(int button, int state, int x, int y);
+
+/// Dragging the mouse with the left button turns the camera
+void mouseMotion(int x, int y);
+
+/// Redraw the window, and again after a while if the image is still being rendered
+void refreshDisplay(int value);
+
 int main(int argc, char* argv[])
 {
     auto errorMessage = [&argv]() {
         cerr << "ERROR: Please call the executable with a number between 0 and 15 as scene parameter. \nFor example: " << argv[0] << " --scene 3\n\n";
+        cerr << "Or with a scene described in a JSON file.\nFor example: " << argv[0] << " --scene-file resources/scenes/spheres.json\n\n";
         cerr << "Supersampling is optional.\nFor example: " << argv[0] << " --scene 5 --supersampling\n\n";
         cerr << "Window dimensions parameters are optional. \nFor example: " << argv[0] << " --scene 5 --width 800 --height 600\n\n";
         cerr << "Window initial position parameters are optional. \nFor example: " << argv[0] << " --scene 5 --xpos 200 --ypos 100\n\n";
-        cerr << "Multi-threading is optional.\nFor example: " << argv[0] << " --scene 5 --multithreading" << endl;
+        cerr << "Multi-threading is optional.\nFor example: " << argv[0] << " --scene 5 --multithreading\n\n";
+        cerr << "Wavefront rendering is optional, its secondary rays can be sorted.\nFor example: " << argv[0] << " --scene 5 --wavefront --sort-rays\n\n";
+        cerr << "Texture cache memory budget (in MB) is optional.\nFor example: " << argv[0] << " --scene 5 --texture-cache-mb 512\n\n";
+        cerr << "Light culling and light sampling are optional.\nFor example: " << argv[0] << " --scene 5 --light-threshold 0.01 --light-samples 8\n\n";
+        cerr << "The reflections can stop when they are expected to change the pixel by less than a threshold (an estimate, not a bound), or go "
+             << "on randomly (Russian roulette, only with a threshold).\n"
+             << "For example: " << argv[0] << " --scene 12 --reflection-threshold 0.004 --russian-roulette\n\n";
+        cerr << "A frame rendered with few samples can be denoised (number of iterations of the filter, up to 10), the normal, albedo, depth and "
+                "object of its pixels guiding the filter can be written in images.\nFor example: "
+             << argv[0] << " --scene 12 --supersampling --denoise 5 --aov-file aov.png\n\n";
+        cerr << "The cost of each pixel (time, rays or tests) can be written as a false color image or as raw floats (.raw file).\nFor example: "
+             << argv[0] << " --scene 5 --cost-map time --cost-file cost.png\n\n";
+        cerr << "A timeline of the scene construction and of the render can be written in the Chrome trace event format.\nFor example: " << argv[0]
+             << " --scene 5 --trace trace.json\n\n";
+        cerr << "A range of frames of an animated scene can be rendered in files instead of the window.\nFor example: " << argv[0]
+             << " --scene 11 --frames 0-47 --fps 24 --frame-file frame.png\n\n";
+        cerr << "A frame can be split in tiles rendered by worker processes started with the same options, here or on other machines.\nFor example: "
+             << argv[0] << " --scene 14 --coordinator 7070 --tile-size 64 --frame-file frame.png\nand " << argv[0]
+             << " --scene 14 --worker coordinator-host:7070\n\n";
+        cerr << "The pixels rendered so far can be saved in a checkpoint file, periodically (in seconds), to resume a render that was stopped.\n"
+             << "For example: " << argv[0] << " --scene 14 --checkpoint frame.checkpoint --checkpoint-period 60 --resume\n\n";
+        cerr << "A crop window (column, row from the top left corner, width and height) can be rendered alone and written in the frame file, "
+                "cropped or in the whole frame.\nFor example: "
+             << argv[0] << " --scene 14 --crop 200,100,64,48 --crop-full-frame --frame-file frame.png" << endl;
     };
 
     if (argc < 2)
@@ -73,86 +237,212 @@ int main(int argc, char* argv[])
     // Parameters to the executable
     const auto sceneParemeters = processArguments(argc, argv);
 
-    if (15 < sceneParemeters.sceneIndex)
+    if (sceneParemeters.sceneFile.empty() && 15 < sceneParemeters.sceneIndex)
     {
         errorMessage();
         return EXIT_FAILURE;
     }
 
-    glutInit(&argc, argv);
-    glutInitDisplayMode(GLUT_DOUBLE | GLUT_RGB | GLUT_DEPTH);
+    if (const auto& crop = sceneParemeters.cropWindow;
+        crop.x + crop.width > sceneParemeters.windowWidth || crop.y + crop.height > sceneParemeters.windowHeight)
+    {
+        cerr << "The crop window is not inside the " << sceneParemeters.windowWidth << "x" << sceneParemeters.windowHeight << " image" << endl;
+        return EXIT_FAILURE;
+    }
+
+    if (sceneParemeters.denoiseCount < 0 || static_cast<int>(Denoiser::maxIterationCount) < sceneParemeters.denoiseCount)
+    {
+        cerr << "The number of iterations of the denoiser should be between 0 and " << Denoiser::maxIterationCount << endl;
+        return EXIT_FAILURE;
+    }
+
+    Renderer::setDenoising(static_cast<unsigned int>(sceneParemeters.denoiseCount));
 
-    // Init window position and size,
-    glutInitWindowPosition(static_cast<int>(sceneParemeters.windowXPos), static_cast<int>(sceneParemeters.windowYPos));
-    glutInitWindowSize(static_cast<int>(sceneParemeters.windowWidth), static_cast<int>(sceneParemeters.windowHeight));
+    // The Russian roulette only decides the fate of the reflections under the threshold
+    if (Renderer::isRussianRouletteActive() && Renderer::reflectionThreshold() <= 0.0)
+    {
+        cerr << "The Russian roulette needs a reflection threshold, e.g. --reflection-threshold 0.004 --russian-roulette" << endl;
+        return EXIT_FAILURE;
+    }
 
-    glutCreateWindow("Ray tracing window");
+    // The coordinator of a distributed render only owns the image, the workers create the scene and render its tiles
+    if (sceneParemeters.coordinatorPort != 0u)
+        return coordinateTiles(sceneParemeters) ? EXIT_SUCCESS : EXIT_FAILURE;
+
+    // The workers run on machines without display
+    const bool isWorker = !sceneParemeters.coordinator.empty();
+
+    if (!isWorker)
+    {
+        glutInit(&argc, argv);
+        glutInitDisplayMode(GLUT_DOUBLE | GLUT_RGB | GLUT_DEPTH);
+
+        // Init window position and size,
+        glutInitWindowPosition(static_cast<int>(sceneParemeters.windowXPos), static_cast<int>(sceneParemeters.windowYPos));
+        glutInitWindowSize(static_cast<int>(sceneParemeters.windowWidth), static_cast<int>(sceneParemeters.windowHeight));
+
+        glutCreateWindow("Ray tracing window");
+    }
 
     shared_ptr<Scene> scene = make_shared<Scene>();
 
-    // Setup the scene
-    switch (sceneParemeters.sceneIndex)
+    // Setup the scene, from the scene file or from one of the scenes of CreateScenes.cpp
+    if (!sceneParemeters.sceneFile.empty())
     {
-        case 0:
-            createTestScene(scene);
-            break;
-        case 1:
-            createScene01(scene);
-            break;
-        case 2:
-            createScene02(scene);
-            break;
-        case 3:
-            createScene03(scene);
-            break;
-        case 4:
-            createScene04(scene);
-            break;
-        case 5:
-            createScene04bis(scene);
-            break;
-        case 6:
-            createScene05(scene);
-            break;
-        case 7:
-            createScene06(scene);
-            break;
-        case 8:
-            createScene07(scene);
-            break;
-        case 9:
-            createScene08(scene);
-            break;
-        case 10:
-            createScene09(scene);
-            break;
-        case 11:
-            createScene10(scene);
-            break;
-        case 12:
-            createScene11(scene);
-            break;
-        case 13:
-            createScene12(scene);
-            break;
-        case 14:
-            createScene13(scene);
-            break;
-        case 15:
-            createScene14(scene);
-            break;
-        default:
-            assert(false && "We should never reach here");
-            break;
+        try
+        {
+            SceneFile(sceneParemeters.sceneFile).create(scene);
+        }
+        catch (const runtime_error& error)
+        {
+            cerr << "ERROR: " << error.what() << endl;
+            return EXIT_FAILURE;
+        }
+    }
+    else
+    {
+        TraceScope traceScope("createScene", "scene", "scene", sceneParemeters.sceneIndex);
+
+        switch (sceneParemeters.sceneIndex)
+        {
+            case 0:
+                createTestScene(scene);
+                break;
+            case 1:
+                createScene01(scene);
+                break;
+            case 2:
+                createScene02(scene);
+                break;
+            case 3:
+                createScene03(scene);
+                break;
+            case 4:
+                createScene04(scene);
+                break;
+            case 5:
+                createScene04bis(scene);
+                break;
+            case 6:
+                createScene05(scene);
+                break;
+            case 7:
+                createScene06(scene);
+                break;
+            case 8:
+                createScene07(scene);
+                break;
+            case 9:
+                createScene08(scene);
+                break;
+            case 10:
+                createScene09(scene);
+                break;
+            case 11:
+                createScene10(scene);
+                break;
+            case 12:
+                createScene11(scene);
+                break;
+            case 13:
+                createScene12(scene);
+                break;
+            case 14:
+                createScene13(scene);
+                break;
+            case 15:
+                createScene14(scene);
+                break;
+            default:
+                assert(false && "We should never reach here");
+                break;
+        }
     }
 
     // Send the scene to the renderer
     Renderer::setScene(scene, sceneParemeters.windowWidth, sceneParemeters.windowHeight);
 
-    // Render the scene
+    // The tiles of a worker are chosen by the coordinator
+    if (!isWorker && sceneParemeters.cropWindow.pixelCount() != 0u)
+        Renderer::setCropWindow(renderWindow(sceneParemeters));
+
+    // Render the scene, each frame of the sequence, or the tiles handed over by the coordinator
     Renderer::displayRenderTime(true);
-    Renderer::render();
 
+    bool succeeded = true;
+
+    if (isWorker)
+        succeeded = renderTiles(sceneParemeters);
+    else if (sceneParemeters.sequence)
+        succeeded = renderSequence(*scene, sceneParemeters);
+    else
+    {
+        if (!sceneParemeters.checkpointFile.empty())
+        {
+            Renderer::setCheckpoint(
+            sceneParemeters.checkpointFile, frameDescription(sceneParemeters), sceneParemeters.checkpointPeriod, sceneParemeters.resume);
+        }
+
+        // The scene is committed by the render, which throws if one of its assets cannot be loaded
+        try
+        {
+            Renderer::render();
+        }
+        catch (const runtime_error& error)
+        {
+            cerr << "ERROR: " << error.what() << endl;
+            return EXIT_FAILURE;
+        }
+
+        // The renders after a change of the camera are not saved in the checkpoint of the frame
+        Renderer::setCheckpoint(string(), string(), sceneParemeters.checkpointPeriod, false);
+
+        // The crop window is only rendered to be compared or merged with the frame, it is written before being displayed
+        if (sceneParemeters.cropWindow.pixelCount() != 0u)
+            succeeded = writeFrame(Renderer::getBuffer(), sceneParemeters, sceneParemeters.frameFile);
+    }
+
+    if (!sceneParemeters.traceFile.empty())
+    {
+        Trace::enable(false);
+
+        if (Trace::write(sceneParemeters.traceFile))
+            cout << "Trace written to " << sceneParemeters.traceFile << endl;
+        else
+            cerr << "Unable to write the trace to " << sceneParemeters.traceFile << endl;
+    }
+
+    if (Renderer::costMetric() != CostBuffer::Metric::NONE)
+    {
+        const auto& costFile = sceneParemeters.costFile;
+        const auto& costs    = Renderer::getCostBuffer();
+        const bool  isRaw    = costFile.size() >= 4u && costFile.compare(costFile.size() - 4u, 4u, ".raw") == 0;
+
+        if (isRaw ? costs.writeRaw(costFile) : costs.writeImage(costFile))
+            cout << "Pixel costs written to " << costFile << " (highest cost " << costs.maximum() << ")" << endl;
+        else
+            cerr << "Unable to write the pixel costs to " << costFile << endl;
+    }
+
+    if (!sceneParemeters.aovFile.empty())
+    {
+        if (Renderer::getAOVBuffer().write(sceneParemeters.aovFile))
+            cout << "AOVs written next to " << sceneParemeters.aovFile << endl;
+        else
+            cerr << "Unable to write the AOVs next to " << sceneParemeters.aovFile << endl;
+    }
+
+    // The frames of a sequence are only written in files, and the tiles of a worker are sent to the coordinator
+    if (isWorker || sceneParemeters.sequence)
+    {
+        if (!succeeded)
+            return EXIT_FAILURE;
+
+        cout << "Application exited successfully" << endl;
+        return EXIT_SUCCESS;
+    }
+
+    // The render threads may write the buffer while it is drawn, a pixel can then show its previous color until the next refresh
     auto display = []() {
         glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
@@ -168,6 +458,14 @@ int main(int argc, char* argv[])
     // Display loop
     glutDisplayFunc(display);
 
+    // Camera controls, the image is rendered again in the background when the camera changes (the window shows its progress)
+    glutKeyboardFunc(keyboard);
+    glutSpecialFunc(specialKeyboard);
+    glutMouseFunc(mouseButton);
+    glutMotionFunc(mouseMotion);
+
+    cout << "Camera controls: W/S forward/backward, A/D left/right, Q/E down/up, arrows or left mouse drag to turn, +/- to zoom" << endl;
+
     glutMainLoop();
 
     cout << "Application exited successfully" << endl;
@@ -187,12 +485,31 @@ SceneParameters processArguments(int argc, char** argv)
 
     auto allArguments = std::string(argv[1]);
 
-    const unsigned int parameterCount                    = 5u;
+    const unsigned int parameterCount                    = 24u;
     const std::regex   allParameterRegex[parameterCount] = { std::regex(R"(\s*--scene\s+([0-9]+))"),
                                                            std::regex(R"(\s*--width\s+([0-9]+))"),
                                                            std::regex(R"(\s*--height\s+([0-9]+))"),
                                                            std::regex(R"(\s*--xpos\s+([0-9]+))"),
-                                                           std::regex(R"(\s*--ypos\s+([0-9]+))") };
+                                                           std::regex(R"(\s*--ypos\s+([0-9]+))"),
+                                                           std::regex(R"(\s*--texture-cache-mb\s+([0-9]+))"),
+                                                           std::regex(R"(\s*--light-threshold\s+([0-9]*\.?[0-9]+))"),
+                                                           std::regex(R"(\s*--light-samples\s+([0-9]+))"),
+                                                           std::regex(R"(\s*--cost-map\s+([a-z]+))"),
+                                                           std::regex(R"(\s*--cost-file\s+(\S+))"),
+                                                           std::regex(R"(\s*--trace\s+(\S+))"),
+                                                           std::regex(R"(\s*--frames\s+([0-9]+-[0-9]+))"),
+                                                           std::regex(R"(\s*--fps\s+([0-9]*\.?[0-9]+))"),
+                                                           std::regex(R"(\s*--frame-file\s+(\S+))"),
+                                                           std::regex(R"(\s*--coordinator\s+([0-9]+))"),
+                                                           std::regex(R"(\s*--worker\s+(\S+))"),
+                                                           std::regex(R"(\s*--tile-size\s+([0-9]+))"),
+                                                           std::regex(R"(\s*--checkpoint\s+(\S+))"),
+                                                           std::regex(R"(\s*--checkpoint-period\s+([0-9]*\.?[0-9]+))"),
+                                                           std::regex(R"(\s*--crop\s+(\S+))"),
+                                                           std::regex(R"(\s*--scene-file\s+(\S+))"),
+                                                           std::regex(R"(\s*--reflection-threshold\s+([0-9]*\.?[0-9]+))"),
+                                                           std::regex(R"(\s*--denoise\s+([0-9]+))"),
+                                                           std::regex(R"(\s*--aov-file\s+(\S+))") };
 
     for (unsigned int i = 0; i < parameterCount; ++i)
     {
@@ -223,6 +540,84 @@ SceneParameters processArguments(int argc, char** argv)
                     case 4:
                         parameters.windowYPos = static_cast<unsigned int>(stoi(baseMatch[1].str()));
                         break;
+
+                    case 5:
+                        TextureCache::memoryBudget(static_cast<size_t>(stoi(baseMatch[1].str())) * 1024u * 1024u);
+                        break;
+
+                    case 6:
+                        Renderer::setLightThreshold(stod(baseMatch[1].str()));
+                        break;
+
+                    case 7:
+                        Renderer::setLightSampleCount(static_cast<unsigned int>(stoi(baseMatch[1].str())));
+                        break;
+
+                    case 8:
+                        Renderer::setCostMetric(costMetricFromName(baseMatch[1].str()));
+                        break;
+
+                    case 9:
+                        parameters.costFile = baseMatch[1].str();
+                        break;
+
+                    case 10:
+                        parameters.traceFile = baseMatch[1].str();
+                        Trace::enable(true);
+                        break;
+
+                    case 11:
+                        framesFromRange(baseMatch[1].str(), parameters);
+                        break;
+
+                    case 12:
+                        parameters.fps = stod(baseMatch[1].str());
+                        break;
+
+                    case 13:
+                        parameters.frameFile = baseMatch[1].str();
+                        break;
+
+                    case 14:
+                        parameters.coordinatorPort = static_cast<unsigned int>(stoi(baseMatch[1].str()));
+                        break;
+
+                    case 15:
+                        parameters.coordinator = baseMatch[1].str();
+                        break;
+
+                    case 16:
+                        parameters.tileSize = static_cast<unsigned int>(stoi(baseMatch[1].str()));
+                        break;
+
+                    case 17:
+                        parameters.checkpointFile = baseMatch[1].str();
+                        break;
+
+                    case 18:
+                        parameters.checkpointPeriod = stod(baseMatch[1].str());
+                        break;
+
+                    case 19:
+                        cropFromString(baseMatch[1].str(), parameters);
+                        break;
+
+                    case 20:
+                        parameters.sceneFile = baseMatch[1].str();
+                        break;
+
+                    case 21:
+                        Renderer::setReflectionThreshold(stod(baseMatch[1].str()));
+                        break;
+
+                    case 22:
+                        parameters.denoiseCount = stoi(baseMatch[1].str());
+                        break;
+
+                    case 23:
+                        parameters.aovFile = baseMatch[1].str();
+                        Renderer::setAOVRecording(true);
+                        break;
                 }
             }
         }
@@ -238,6 +633,32 @@ SceneParameters processArguments(int argc, char** argv)
         Renderer::setMultiThreading(true);
     }
 
+    if (allArguments.find("--wavefront") != std::string::npos)
+    {
+        cout << "Wavefront rendering on" << '\n';
+        Renderer::setWavefront(true);
+    }
+
+    if (allArguments.find("--sort-rays") != std::string::npos)
+    {
+        Renderer::setRaySorting(true);
+    }
+
+    if (allArguments.find("--russian-roulette") != std::string::npos)
+    {
+        Renderer::setRussianRoulette(true);
+    }
+
+    if (allArguments.find("--resume") != std::string::npos)
+    {
+        parameters.resume = true;
+    }
+
+    if (allArguments.find("--crop-full-frame") != std::string::npos)
+    {
+        parameters.cropFullFrame = true;
+    }
+
     return parameters;
 }
 #else
@@ -252,6 +673,10 @@ SceneParameters processArguments(int argc, char** argv)
             parameters.sceneIndex = static_cast<unsigned int>(atoi(argv[i + 1]));
             cout << "Scene index " << parameters.sceneIndex << "\n";
         }
+        else if (strcmp(argv[i], "--scene-file") == 0)
+        {
+            parameters.sceneFile = argv[i + 1];
+        }
         else if (strcmp(argv[i], "--supersampling") == 0)
         {
             cout << "Super sampling on" << '\n';
@@ -261,6 +686,19 @@ SceneParameters processArguments(int argc, char** argv)
         {
             Renderer::setMultiThreading(true);
         }
+        else if (strcmp(argv[i], "--wavefront") == 0)
+        {
+            cout << "Wavefront rendering on" << '\n';
+            Renderer::setWavefront(true);
+        }
+        else if (strcmp(argv[i], "--sort-rays") == 0)
+        {
+            Renderer::setRaySorting(true);
+        }
+        else if (strcmp(argv[i], "--russian-roulette") == 0)
+        {
+            Renderer::setRussianRoulette(true);
+        }
         else if (strcmp(argv[i], "--width") == 0)
         {
             parameters.windowWidth = static_cast<unsigned int>(atoi(argv[i + 1]));
@@ -277,8 +715,433 @@ SceneParameters processArguments(int argc, char** argv)
         {
             parameters.windowYPos = static_cast<unsigned int>(atoi(argv[i + 1]));
         }
+        else if (strcmp(argv[i], "--texture-cache-mb") == 0)
+        {
+            TextureCache::memoryBudget(static_cast<size_t>(atoi(argv[i + 1])) * 1024u * 1024u);
+        }
+        else if (strcmp(argv[i], "--light-threshold") == 0)
+        {
+            Renderer::setLightThreshold(atof(argv[i + 1]));
+        }
+        else if (strcmp(argv[i], "--light-samples") == 0)
+        {
+            Renderer::setLightSampleCount(static_cast<unsigned int>(atoi(argv[i + 1])));
+        }
+        else if (strcmp(argv[i], "--reflection-threshold") == 0)
+        {
+            Renderer::setReflectionThreshold(atof(argv[i + 1]));
+        }
+        else if (strcmp(argv[i], "--denoise") == 0)
+        {
+            parameters.denoiseCount = atoi(argv[i + 1]);
+        }
+        else if (strcmp(argv[i], "--aov-file") == 0)
+        {
+            parameters.aovFile = argv[i + 1];
+            Renderer::setAOVRecording(true);
+        }
+        else if (strcmp(argv[i], "--cost-map") == 0)
+        {
+            Renderer::setCostMetric(costMetricFromName(argv[i + 1]));
+        }
+        else if (strcmp(argv[i], "--cost-file") == 0)
+        {
+            parameters.costFile = argv[i + 1];
+        }
+        else if (strcmp(argv[i], "--trace") == 0)
+        {
+            parameters.traceFile = argv[i + 1];
+            Trace::enable(true);
+        }
+        else if (strcmp(argv[i], "--frames") == 0)
+        {
+            framesFromRange(argv[i + 1], parameters);
+        }
+        else if (strcmp(argv[i], "--fps") == 0)
+        {
+            parameters.fps = atof(argv[i + 1]);
+        }
+        else if (strcmp(argv[i], "--frame-file") == 0)
+        {
+            parameters.frameFile = argv[i + 1];
+        }
+        else if (strcmp(argv[i], "--coordinator") == 0)
+        {
+            parameters.coordinatorPort = static_cast<unsigned int>(atoi(argv[i + 1]));
+        }
+        else if (strcmp(argv[i], "--worker") == 0)
+        {
+            parameters.coordinator = argv[i + 1];
+        }
+        else if (strcmp(argv[i], "--tile-size") == 0)
+        {
+            parameters.tileSize = static_cast<unsigned int>(atoi(argv[i + 1]));
+        }
+        else if (strcmp(argv[i], "--checkpoint") == 0)
+        {
+            parameters.checkpointFile = argv[i + 1];
+        }
+        else if (strcmp(argv[i], "--checkpoint-period") == 0)
+        {
+            parameters.checkpointPeriod = atof(argv[i + 1]);
+        }
+        else if (strcmp(argv[i], "--resume") == 0)
+        {
+            parameters.resume = true;
+        }
+        else if (strcmp(argv[i], "--crop") == 0)
+        {
+            cropFromString(argv[i + 1], parameters);
+        }
+        else if (strcmp(argv[i], "--crop-full-frame") == 0)
+        {
+            parameters.cropFullFrame = true;
+        }
     }
 
     return parameters;
 }
 #endif
+
+CostBuffer::Metric costMetricFromName(const string& name)
+{
+    if (name == "time")
+        return CostBuffer::Metric::TIME;
+
+    if (name == "rays")
+        return CostBuffer::Metric::RAYS;
+
+    if (name == "tests")
+        return CostBuffer::Metric::INTERSECTION_TESTS;
+
+    cerr << "Unknown pixel cost " << name << ", it should be time, rays or tests" << '\n';
+    return CostBuffer::Metric::NONE;
+}
+
+void framesFromRange(const string& range, SceneParameters& parameters)
+{
+    const auto separator = range.find('-');
+    if (separator == string::npos)
+    {
+        cerr << "Invalid range of frames " << range << ", it should be the first and the last frame separated by -, e.g. 0-47" << '\n';
+        return;
+    }
+
+    parameters.sequence   = true;
+    parameters.firstFrame = static_cast<unsigned int>(stoul(range.substr(0u, separator)));
+    parameters.lastFrame  = max(parameters.firstFrame, static_cast<unsigned int>(stoul(range.substr(separator + 1u))));
+}
+
+void cropFromString(const string& crop, SceneParameters& parameters)
+{
+    // Four numbers separated by commas
+    Tile          window;
+    unsigned int* values[] = { &window.x, &window.y, &window.width, &window.height };
+    size_t        start    = 0u;
+    bool          isValid  = true;
+
+    for (auto* value : values)
+    {
+        const auto end = min(crop.find(',', start), crop.size());
+        if (start >= end || crop.find_first_not_of("0123456789", start) < end)
+        {
+            isValid = false;
+            break;
+        }
+
+        *value = static_cast<unsigned int>(stoul(crop.substr(start, end - start)));
+        start  = end + 1u;
+    }
+
+    if (!isValid || start != crop.size() + 1u || window.pixelCount() == 0u)
+    {
+        cerr << "Invalid crop window " << crop << ", it should be its column, row, width and height separated by commas, e.g. 200,100,64,48"
+             << '\n';
+        return;
+    }
+
+    parameters.cropWindow = window;
+}
+
+Tile renderWindow(const SceneParameters& parameters)
+{
+    const auto& crop = parameters.cropWindow;
+    if (crop.pixelCount() == 0u)
+        return Tile{ 0u, 0u, parameters.windowWidth, parameters.windowHeight };
+
+    // The rows of the crop window are counted from the top of the image, the ones of the buffer from the bottom
+    return Tile{ crop.x, parameters.windowHeight - crop.y - crop.height, crop.width, crop.height };
+}
+
+bool writeFrame(const Buffer& buffer, const SceneParameters& parameters, const string& fileName)
+{
+    const bool isCropped = parameters.cropWindow.pixelCount() != 0u && !parameters.cropFullFrame;
+
+    if (!(isCropped ? buffer.crop(renderWindow(parameters)).write(fileName) : buffer.write(fileName)))
+    {
+        cerr << "Unable to write the frame to " << fileName << endl;
+        return false;
+    }
+
+    cout << "Frame written to " << fileName << endl;
+    return true;
+}
+
+string frameFileName(const string& sequenceFile, unsigned int frame)
+{
+    string number = to_string(frame);
+    number.insert(0u, number.size() < 4u ? 4u - number.size() : 0u, '0');
+
+    // The extension is after the last dot of the name of the file, not of its directories
+    const auto nameStart = sequenceFile.find_last_of("/\\");
+    auto       extension = sequenceFile.find_last_of('.');
+    if (extension == string::npos || (nameStart != string::npos && extension < nameStart))
+        extension = sequenceFile.size();
+
+    return sequenceFile.substr(0u, extension) + "_" + number + sequenceFile.substr(extension);
+}
+
+bool renderSequence(Scene& scene, const SceneParameters& parameters)
+{
+    if (parameters.fps <= 0.0)
+    {
+        cerr << "The number of frames per second must be positive" << endl;
+        return false;
+    }
+
+    cout << "Rendering frames " << parameters.firstFrame << " to " << parameters.lastFrame << " at " << parameters.fps << " frames per second"
+         << endl;
+
+    bool succeeded = true;
+
+    for (unsigned int frame = parameters.firstFrame; frame <= parameters.lastFrame; ++frame)
+    {
+        TraceScope traceScope("frame", "render", "frame", frame);
+
+        // Each frame has its own checkpoint, named after the checkpoint file like the frame files
+        if (!parameters.checkpointFile.empty())
+        {
+            Renderer::setCheckpoint(frameFileName(parameters.checkpointFile, frame),
+                                    frameDescription(parameters) + " frame " + to_string(frame) + " at " + to_string(parameters.fps) + " fps",
+                                    parameters.checkpointPeriod,
+                                    parameters.resume);
+        }
+
+        // The first frame commits the scene, the next ones only move the animated objects and refit the hierarchy around them
+        scene.time(static_cast<double>(frame) / parameters.fps);
+
+        try
+        {
+            Renderer::render();
+        }
+        catch (const runtime_error& error)
+        {
+            cerr << "ERROR: " << error.what() << endl;
+            return false;
+        }
+
+        succeeded = writeFrame(Renderer::getBuffer(), parameters, frameFileName(parameters.frameFile, frame)) && succeeded;
+    }
+
+    return succeeded;
+}
+
+string frameDescription(const SceneParameters& parameters)
+{
+    // Only the options changing the pixels, the workers can use any number of threads or the wavefront pipeline
+    string frame = parameters.sceneFile.empty() ? "scene " + to_string(parameters.sceneIndex) : "scene file " + parameters.sceneFile;
+    frame += " " + to_string(parameters.windowWidth) + "x" + to_string(parameters.windowHeight);
+
+    if (Renderer::isSuperSamplingActive())
+        frame += " supersampling";
+
+    if (Renderer::lightThreshold() > 0.0)
+        frame += " light threshold " + to_string(Renderer::lightThreshold());
+
+    if (Renderer::lightSampleCount() != 0u)
+        frame += " light samples " + to_string(Renderer::lightSampleCount());
+
+    if (Renderer::reflectionThreshold() > 0.0)
+        frame += " reflection threshold " + to_string(Renderer::reflectionThreshold());
+
+    if (Renderer::reflectionThreshold() > 0.0 && Renderer::isRussianRouletteActive())
+        frame += " russian roulette";
+
+    return frame;
+}
+
+bool coordinateTiles(const SceneParameters& parameters)
+{
+    if (parameters.coordinatorPort > numeric_limits<unsigned short>::max())
+    {
+        cerr << "Invalid port " << parameters.coordinatorPort << " for the coordinator" << endl;
+        return false;
+    }
+
+    try
+    {
+        TileCoordinator coordinator(
+        parameters.windowWidth, parameters.windowHeight, renderWindow(parameters), parameters.tileSize, frameDescription(parameters));
+
+        if (!parameters.checkpointFile.empty())
+            coordinator.checkpoint(parameters.checkpointFile, parameters.checkpointPeriod, parameters.resume);
+
+        coordinator.render(static_cast<unsigned short>(parameters.coordinatorPort));
+
+        return writeFrame(coordinator.buffer(), parameters, parameters.frameFile);
+    }
+    catch (const runtime_error& error)
+    {
+        cerr << error.what() << endl;
+        return false;
+    }
+}
+
+bool renderTiles(const SceneParameters& parameters)
+{
+    // The port is after the last colon of the address of the coordinator
+    const auto separator = parameters.coordinator.find_last_of(':');
+    const auto port      = separator != string::npos ? strtoul(parameters.coordinator.c_str() + separator + 1u, nullptr, 10) : 0ul;
+    if (port == 0ul || port > numeric_limits<unsigned short>::max())
+    {
+        cerr << "Invalid coordinator " << parameters.coordinator << ", it should be the host and the port separated by :, e.g. localhost:7070"
+             << endl;
+        return false;
+    }
+
+    try
+    {
+        TileWorker worker(frameDescription(parameters));
+        const auto tileCount = worker.render(parameters.coordinator.substr(0u, separator), static_cast<unsigned short>(port));
+
+        cout << tileCount << " tiles rendered for the coordinator" << endl;
+        return true;
+    }
+    catch (const runtime_error& error)
+    {
+        cerr << error.what() << endl;
+        return false;
+    }
+}
+
+template<typename CameraUpdate>
+void updateCamera(CameraUpdate cameraUpdate)
+{
+    Renderer::cancelRender();
+
+    cameraUpdate(Renderer::camera());
+
+    Renderer::renderProgressive();
+
+    if (!refreshPlanned)
+    {
+        refreshPlanned = true;
+        glutTimerFunc(refreshPeriod, refreshDisplay, 0);
+    }
+}
+
+void moveCamera(double forward, double right, double upward)
+{
+    updateCamera([forward, right, upward](Camera& camera) {
+        const Vector forwardDirection = Vector(camera.direction()).normalize();
+        const Vector upwardDirection  = Vector(camera.up()).normalize();
+        const Vector rightDirection   = (forwardDirection ^ upwardDirection).normalize();
+
+        camera.translate(forwardDirection * toReal(forward) + rightDirection * toReal(right) + upwardDirection * toReal(upward));
+    });
+}
+
+void keyboard(unsigned char key, [[maybe_unused]] int x, [[maybe_unused]] int y)
+{
+    switch (key)
+    {
+        case 'w':
+        case 'W':
+            moveCamera(cameraMoveStep, 0.0, 0.0);
+            break;
+        case 's':
+        case 'S':
+            moveCamera(-cameraMoveStep, 0.0, 0.0);
+            break;
+        case 'd':
+        case 'D':
+            moveCamera(0.0, cameraMoveStep, 0.0);
+            break;
+        case 'a':
+        case 'A':
+            moveCamera(0.0, -cameraMoveStep, 0.0);
+            break;
+        case 'e':
+        case 'E':
+            moveCamera(0.0, 0.0, cameraMoveStep);
+            break;
+        case 'q':
+        case 'Q':
+            moveCamera(0.0, 0.0, -cameraMoveStep);
+            break;
+        case '+':
+            updateCamera([](Camera& camera) { camera.FOV(clamp(camera.FOV() / 1.1, minimumFOV, maximumFOV)); });
+            break;
+        case '-':
+            updateCamera([](Camera& camera) { camera.FOV(clamp(camera.FOV() * 1.1, minimumFOV, maximumFOV)); });
+            break;
+        default:
+            break;
+    }
+}
+
+void specialKeyboard(int key, [[maybe_unused]] int x, [[maybe_unused]] int y)
+{
+    switch (key)
+    {
+        case GLUT_KEY_LEFT:
+            updateCamera([](Camera& camera) { camera.turn(cameraTurnStep, 0.0); });
+            break;
+        case GLUT_KEY_RIGHT:
+            updateCamera([](Camera& camera) { camera.turn(-cameraTurnStep, 0.0); });
+            break;
+        case GLUT_KEY_UP:
+            updateCamera([](Camera& camera) { camera.turn(0.0, cameraTurnStep); });
+            break;
+        case GLUT_KEY_DOWN:
+            updateCamera([](Camera& camera) { camera.turn(0.0, -cameraTurnStep); });
+            break;
+        default:
+            break;
+    }
+}
+
+void mouseButton(int button, int state, int x, int y)
+{
+    if (button != GLUT_LEFT_BUTTON)
+        return;
+
+    mouseDrag.active = (state == GLUT_DOWN);
+    mouseDrag.x      = x;
+    mouseDrag.y      = y;
+}
+
+void mouseMotion(int x, int y)
+{
+    if (!mouseDrag.active || (x == mouseDrag.x && y == mouseDrag.y))
+        return;
+
+    // Dragging to the right turns the camera to the right, dragging up (toward a lower y in the window) turns it up
+    const double left   = static_cast<double>(mouseDrag.x - x) * cameraDragStep;
+    const double upward = static_cast<double>(mouseDrag.y - y) * cameraDragStep;
+
+    mouseDrag.x = x;
+    mouseDrag.y = y;
+
+    updateCamera([left, upward](Camera& camera) { camera.turn(left, upward); });
+}
+
+void refreshDisplay([[maybe_unused]] int value)
+{
+    glutPostRedisplay();
+
+    // The last refresh shows the finished image
+    refreshPlanned = Renderer::isRendering();
+    if (refreshPlanned)
+        glutTimerFunc(refreshPeriod, refreshDisplay, 0);
+}